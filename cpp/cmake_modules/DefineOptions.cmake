@@ -78,6 +78,10 @@ if("${CMAKE_SOURCE_DIR}" STREQUAL "${CMAKE_CURRENT_SOURCE_DIR}")
 
   define_option(ARROW_SSE42 "Build with SSE4.2 if compiler has support" ON)
 
+  define_option(ARROW_AVX2
+                "Build kernels using AVX2, selected at runtime, if compiler has support"
+                ON)
+
   define_option(ARROW_ALTIVEC "Build with Altivec if compiler has support" ON)
 
   define_option(ARROW_RPATH_ORIGIN "Build Arrow libraries with RATH set to \$ORIGIN" OFF)
@@ -20,6 +20,7 @@
 include(CheckCXXCompilerFlag)
 # x86/amd64 compiler flags
 check_cxx_compiler_flag("-msse4.2" CXX_SUPPORTS_SSE4_2)
+check_cxx_compiler_flag("-mavx2" CXX_SUPPORTS_AVX2)
 # power compiler flags
 check_cxx_compiler_flag("-maltivec" CXX_SUPPORTS_ALTIVEC)
 # Arm64 compiler flags
@@ -19,7 +19,10 @@
 #include "arrow/adapters/orc/adapter_util.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstdint>
+#include <deque>
+#include <future>
 #include <list>
 #include <memory>
 #include <sstream>
@@ -43,6 +46,7 @@
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/range.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/visibility.h"
 
 #include "orc/Exceptions.hh"
@@ -157,10 +161,57 @@ class OrcStripeReader : public RecordBatchReader {
   int64_t batch_size_;
 };
 
+// A stripe decoded ahead of time by the prefetcher
+struct PrefetchedStripe {
+  Status status;
+  std::shared_ptr<Schema> schema;
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  // The number of bytes held by the batches
+  int64_t size = 0;
+};
+
+static int64_t BufferSize(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer) {
+      size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += BufferSize(*child);
+  }
+  return size;
+}
+
+static PrefetchedStripe DecodeStripe(OrcStripeReader* reader) {
+  PrefetchedStripe stripe;
+  stripe.schema = reader->schema();
+  try {
+    while (true) {
+      std::shared_ptr<RecordBatch> batch;
+      stripe.status = reader->ReadNext(&batch);
+      if (!stripe.status.ok() || !batch) {
+        break;
+      }
+      for (int i = 0; i < batch->num_columns(); i++) {
+        stripe.size += BufferSize(*batch->column_data(i));
+      }
+      stripe.batches.push_back(std::move(batch));
+    }
+  } catch (const liborc::ParseError& e) {
+    stripe.status = Status::Invalid(e.what());
+  }
+  if (!stripe.status.ok()) {
+    stripe.batches.clear();
+    stripe.size = 0;
+  }
+  return stripe;
+}
+
 class ORCFileReader::Impl {
  public:
   Impl() {}
-  ~Impl() {}
+  ~Impl() { StopPrefetch(); }
 
   Status Open(const std::shared_ptr<io::RandomAccessFile>& file, MemoryPool* pool) {
     std::unique_ptr<ArrowInputFile> io_wrapper(new ArrowInputFile(file));
@@ -363,16 +414,31 @@ class ORCFileReader::Impl {
     ARROW_RETURN_IF(row_number >= NumberOfRows(),
                     Status::Invalid("Out of bounds row number: ", row_number));
 
+    StopPrefetch();
     current_row_ = row_number;
     return Status::OK();
   }
 
+  Status SetStripePrefetch(int depth, int64_t memory_limit) {
+    ARROW_RETURN_IF(depth < 0, Status::Invalid("Negative prefetch depth: ", depth));
+    // The limit is unused when prefetching is disabled
+    ARROW_RETURN_IF(depth > 0 && memory_limit <= 0,
+                    Status::Invalid("Prefetch memory limit must be positive"));
+    StopPrefetch();
+    prefetch_depth_ = depth;
+    prefetch_memory_limit_ = memory_limit;
+    return Status::OK();
+  }
+
   Status NextStripeReader(int64_t batch_size, const std::vector<int>& include_indices,
                           std::shared_ptr<RecordBatchReader>* out) {
     if (current_row_ >= NumberOfRows()) {
       out->reset();
       return Status::OK();
     }
+    if (prefetch_depth_ > 0) {
+      return NextPrefetchedStripeReader(batch_size, include_indices, out);
+    }
 
     liborc::RowReaderOptions opts;
     if (!include_indices.empty()) {
@@ -401,10 +467,114 @@ class ORCFileReader::Impl {
   }
 
  private:
+  Status NextPrefetchedStripeReader(int64_t batch_size,
+                                    const std::vector<int>& include_indices,
+                                    std::shared_ptr<RecordBatchReader>* out) {
+    if (batch_size != prefetch_batch_size_ ||
+        include_indices != prefetch_include_indices_) {
+      // The stripes in flight were decoded with other parameters
+      StopPrefetch();
+      prefetch_batch_size_ = batch_size;
+      prefetch_include_indices_ = include_indices;
+    }
+    if (prefetched_.empty()) {
+      prefetch_row_ = current_row_;
+    }
+    RETURN_NOT_OK(SchedulePrefetch());
+
+    // Copy the stripe out of the shared state before releasing it
+    PrefetchedStripe stripe = prefetched_.front().result.get();
+    current_row_ = prefetched_.front().end_row;
+    prefetched_.pop_front();
+    RETURN_NOT_OK(stripe.status);
+
+    // Replace the consumed stripe before handing it out
+    RETURN_NOT_OK(SchedulePrefetch());
+    return MakeRecordBatchReader(stripe.batches, stripe.schema, out);
+  }
+
+  // Schedule the decoding of the following stripes, within the depth and
+  // memory limits
+  Status SchedulePrefetch() {
+    while (static_cast<int>(prefetched_.size()) < prefetch_depth_ &&
+           prefetch_row_ < NumberOfRows()) {
+      if (!prefetched_.empty() && BufferedPrefetchSize() > prefetch_memory_limit_) {
+        break;
+      }
+      RETURN_NOT_OK(PrefetchStripe());
+    }
+    return Status::OK();
+  }
+
+  // The memory held by the decoded stripes which were not consumed yet.
+  // Stripes still being decoded are not accounted for.
+  int64_t BufferedPrefetchSize() const {
+    int64_t size = 0;
+    for (const auto& stripe : prefetched_) {
+      if (stripe.result.wait_for(std::chrono::seconds(0)) ==
+          std::future_status::ready) {
+        size += stripe.result.get().size;
+      }
+    }
+    return size;
+  }
+
+  Status PrefetchStripe() {
+    // Row readers are created on the caller thread, which is the only one using
+    // the liborc::Reader. Each row reader is then used by a single worker.
+    liborc::RowReaderOptions opts;
+    if (!prefetch_include_indices_.empty()) {
+      RETURN_NOT_OK(SelectIndices(&opts, prefetch_include_indices_));
+    }
+    StripeInformation stripe_info({0, 0, 0, 0});
+    RETURN_NOT_OK(SelectStripeWithRowNumber(&opts, prefetch_row_, &stripe_info));
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(ReadSchema(opts, &schema));
+    std::unique_ptr<liborc::RowReader> row_reader;
+    try {
+      row_reader = reader_->createRowReader(opts);
+      row_reader->seekToRow(prefetch_row_);
+    } catch (const liborc::ParseError& e) {
+      return Status::Invalid(e.what());
+    }
+
+    auto stripe_reader = std::make_shared<OrcStripeReader>(
+        std::move(row_reader), schema, prefetch_batch_size_, pool_);
+    auto pool = ::arrow::internal::GetCpuThreadPool();
+    prefetch_row_ = stripe_info.first_row_of_stripe + stripe_info.num_rows;
+    prefetched_.push_back(
+        {prefetch_row_,
+         pool->Submit([stripe_reader]() { return DecodeStripe(stripe_reader.get()); })
+             .share()});
+    return Status::OK();
+  }
+
+  // Wait for the stripes in flight and discard them
+  void StopPrefetch() {
+    for (const auto& stripe : prefetched_) {
+      stripe.result.wait();
+    }
+    prefetched_.clear();
+  }
+
   MemoryPool* pool_;
   std::unique_ptr<liborc::Reader> reader_;
   std::vector<StripeInformation> stripes_;
   int64_t current_row_;
+
+  int prefetch_depth_ = 0;
+  int64_t prefetch_memory_limit_ = kDefaultStripePrefetchMemoryLimit;
+  int64_t prefetch_batch_size_ = 0;
+  std::vector<int> prefetch_include_indices_;
+  struct PendingStripe {
+    // The row following the stripe
+    int64_t end_row;
+    std::shared_future<PrefetchedStripe> result;
+  };
+  // Stripes being decoded or waiting to be consumed, in row order
+  std::deque<PendingStripe> prefetched_;
+  // The first row of the next stripe to prefetch
+  int64_t prefetch_row_ = 0;
 };
 
 ORCFileReader::ORCFileReader() { impl_.reset(new ORCFileReader::Impl()); }
@@ -463,6 +633,10 @@ Status ORCFileReader::NextStripeReader(int64_t batch_size,
   return impl_->NextStripeReader(batch_size, include_indices, out);
 }
 
+Status ORCFileReader::SetStripePrefetch(int depth, int64_t memory_limit) {
+  return impl_->SetStripePrefetch(depth, memory_limit);
+}
+
 int64_t ORCFileReader::NumberOfStripes() { return impl_->NumberOfStripes(); }
 
 int64_t ORCFileReader::NumberOfRows() { return impl_->NumberOfRows(); }
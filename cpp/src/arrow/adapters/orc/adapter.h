@@ -35,6 +35,9 @@ namespace adapters {
 
 namespace orc {
 
+/// \brief Default cap on the memory held by stripes decoded ahead of time
+constexpr int64_t kDefaultStripePrefetchMemoryLimit = 256 * 1024 * 1024;
+
 /// \class ORCFileReader
 /// \brief Read an Arrow Table or RecordBatch from an ORC file.
 class ARROW_EXPORT ORCFileReader {
@@ -131,6 +134,23 @@ class ARROW_EXPORT ORCFileReader {
   Status NextStripeReader(int64_t batch_size, const std::vector<int>& include_indices,
                           std::shared_ptr<RecordBatchReader>* out);
 
+  /// \brief Read and decode stripes ahead of NextStripeReader() on the CPU
+  ///        thread pool, so that consuming a stripe overlaps with the I/O and
+  ///        conversion of the following ones.
+  ///
+  /// While enabled, NextStripeReader() returns readers over stripes that were
+  /// decoded in the background, and schedules up to depth following stripes.
+  /// No further stripe is scheduled while the decoded stripes waiting to be
+  /// consumed hold more than memory_limit bytes, although the next stripe is
+  /// always scheduled.
+  ///
+  /// \param[in] depth the maximum number of stripes decoded ahead. 0 disables
+  ///            prefetching.
+  /// \param[in] memory_limit the approximate number of bytes of decoded data
+  ///            above which prefetching pauses, must be positive unless depth is 0
+  Status SetStripePrefetch(int depth,
+                           int64_t memory_limit = kDefaultStripePrefetchMemoryLimit);
+
   /// \brief The number of stripes in the file
   int64_t NumberOfStripes();
 
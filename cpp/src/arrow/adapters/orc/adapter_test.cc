@@ -20,6 +20,8 @@
 #include "arrow/adapters/orc/adapter.h"
 #include "arrow/array.h"
 #include "arrow/io/api.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
 
 #include <gtest/gtest.h>
 #include <orc/OrcFile.hh>
@@ -69,17 +71,16 @@ std::unique_ptr<liborc::Writer> CreateWriter(uint64_t stripe_size,
   return liborc::createWriter(type, stream, options);
 }
 
-TEST(TestAdapter, readIntAndStringFileMultipleStripes) {
-  MemoryOutputStream mem_stream(DEFAULT_MEM_STREAM_SIZE);
+// Write stripe_count stripes of stripe_row_count rows, where row i holds
+// i % stripe_row_count both as an int and as a string
+void WriteIntAndStringFile(uint64_t stripe_count, uint64_t stripe_row_count,
+                           MemoryOutputStream* mem_stream) {
   ORC_UNIQUE_PTR<liborc::Type> type(
       liborc::Type::buildTypeFromString("struct<col1:int,col2:string>"));
 
   constexpr uint64_t stripe_size = 1024;  // 1K
-  constexpr uint64_t stripe_count = 10;
-  constexpr uint64_t stripe_row_count = 65535;
-  constexpr uint64_t reader_batch_size = 1024;
 
-  auto writer = CreateWriter(stripe_size, *type, &mem_stream);
+  auto writer = CreateWriter(stripe_size, *type, mem_stream);
   auto batch = writer->createRowBatch(stripe_row_count);
   auto struct_batch = dynamic_cast<liborc::StructVectorBatch*>(batch.get());
   auto long_batch = dynamic_cast<liborc::LongVectorBatch*>(struct_batch->fields[0]);
@@ -106,6 +107,14 @@ TEST(TestAdapter, readIntAndStringFileMultipleStripes) {
   }
 
   writer->close();
+}
+
+TEST(TestAdapter, readIntAndStringFileMultipleStripes) {
+  MemoryOutputStream mem_stream(DEFAULT_MEM_STREAM_SIZE);
+  constexpr uint64_t stripe_count = 10;
+  constexpr uint64_t stripe_row_count = 65535;
+  constexpr uint64_t reader_batch_size = 1024;
+  WriteIntAndStringFile(stripe_count, stripe_row_count, &mem_stream);
 
   std::shared_ptr<io::RandomAccessFile> in_stream(new io::BufferReader(
       std::make_shared<Buffer>(reinterpret_cast<const uint8_t*>(mem_stream.getData()),
@@ -117,7 +126,7 @@ TEST(TestAdapter, readIntAndStringFileMultipleStripes) {
 
   ASSERT_EQ(stripe_row_count * stripe_count, reader->NumberOfRows());
   ASSERT_EQ(stripe_count, reader->NumberOfStripes());
-  accumulated = 0;
+  int64_t accumulated = 0;
   std::shared_ptr<RecordBatchReader> stripe_reader;
   EXPECT_TRUE(reader->NextStripeReader(reader_batch_size, &stripe_reader).ok());
   while (stripe_reader) {
@@ -157,4 +166,122 @@ TEST(TestAdapter, readIntAndStringFileMultipleStripes) {
     EXPECT_TRUE(stripe_reader->ReadNext(&record_batch).ok());
   }
 }
+
+TEST(TestAdapter, readNullableColumns) {
+  MemoryOutputStream mem_stream(DEFAULT_MEM_STREAM_SIZE);
+  ORC_UNIQUE_PTR<liborc::Type> type(liborc::Type::buildTypeFromString(
+      "struct<a:int,b:string,c:binary,d:decimal(10,2),e:float>"));
+  constexpr uint64_t num_rows = 5;
+
+  auto writer = CreateWriter(/*stripe_size=*/1024, *type, &mem_stream);
+  auto batch = writer->createRowBatch(num_rows);
+  auto struct_batch = dynamic_cast<liborc::StructVectorBatch*>(batch.get());
+  auto int_batch = dynamic_cast<liborc::LongVectorBatch*>(struct_batch->fields[0]);
+  auto str_batch = dynamic_cast<liborc::StringVectorBatch*>(struct_batch->fields[1]);
+  auto bin_batch = dynamic_cast<liborc::StringVectorBatch*>(struct_batch->fields[2]);
+  auto dec_batch = dynamic_cast<liborc::Decimal64VectorBatch*>(struct_batch->fields[3]);
+  auto float_batch = dynamic_cast<liborc::DoubleVectorBatch*>(struct_batch->fields[4]);
+
+  // Odd rows are null in every column
+  std::vector<std::string> strings = {"", "", "abc", "", "defgh"};
+  for (auto field : struct_batch->fields) {
+    field->hasNulls = true;
+    field->numElements = num_rows;
+  }
+  for (uint64_t i = 0; i < num_rows; ++i) {
+    for (auto field : struct_batch->fields) {
+      field->notNull[i] = i % 2 == 0;
+    }
+    int_batch->data[i] = static_cast<int64_t>(i) * -1000;
+    str_batch->data[i] = const_cast<char*>(strings[i].data());
+    str_batch->length[i] = static_cast<int64_t>(strings[i].size());
+    bin_batch->data[i] = const_cast<char*>(strings[i].data());
+    bin_batch->length[i] = static_cast<int64_t>(strings[i].size());
+    dec_batch->values[i] = static_cast<int64_t>(i) * 125;
+    float_batch->data[i] = static_cast<double>(i) / 2;
+  }
+  struct_batch->numElements = num_rows;
+  writer->add(*batch);
+  writer->close();
+
+  std::shared_ptr<io::RandomAccessFile> in_stream(new io::BufferReader(
+      std::make_shared<Buffer>(reinterpret_cast<const uint8_t*>(mem_stream.getData()),
+                               static_cast<int64_t>(mem_stream.getLength()))));
+  std::unique_ptr<adapters::orc::ORCFileReader> reader;
+  ASSERT_OK(
+      adapters::orc::ORCFileReader::Open(in_stream, default_memory_pool(), &reader));
+  std::shared_ptr<Table> table;
+  ASSERT_OK(reader->Read(&table));
+  ASSERT_EQ(5, table->num_columns());
+  ASSERT_EQ(1, table->column(0)->num_chunks());
+
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[0, null, -2000, null, -4000]"),
+                    *table->column(0)->chunk(0));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["", null, "abc", null, "defgh"])"),
+                    *table->column(1)->chunk(0));
+  AssertArraysEqual(*ArrayFromJSON(binary(), R"(["", null, "abc", null, "defgh"])"),
+                    *table->column(2)->chunk(0));
+  AssertArraysEqual(
+      *ArrayFromJSON(decimal(10, 2), R"(["0.00", null, "2.50", null, "5.00"])"),
+      *table->column(3)->chunk(0));
+  AssertArraysEqual(*ArrayFromJSON(float32(), "[0, null, 1, null, 2]"),
+                    *table->column(4)->chunk(0));
+}
+
+TEST(TestAdapter, readWithStripePrefetch) {
+  MemoryOutputStream mem_stream(DEFAULT_MEM_STREAM_SIZE);
+  constexpr uint64_t stripe_count = 10;
+  constexpr uint64_t stripe_row_count = 10000;
+  constexpr uint64_t reader_batch_size = 1024;
+  WriteIntAndStringFile(stripe_count, stripe_row_count, &mem_stream);
+
+  std::shared_ptr<io::RandomAccessFile> in_stream(new io::BufferReader(
+      std::make_shared<Buffer>(reinterpret_cast<const uint8_t*>(mem_stream.getData()),
+                               static_cast<int64_t>(mem_stream.getLength()))));
+
+  std::unique_ptr<adapters::orc::ORCFileReader> reader;
+  ASSERT_TRUE(
+      adapters::orc::ORCFileReader::Open(in_stream, default_memory_pool(), &reader).ok());
+  ASSERT_FALSE(reader->SetStripePrefetch(-1).ok());
+  ASSERT_FALSE(reader->SetStripePrefetch(2, 0).ok());
+  ASSERT_TRUE(reader->SetStripePrefetch(0, 0).ok());
+
+  // Read every stripe from the given row, checking the values and returning
+  // the number of rows read
+  auto check_stripes = [&](int64_t start_row) {
+    int64_t row = start_row;
+    std::shared_ptr<RecordBatchReader> stripe_reader;
+    EXPECT_TRUE(reader->NextStripeReader(reader_batch_size, &stripe_reader).ok());
+    while (stripe_reader) {
+      std::shared_ptr<RecordBatch> record_batch;
+      EXPECT_TRUE(stripe_reader->ReadNext(&record_batch).ok());
+      while (record_batch) {
+        EXPECT_LE(record_batch->num_rows(), static_cast<int64_t>(reader_batch_size));
+        auto int32_array = std::dynamic_pointer_cast<Int32Array>(record_batch->column(0));
+        auto str_array = std::dynamic_pointer_cast<StringArray>(record_batch->column(1));
+        for (int j = 0; j < record_batch->num_rows(); ++j) {
+          EXPECT_EQ(row % stripe_row_count, int32_array->Value(j));
+          EXPECT_EQ(std::to_string(row % stripe_row_count), str_array->GetString(j));
+          row++;
+        }
+        EXPECT_TRUE(stripe_reader->ReadNext(&record_batch).ok());
+      }
+      EXPECT_TRUE(reader->NextStripeReader(reader_batch_size, &stripe_reader).ok());
+    }
+    return row - start_row;
+  };
+
+  // A memory limit of 1 byte still leaves one stripe in flight
+  for (int64_t memory_limit : {adapters::orc::kDefaultStripePrefetchMemoryLimit,
+                               static_cast<int64_t>(1)}) {
+    ASSERT_TRUE(reader->SetStripePrefetch(3, memory_limit).ok());
+    ASSERT_TRUE(reader->Seek(0).ok());
+    ASSERT_EQ(stripe_row_count * stripe_count, check_stripes(0));
+
+    // Seeking discards the stripes decoded ahead
+    const int64_t start_row = 3 * stripe_row_count + 17;
+    ASSERT_TRUE(reader->Seek(start_row).ok());
+    ASSERT_EQ(stripe_row_count * stripe_count - start_row, check_stripes(start_row));
+  }
+}
 }  // namespace arrow
@@ -26,9 +26,14 @@
 #include "arrow/compute/kernels/compare.h"          // IWYU pragma: export
 #include "arrow/compute/kernels/count.h"            // IWYU pragma: export
 #include "arrow/compute/kernels/filter.h"           // IWYU pragma: export
+#include "arrow/compute/kernels/group_by.h"         // IWYU pragma: export
 #include "arrow/compute/kernels/hash.h"             // IWYU pragma: export
+#include "arrow/compute/kernels/hash_join.h"        // IWYU pragma: export
+#include "arrow/compute/kernels/hash_partition.h"   // IWYU pragma: export
 #include "arrow/compute/kernels/isin.h"             // IWYU pragma: export
 #include "arrow/compute/kernels/mean.h"             // IWYU pragma: export
+#include "arrow/compute/kernels/min_max.h"          // IWYU pragma: export
+#include "arrow/compute/kernels/selection.h"        // IWYU pragma: export
 #include "arrow/compute/kernels/sort_to_indices.h"  // IWYU pragma: export
 #include "arrow/compute/kernels/sum.h"              // IWYU pragma: export
 #include "arrow/compute/kernels/take.h"             // IWYU pragma: export
@@ -36,6 +36,7 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/thread_pool.h"
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
@@ -69,6 +70,88 @@ TEST(TestDatum, ImplicitConstructors) {
   CheckImplicitConstructor<Table>(Datum::TABLE);
 }
 
+// ----------------------------------------------------------------------
+// FunctionContext
+
+TEST(TestFunctionContext, Defaults) {
+  FunctionContext ctx;
+  ASSERT_TRUE(ctx.use_threads());
+  ASSERT_EQ(ctx.executor(), internal::GetCpuThreadPool());
+
+  std::shared_ptr<internal::ThreadPool> pool;
+  ASSERT_OK(internal::ThreadPool::Make(2, &pool));
+  ctx.set_executor(pool.get());
+  ctx.set_use_threads(false);
+  ASSERT_FALSE(ctx.use_threads());
+  ASSERT_EQ(ctx.executor(), pool.get());
+}
+
+class TestParallelForChunks : public ComputeFixture, public TestBase {};
+
+TEST_F(TestParallelForChunks, RunsAllTasks) {
+  // Long enough to run concurrently
+  const int64_t length = 1 << 20;
+  std::shared_ptr<internal::ThreadPool> pool;
+  ASSERT_OK(internal::ThreadPool::Make(2, &pool));
+  for (internal::ThreadPool* executor : {internal::GetCpuThreadPool(), pool.get()}) {
+    this->ctx_.set_executor(executor);
+    for (bool use_threads : {true, false}) {
+      this->ctx_.set_use_threads(use_threads);
+      std::vector<int> done(16, 0);
+      ASSERT_OK(detail::ParallelForChunks(&this->ctx_, 16, length,
+                                          [&](FunctionContext* task_ctx, int i) {
+                                            // Tasks don't spawn more tasks
+                                            EXPECT_FALSE(use_threads &&
+                                                         task_ctx->use_threads());
+                                            done[i]++;
+                                            return Status::OK();
+                                          }));
+      ASSERT_EQ(done, std::vector<int>(16, 1));
+    }
+  }
+}
+
+TEST_F(TestParallelForChunks, CalledFromExecutorThread) {
+  // Waiting on the only thread of the executor would deadlock, so the tasks
+  // run inline
+  const int64_t length = 1 << 20;
+  std::shared_ptr<internal::ThreadPool> pool;
+  ASSERT_OK(internal::ThreadPool::Make(1, &pool));
+  this->ctx_.set_executor(pool.get());
+  std::vector<int> done(4, 0);
+  auto future = pool->Submit([&]() {
+    return detail::ParallelForChunks(&this->ctx_, 4, length,
+                                     [&](FunctionContext* task_ctx, int i) {
+                                       done[i]++;
+                                       return Status::OK();
+                                     });
+  });
+  ASSERT_OK(future.get());
+  ASSERT_EQ(done, std::vector<int>(4, 1));
+}
+
+TEST_F(TestParallelForChunks, Errors) {
+  const int64_t length = 1 << 20;
+  ASSERT_RAISES(Invalid, detail::ParallelForChunks(
+                             &this->ctx_, 4, length, [](FunctionContext*, int i) {
+                               return i == 2 ? Status::Invalid("task ", i) : Status::OK();
+                             }));
+  // Errors set on the task context are propagated too
+  for (bool use_threads : {true, false}) {
+    FunctionContext ctx;
+    ctx.set_use_threads(use_threads);
+    ASSERT_RAISES(IOError,
+                  detail::ParallelForChunks(&ctx, 4, length,
+                                            [](FunctionContext* task_ctx, int i) {
+                                              if (i == 1) {
+                                                task_ctx->SetStatus(
+                                                    Status::IOError("task ", i));
+                                              }
+                                              return Status::OK();
+                                            }));
+  }
+}
+
 class TestInvokeBinaryKernel : public ComputeFixture, public TestBase {};
 
 TEST_F(TestInvokeBinaryKernel, Exceptions) {
@@ -21,6 +21,7 @@
 
 #include "arrow/buffer.h"
 #include "arrow/util/cpu_info.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace compute {
@@ -44,5 +45,9 @@ void FunctionContext::SetStatus(const Status& status) {
 /// \brief Clear any error status
 void FunctionContext::ResetStatus() { status_ = Status::OK(); }
 
+internal::ThreadPool* FunctionContext::executor() const {
+  return executor_ != nullptr ? executor_ : internal::GetCpuThreadPool();
+}
+
 }  // namespace compute
 }  // namespace arrow
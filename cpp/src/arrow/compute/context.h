@@ -32,6 +32,7 @@ class Buffer;
 
 namespace internal {
 class CpuInfo;
+class ThreadPool;
 }  // namespace internal
 
 namespace compute {
@@ -70,10 +71,22 @@ class ARROW_EXPORT FunctionContext {
 
   internal::CpuInfo* cpu_info() const { return cpu_info_; }
 
+  /// \brief Whether kernels may process the chunks of ChunkedArray inputs
+  /// concurrently on the executor (default true)
+  bool use_threads() const { return use_threads_; }
+  void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
+
+  /// \brief The executor for concurrent kernel tasks, the global CPU thread
+  /// pool unless set
+  internal::ThreadPool* executor() const;
+  void set_executor(internal::ThreadPool* executor) { executor_ = executor; }
+
  private:
   Status status_;
   MemoryPool* pool_;
   internal::CpuInfo* cpu_info_;
+  bool use_threads_ = true;
+  internal::ThreadPool* executor_ = NULLPTR;
 };
 
 }  // namespace compute
@@ -58,6 +58,12 @@ class ARROW_EXPORT OpKernel {
   /// \brief EXPERIMENTAL The output data type of the kernel
   /// \return the output type
   virtual std::shared_ptr<DataType> out_type() const = 0;
+
+  /// \brief EXPERIMENTAL Whether Call may be invoked concurrently from several
+  /// threads, e.g. on the chunks of a ChunkedArray
+  ///
+  /// Kernels which keep state across calls must return false.
+  virtual bool is_thread_safe() const { return false; }
 };
 
 struct Datum;
@@ -16,9 +16,12 @@
 // under the License.
 
 #include <utility>
+#include <vector>
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/table.h"
 
 namespace arrow {
 namespace compute {
@@ -50,7 +53,12 @@ class ManagedAggregateState {
 };
 
 Status AggregateUnaryKernel::Call(FunctionContext* ctx, const Datum& input, Datum* out) {
-  if (!input.is_array()) return Status::Invalid("AggregateKernel expects Array datum");
+  if (input.kind() == Datum::CHUNKED_ARRAY) {
+    return CallChunked(ctx, *input.chunked_array(), out);
+  }
+  if (!input.is_array()) {
+    return Status::Invalid("AggregateKernel expects Array or ChunkedArray datum");
+  }
 
   auto state = ManagedAggregateState::Make(aggregate_function_, ctx->memory_pool());
   if (!state) return Status::OutOfMemory("AggregateState allocation failed");
@@ -62,6 +70,31 @@ Status AggregateUnaryKernel::Call(FunctionContext* ctx, const Datum& input, Datu
   return Status::OK();
 }
 
+Status AggregateUnaryKernel::CallChunked(FunctionContext* ctx,
+                                         const ChunkedArray& input, Datum* out) {
+  const int num_chunks = input.num_chunks();
+
+  // One state per chunk, so that chunks can be consumed concurrently
+  std::vector<std::shared_ptr<ManagedAggregateState>> states(num_chunks);
+  for (int i = 0; i < num_chunks; i++) {
+    states[i] = ManagedAggregateState::Make(aggregate_function_, ctx->memory_pool());
+    if (!states[i]) return Status::OutOfMemory("AggregateState allocation failed");
+  }
+
+  RETURN_NOT_OK(detail::ParallelForChunks(
+      ctx, num_chunks, input.length(), [&](FunctionContext*, int i) {
+        return aggregate_function_->Consume(*input.chunk(i), states[i]->mutable_data());
+      }));
+
+  auto state = ManagedAggregateState::Make(aggregate_function_, ctx->memory_pool());
+  if (!state) return Status::OutOfMemory("AggregateState allocation failed");
+  for (const auto& chunk_state : states) {
+    RETURN_NOT_OK(
+        aggregate_function_->Merge(chunk_state->mutable_data(), state->mutable_data()));
+  }
+  return aggregate_function_->Finalize(state->mutable_data(), out);
+}
+
 std::shared_ptr<DataType> AggregateUnaryKernel::out_type() const {
   return aggregate_function_->out_type();
 }
@@ -24,6 +24,7 @@
 namespace arrow {
 
 class Array;
+class ChunkedArray;
 class Status;
 
 namespace compute {
@@ -98,6 +99,9 @@ class AggregateFunctionStaticState : public AggregateFunction {
 };
 
 /// \brief UnaryKernel implemented by an AggregateState
+///
+/// The chunks of a ChunkedArray input are consumed concurrently on the CPU
+/// thread pool, each into its own state, and the states are then merged.
 class ARROW_EXPORT AggregateUnaryKernel : public UnaryKernel {
  public:
   explicit AggregateUnaryKernel(std::shared_ptr<AggregateFunction>& aggregate)
@@ -108,6 +112,8 @@ class ARROW_EXPORT AggregateUnaryKernel : public UnaryKernel {
   std::shared_ptr<DataType> out_type() const override;
 
  private:
+  Status CallChunked(FunctionContext* ctx, const ChunkedArray& input, Datum* out);
+
   std::shared_ptr<AggregateFunction> aggregate_function_;
 };
 
@@ -23,6 +23,7 @@
 #include "arrow/compute/benchmark_util.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/min_max.h"
 #include "arrow/compute/kernels/sum.h"
 #include "arrow/memory_pool.h"
 #include "arrow/testing/gtest_util.h"
@@ -328,5 +329,26 @@ static void SumKernel(benchmark::State& state) {
 
 BENCHMARK(SumKernel)->Apply(RegressionSetArgs);
 
+static void SummaryStatisticsKernel(benchmark::State& state) {
+  const int64_t array_size = state.range(0) / sizeof(int64_t);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(1923);
+  auto array = std::static_pointer_cast<NumericArray<Int64Type>>(
+      rand.Int64(array_size, -100, 100, null_percent));
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(SummaryStatistics(&ctx, Datum(array), &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["size"] = static_cast<double>(state.range(0));
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.SetBytesProcessed(state.iterations() * array_size * sizeof(int64_t));
+}
+
+BENCHMARK(SummaryStatisticsKernel)->Apply(RegressionSetArgs);
+
 }  // namespace compute
 }  // namespace arrow
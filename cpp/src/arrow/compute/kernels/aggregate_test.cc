@@ -16,6 +16,7 @@
 // under the License.
 
 #include <algorithm>
+#include <cmath>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -26,12 +27,15 @@
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/count.h"
 #include "arrow/compute/kernels/mean.h"
+#include "arrow/compute/kernels/min_max.h"
 #include "arrow/compute/kernels/sum.h"
 #include "arrow/compute/kernels/sum_internal.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/cpu_info.h"
 
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
@@ -242,6 +246,207 @@ TYPED_TEST(TestRandomNumericMeanKernel, RandomArrayMean) {
   }
 }
 
+///
+/// MinMax
+///
+
+template <typename ArrowType>
+static Datum NaiveSummaryStatistics(const Array& input) {
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+  using SumType = typename FindAccumulatorType<ArrowType>::Type;
+  using SumScalarType = typename TypeTraits<SumType>::ScalarType;
+
+  const auto& array = internal::checked_cast<const ArrayType&>(input);
+  const auto sum = NaiveSumPartial<ArrowType>(array);
+  CType min = 0, max = 0;
+  bool first = true;
+  for (int64_t i = 0; i < array.length(); i++) {
+    if (array.IsNull(i)) continue;
+    const CType value = array.Value(i);
+    min = (first || value < min) ? value : min;
+    max = (first || max < value) ? value : max;
+    first = false;
+  }
+
+  const bool is_valid = sum.second > 0;
+  std::vector<Datum> expected;
+  expected.emplace_back(std::make_shared<ScalarType>(min, is_valid));
+  expected.emplace_back(std::make_shared<ScalarType>(max, is_valid));
+  expected.emplace_back(std::make_shared<SumScalarType>(sum.first, is_valid));
+  expected.emplace_back(std::make_shared<Int64Scalar>(static_cast<int64_t>(sum.second)));
+  expected.emplace_back(std::make_shared<Int64Scalar>(array.null_count()));
+  return expected;
+}
+
+// The sum of floating point values depends on the order of the additions, so
+// it is only compared approximately
+template <typename ArrowType>
+void AssertSummaryStatistics(FunctionContext* ctx, const Datum& input,
+                             const Array& expected_input) {
+  using SumType = typename FindAccumulatorType<ArrowType>::Type;
+
+  Datum result;
+  ASSERT_OK(SummaryStatistics(ctx, input, &result));
+  const auto expected = NaiveSummaryStatistics<ArrowType>(expected_input).collection();
+  const auto actual = result.collection();
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    if (i == 2) {
+      DatumEqual<SumType>::EnsureEqual(expected[i], actual[i]);
+    } else {
+      AssertDatumsEqual(expected[i], actual[i]);
+    }
+  }
+}
+
+template <typename ArrowType>
+void ValidateSummaryStatistics(FunctionContext* ctx, const Array& array) {
+  AssertSummaryStatistics<ArrowType>(ctx, array.data(), array);
+}
+
+template <typename ArrowType>
+void ValidateMinMax(FunctionContext* ctx, const char* json, const char* expected_min,
+                    const char* expected_max) {
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+  auto type = TypeTraits<ArrowType>::type_singleton();
+  auto array = ArrayFromJSON(type, json);
+  auto expected = ArrayFromJSON(type, std::string("[") + expected_min + ", " +
+                                          expected_max + "]");
+  const auto& expected_values = internal::checked_cast<const ArrayType&>(*expected);
+  std::vector<Datum> expected_scalars;
+  for (int64_t i = 0; i < 2; i++) {
+    const bool is_valid = expected_values.IsValid(i);
+    std::shared_ptr<Scalar> scalar = std::make_shared<ScalarType>(
+        is_valid ? expected_values.Value(i) : CType(0), is_valid);
+    expected_scalars.push_back(scalar);
+  }
+
+  Datum result;
+  ASSERT_OK(MinMax(ctx, *array, &result));
+  AssertDatumsEqual(Datum(expected_scalars), result);
+}
+
+template <typename ArrowType>
+class TestMinMaxKernelNumeric : public ComputeFixture, public TestBase {};
+
+TYPED_TEST_CASE(TestMinMaxKernelNumeric, NumericArrowTypes);
+TYPED_TEST(TestMinMaxKernelNumeric, SimpleMinMax) {
+  ValidateMinMax<TypeParam>(&this->ctx_, "[]", "null", "null");
+  ValidateMinMax<TypeParam>(&this->ctx_, "[null, null]", "null", "null");
+  ValidateMinMax<TypeParam>(&this->ctx_, "[5, 1, 2, 3, 4]", "1", "5");
+  ValidateMinMax<TypeParam>(&this->ctx_, "[5, null, 2, 3, 4]", "2", "5");
+  ValidateMinMax<TypeParam>(&this->ctx_, "[null, 7, null]", "7", "7");
+  ValidateMinMax<TypeParam>(&this->ctx_, "[9, 8, 7, 6, 5, 4, 3, 2, 1, 10, 11, 12]", "1",
+                            "12");
+}
+
+template <typename ArrowType>
+class TestMinMaxKernelFloating : public ComputeFixture, public TestBase {};
+
+TYPED_TEST_CASE(TestMinMaxKernelFloating, RealArrowTypes);
+TYPED_TEST(TestMinMaxKernelFloating, NaNAndInfinity) {
+  ValidateMinMax<TypeParam>(&this->ctx_, "[NaN, 1.5, -2.5, NaN]", "-2.5", "1.5");
+  ValidateMinMax<TypeParam>(&this->ctx_, "[Inf, 1, -Inf, null]", "-Inf", "Inf");
+  ValidateMinMax<TypeParam>(&this->ctx_, "[-0.5, -1.5, -2.5]", "-2.5", "-0.5");
+}
+
+TYPED_TEST(TestMinMaxKernelFloating, AllNaN) {
+  using ScalarType = typename TypeTraits<TypeParam>::ScalarType;
+
+  auto type = TypeTraits<TypeParam>::type_singleton();
+  // Both the dense and the sparse paths, the latter with whole bitmap bytes
+  for (const char* json : {"[NaN, NaN, NaN]", "[NaN, null, NaN]",
+                           "[NaN, NaN, NaN, NaN, NaN, NaN, NaN, NaN, NaN, null]"}) {
+    Datum result;
+    ASSERT_OK(MinMax(&this->ctx_, *ArrayFromJSON(type, json), &result));
+    for (const Datum& bound : result.collection()) {
+      const auto& scalar = internal::checked_cast<const ScalarType&>(*bound.scalar());
+      ASSERT_TRUE(scalar.is_valid) << json;
+      ASSERT_TRUE(std::isnan(scalar.value)) << json;
+    }
+  }
+}
+
+template <typename ArrowType>
+class TestRandomNumericMinMaxKernel : public ComputeFixture, public TestBase {
+ protected:
+  void SetUp() override {
+    TestBase::SetUp();
+    has_avx2_ = internal::CpuInfo::GetInstance()->IsSupported(internal::CpuInfo::AVX2);
+  }
+
+  void TearDown() override {
+    internal::CpuInfo::GetInstance()->EnableFeature(internal::CpuInfo::AVX2, has_avx2_);
+  }
+
+  bool has_avx2_;
+};
+
+TYPED_TEST_CASE(TestRandomNumericMinMaxKernel, NumericArrowTypes);
+TYPED_TEST(TestRandomNumericMinMaxKernel, RandomArrayMinMax) {
+  auto rand = random::RandomArrayGenerator(0x3f2e1d);
+  // Exercise both the portable and the AVX2 code paths, where supported
+  for (bool avx2 : {false, true}) {
+    if (avx2 && !this->has_avx2_) continue;
+    internal::CpuInfo::GetInstance()->EnableFeature(internal::CpuInfo::AVX2, avx2);
+    for (size_t i = 3; i < 14; i++) {
+      for (auto null_probability : {0.0, 0.01, 0.1, 0.5, 1.0}) {
+        for (auto length_adjust : {-2, -1, 0, 1, 2}) {
+          int64_t length = (1UL << i) + length_adjust;
+          auto array = rand.Numeric<TypeParam>(length, 0, 100, null_probability);
+          ValidateSummaryStatistics<TypeParam>(&this->ctx_, *array);
+        }
+      }
+    }
+  }
+}
+
+TYPED_TEST(TestRandomNumericMinMaxKernel, RandomSliceArrayMinMax) {
+  auto rand = random::RandomArrayGenerator(0x9c01f2);
+  const int64_t length = 1U << 8;
+  for (auto null_probability : {0.0, 0.05, 0.5}) {
+    auto array = rand.Numeric<TypeParam>(length, 0, 100, null_probability);
+    for (size_t i = 1; i < 16; i++) {
+      for (size_t j = 1; j < 16; j++) {
+        auto slice = array->Slice(i, length - i - j);
+        ValidateSummaryStatistics<TypeParam>(&this->ctx_, *slice);
+      }
+    }
+  }
+}
+
+TYPED_TEST(TestRandomNumericMinMaxKernel, ChunkedArrayMinMax) {
+  auto rand = random::RandomArrayGenerator(0x61a2b3);
+  const int64_t length = 1U << 12;
+  auto array = rand.Numeric<TypeParam>(length, 0, 100, 0.1);
+
+  ArrayVector chunks;
+  for (int64_t offset = 0; offset < length; offset += 1000) {
+    chunks.push_back(array->Slice(offset, 1000));
+  }
+  auto chunked = std::make_shared<ChunkedArray>(chunks);
+
+  AssertSummaryStatistics<TypeParam>(&this->ctx_, chunked, *array);
+
+  // No chunks
+  Datum result;
+  auto empty = std::make_shared<ChunkedArray>(ArrayVector{}, array->type());
+  ASSERT_OK(SummaryStatistics(&this->ctx_, empty, &result));
+  AssertDatumsEqual(Datum(std::make_shared<Int64Scalar>(0)), result.collection()[3]);
+}
+
+TEST(TestMinMaxKernel, Errors) {
+  FunctionContext ctx;
+  Datum result;
+  ASSERT_RAISES(Invalid, MinMax(&ctx, *ArrayFromJSON(utf8(), R"(["a"])"), &result));
+  ASSERT_RAISES(Invalid, MinMax(&ctx, Datum(), &result));
+}
+
 ///
 /// Count
 ///
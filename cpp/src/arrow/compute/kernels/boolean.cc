@@ -42,6 +42,8 @@ namespace compute {
 class BooleanUnaryKernel : public UnaryKernel {
  public:
   std::shared_ptr<DataType> out_type() const override { return boolean(); }
+
+  bool is_thread_safe() const override { return true; }
 };
 
 class InvertKernel : public BooleanUnaryKernel {
@@ -96,6 +98,8 @@ class BinaryBooleanKernel : public BinaryKernel {
   }
 
   std::shared_ptr<DataType> out_type() const override { return boolean(); }
+
+  bool is_thread_safe() const override { return true; }
 };
 
 class AndKernel : public BinaryBooleanKernel {
@@ -25,6 +25,7 @@
 
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
@@ -173,5 +174,32 @@ TEST_F(TestBooleanKernel, Xor) {
   TestBinaryKernel(Xor, values1, values2, values3, values3_nulls);
 }
 
+TEST_F(TestBooleanKernel, LargeChunkedArray) {
+  // Large enough for the chunks to be processed concurrently
+  auto rand = random::RandomArrayGenerator(0x4f2e8c);
+  ArrayVector left_chunks, right_chunks, and_chunks, invert_chunks;
+  for (int i = 0; i < 8; i++) {
+    left_chunks.push_back(rand.Boolean(10000, 0.5, 0.1));
+    right_chunks.push_back(rand.Boolean(10000, 0.5, 0.1));
+    Datum expected;
+    ASSERT_OK(And(&this->ctx_, left_chunks[i], right_chunks[i], &expected));
+    and_chunks.push_back(expected.make_array());
+    ASSERT_OK(Invert(&this->ctx_, left_chunks[i], &expected));
+    invert_chunks.push_back(expected.make_array());
+  }
+  auto left = std::make_shared<ChunkedArray>(left_chunks);
+  auto right = std::make_shared<ChunkedArray>(right_chunks);
+
+  for (bool use_threads : {true, false}) {
+    this->ctx_.set_use_threads(use_threads);
+    TestChunkedArrayBinary(And, left, right, std::make_shared<ChunkedArray>(and_chunks));
+
+    Datum result;
+    ASSERT_OK(Invert(&this->ctx_, left, &result));
+    ASSERT_EQ(Datum::CHUNKED_ARRAY, result.kind());
+    AssertChunkedEqual(ChunkedArray(invert_chunks), *result.chunked_array());
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
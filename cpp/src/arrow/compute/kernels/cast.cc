@@ -624,6 +624,9 @@ class CastKernelBase : public UnaryKernel {
 
   std::shared_ptr<DataType> out_type() const override { return out_type_; }
 
+  // Casts don't keep state across calls, errors are set on the given context
+  bool is_thread_safe() const override { return true; }
+
  protected:
   std::shared_ptr<DataType> out_type_;
 };
@@ -17,14 +17,26 @@
 
 #include "arrow/compute/kernels/compare.h"
 
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/util_internal.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
 
+using internal::checked_cast;
+
 namespace compute {
 
 std::shared_ptr<DataType> CompareBinaryKernel::out_type() const {
@@ -238,17 +250,371 @@ std::shared_ptr<CompareFunction> MakeCompareFunction(FunctionContext* ctx,
   }
 }
 
+// ----------------------------------------------------------------------
+// Comparisons with a scalar of another numeric type
+
+CompareOperator MirrorCompareOperator(CompareOperator op) {
+  switch (op) {
+    case CompareOperator::GREATER:
+      return CompareOperator::LESS;
+    case CompareOperator::GREATER_EQUAL:
+      return CompareOperator::LESS_EQUAL;
+    case CompareOperator::LESS:
+      return CompareOperator::GREATER;
+    case CompareOperator::LESS_EQUAL:
+      return CompareOperator::GREATER_EQUAL;
+    default:
+      return op;
+  }
+}
+
+namespace {
+
+// Where a scalar falls among the values of C type T: exactly on value, or
+// strictly between lo and hi, each of which may not exist. A NaN scalar is
+// neither exact nor has bounds.
+template <typename T>
+struct ScalarBounds {
+  bool exact = false;
+  T value = 0;
+  bool has_lo = false;
+  T lo = 0;
+  bool has_hi = false;
+  T hi = 0;
+};
+
+template <typename T, bool IsIntegral = std::is_integral<T>::value>
+struct NumericBounds;
+
+template <typename T>
+struct NumericBounds<T, true> {
+  using Limits = std::numeric_limits<T>;
+
+  static ScalarBounds<T> Exact(T value) {
+    ScalarBounds<T> bounds;
+    bounds.exact = true;
+    bounds.value = value;
+    return bounds;
+  }
+
+  static ScalarBounds<T> BelowMin() {
+    ScalarBounds<T> bounds;
+    bounds.has_hi = true;
+    bounds.hi = Limits::min();
+    return bounds;
+  }
+
+  static ScalarBounds<T> AboveMax() {
+    ScalarBounds<T> bounds;
+    bounds.has_lo = true;
+    bounds.lo = Limits::max();
+    return bounds;
+  }
+
+  static ScalarBounds<T> Of(int64_t v) {
+    if (v < static_cast<int64_t>(Limits::min())) {
+      return BelowMin();
+    }
+    if (v > 0 && static_cast<uint64_t>(v) > static_cast<uint64_t>(Limits::max())) {
+      return AboveMax();
+    }
+    return Exact(static_cast<T>(v));
+  }
+
+  static ScalarBounds<T> Of(uint64_t v) {
+    if (v > static_cast<uint64_t>(Limits::max())) {
+      return AboveMax();
+    }
+    return Exact(static_cast<T>(v));
+  }
+
+  static ScalarBounds<T> Of(double v) {
+    ScalarBounds<T> bounds;
+    if (std::isnan(v)) {
+      return bounds;
+    }
+    // One more than the max of T, unlike the max it is exactly a double
+    const double upper = std::ldexp(1.0, Limits::digits);
+    if (v < static_cast<double>(Limits::min())) {
+      return BelowMin();
+    }
+    if (v >= upper) {
+      return AboveMax();
+    }
+    const double lo = std::floor(v);
+    const double hi = std::ceil(v);
+    if (lo == hi) {
+      return Exact(static_cast<T>(v));
+    }
+    bounds.has_lo = true;
+    bounds.lo = static_cast<T>(lo);
+    if (hi < upper) {
+      bounds.has_hi = true;
+      bounds.hi = static_cast<T>(hi);
+    }
+    return bounds;
+  }
+
+  // A comparison with the same result for all valid values
+  static void Constant(bool result, CompareOperator* op, T* value) {
+    *op = result ? CompareOperator::GREATER_EQUAL : CompareOperator::LESS;
+    *value = Limits::min();
+  }
+};
+
+template <typename T>
+struct NumericBounds<T, false> {
+  using Limits = std::numeric_limits<T>;
+
+  // The scalar was rounded to the nearest T, order is the sign of the
+  // difference between the rounded value and the scalar
+  static ScalarBounds<T> Rounded(T rounded, int order) {
+    ScalarBounds<T> bounds;
+    if (order == 0) {
+      bounds.exact = true;
+      bounds.value = rounded;
+      return bounds;
+    }
+    bounds.has_lo = bounds.has_hi = true;
+    if (order > 0) {
+      bounds.lo = std::nextafter(rounded, -Limits::infinity());
+      bounds.hi = rounded;
+    } else {
+      bounds.lo = rounded;
+      bounds.hi = std::nextafter(rounded, Limits::infinity());
+    }
+    return bounds;
+  }
+
+  template <typename Integer>
+  static ScalarBounds<T> OfInteger(Integer v) {
+    const T rounded = static_cast<T>(v);
+    // The rounded value is integral, so compare it with v as an Integer, unless
+    // it is out of range after rounding up
+    if (rounded >= std::ldexp(T(1), std::numeric_limits<Integer>::digits)) {
+      return Rounded(rounded, 1);
+    }
+    const Integer back = static_cast<Integer>(rounded);
+    return Rounded(rounded, back < v ? -1 : (back > v ? 1 : 0));
+  }
+
+  static ScalarBounds<T> Of(int64_t v) { return OfInteger(v); }
+
+  static ScalarBounds<T> Of(uint64_t v) { return OfInteger(v); }
+
+  static ScalarBounds<T> Of(double v) {
+    if (std::isnan(v)) {
+      return ScalarBounds<T>();
+    }
+    if (std::isinf(v)) {
+      return Rounded(static_cast<T>(v), 0);
+    }
+    if (v > Limits::max()) {
+      return Rounded(Limits::infinity(), 1);
+    }
+    if (v < Limits::lowest()) {
+      return Rounded(-Limits::infinity(), -1);
+    }
+    const T rounded = static_cast<T>(v);
+    return Rounded(rounded, rounded < v ? -1 : (rounded > v ? 1 : 0));
+  }
+
+  // A comparison with the same result for all valid values, NaN included
+  static void Constant(bool result, CompareOperator* op, T* value) {
+    if (result) {
+      *op = CompareOperator::NOT_EQUAL;
+      *value = Limits::quiet_NaN();
+    } else {
+      *op = CompareOperator::LESS;
+      *value = -Limits::infinity();
+    }
+  }
+};
+
+template <typename T>
+Status GetScalarBounds(const Scalar& scalar, ScalarBounds<T>* out) {
+  using Bounds = NumericBounds<T>;
+
+#define SCALAR_BOUNDS_CASE(ArrowType, Widened)                                  \
+  case ArrowType::type_id:                                                      \
+    *out = Bounds::Of(static_cast<Widened>(                                     \
+        checked_cast<const typename TypeTraits<ArrowType>::ScalarType&>(scalar) \
+            .value));                                                           \
+    return Status::OK()
+
+  switch (scalar.type->id()) {
+    SCALAR_BOUNDS_CASE(UInt8Type, uint64_t);
+    SCALAR_BOUNDS_CASE(Int8Type, int64_t);
+    SCALAR_BOUNDS_CASE(UInt16Type, uint64_t);
+    SCALAR_BOUNDS_CASE(Int16Type, int64_t);
+    SCALAR_BOUNDS_CASE(UInt32Type, uint64_t);
+    SCALAR_BOUNDS_CASE(Int32Type, int64_t);
+    SCALAR_BOUNDS_CASE(UInt64Type, uint64_t);
+    SCALAR_BOUNDS_CASE(Int64Type, int64_t);
+    SCALAR_BOUNDS_CASE(FloatType, double);
+    SCALAR_BOUNDS_CASE(DoubleType, double);
+    default:
+      break;
+  }
+
+#undef SCALAR_BOUNDS_CASE
+
+  return Status::NotImplemented("Cannot cast scalar of type ", *scalar.type,
+                                " for comparison");
+}
+
+// Rewrite `array op scalar` as `array op value`, value being of the array type
+template <typename ArrowType>
+Status CastCompareScalar(const Scalar& scalar, CompareOperator* op,
+                         std::shared_ptr<Scalar>* out) {
+  using T = typename TypeTraits<ArrowType>::CType;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+  using Bounds = NumericBounds<T>;
+
+  if (!scalar.is_valid) {
+    return MakeNullScalar(TypeTraits<ArrowType>::type_singleton(), out);
+  }
+
+  ScalarBounds<T> bounds;
+  RETURN_NOT_OK(GetScalarBounds(scalar, &bounds));
+
+  T value = bounds.value;
+  if (!bounds.exact) {
+    switch (*op) {
+      case CompareOperator::EQUAL:
+        Bounds::Constant(false, op, &value);
+        break;
+      case CompareOperator::NOT_EQUAL:
+        Bounds::Constant(true, op, &value);
+        break;
+      case CompareOperator::LESS:
+      case CompareOperator::LESS_EQUAL:
+        if (bounds.has_lo) {
+          *op = CompareOperator::LESS_EQUAL;
+          value = bounds.lo;
+        } else {
+          Bounds::Constant(false, op, &value);
+        }
+        break;
+      case CompareOperator::GREATER:
+      case CompareOperator::GREATER_EQUAL:
+        if (bounds.has_hi) {
+          *op = CompareOperator::GREATER_EQUAL;
+          value = bounds.hi;
+        } else {
+          Bounds::Constant(false, op, &value);
+        }
+        break;
+    }
+  }
+  *out = std::make_shared<ScalarType>(value);
+  return Status::OK();
+}
+
+bool IsCastComparable(const DataType& type) {
+  return is_integer(type.id()) || type.id() == Type::FLOAT ||
+         type.id() == Type::DOUBLE;
+}
+
+}  // namespace
+
+Status UnifyCompareOperands(const Datum& left, const Datum& right,
+                            CompareOptions* options, Datum* left_out,
+                            Datum* right_out) {
+  *left_out = left;
+  *right_out = right;
+  auto left_type = left.type();
+  auto right_type = right.type();
+  if (left_type->Equals(right_type)) {
+    return Status::OK();
+  }
+
+  const bool scalar_left = left.kind() == Datum::SCALAR && right.kind() != Datum::SCALAR;
+  const bool scalar_right =
+      right.kind() == Datum::SCALAR && left.kind() != Datum::SCALAR;
+  if (!(scalar_left || scalar_right) || !IsCastComparable(*left_type) ||
+      !IsCastComparable(*right_type)) {
+    return Status::TypeError("Cannot compare data of differing type ", *left_type,
+                             " vs ", *right_type);
+  }
+
+  // Cast as in `array op scalar`, then restore the order of the operands
+  const Scalar& scalar = scalar_right ? *right.scalar() : *left.scalar();
+  const DataType& array_type = scalar_right ? *left_type : *right_type;
+  CompareOperator op = scalar_right ? options->op : MirrorCompareOperator(options->op);
+  std::shared_ptr<Scalar> cast;
+
+#define CAST_COMPARE_SCALAR_CASE(ArrowType)                          \
+  case ArrowType::type_id:                                           \
+    RETURN_NOT_OK(CastCompareScalar<ArrowType>(scalar, &op, &cast)); \
+    break
+
+  switch (array_type.id()) {
+    CAST_COMPARE_SCALAR_CASE(UInt8Type);
+    CAST_COMPARE_SCALAR_CASE(Int8Type);
+    CAST_COMPARE_SCALAR_CASE(UInt16Type);
+    CAST_COMPARE_SCALAR_CASE(Int16Type);
+    CAST_COMPARE_SCALAR_CASE(UInt32Type);
+    CAST_COMPARE_SCALAR_CASE(Int32Type);
+    CAST_COMPARE_SCALAR_CASE(UInt64Type);
+    CAST_COMPARE_SCALAR_CASE(Int64Type);
+    CAST_COMPARE_SCALAR_CASE(FloatType);
+    CAST_COMPARE_SCALAR_CASE(DoubleType);
+    default:
+      DCHECK(false);
+      break;
+  }
+
+#undef CAST_COMPARE_SCALAR_CASE
+
+  options->op = scalar_right ? op : MirrorCompareOperator(op);
+  *(scalar_right ? right_out : left_out) = Datum(cast);
+  return Status::OK();
+}
+
+// Compare the chunks of a ChunkedArray with an array-like or a scalar, the
+// chunks are compared concurrently
+static Status CompareChunked(FunctionContext* ctx, BinaryKernel* kernel,
+                             const Datum& left, const Datum& right, Datum* out) {
+  if (left.kind() != Datum::SCALAR && right.kind() != Datum::SCALAR) {
+    std::vector<Datum> outputs;
+    RETURN_NOT_OK(detail::InvokeBinaryArrayKernel(ctx, kernel, left, right, &outputs));
+    std::vector<std::shared_ptr<Array>> chunks;
+    for (const Datum& output : outputs) {
+      chunks.push_back(output.make_array());
+    }
+    *out = std::make_shared<ChunkedArray>(chunks, boolean());
+    return Status::OK();
+  }
+
+  const bool chunked_left = left.kind() == Datum::CHUNKED_ARRAY;
+  const ChunkedArray& chunked =
+      chunked_left ? *left.chunked_array() : *right.chunked_array();
+  std::vector<std::shared_ptr<Array>> chunks(chunked.num_chunks());
+  auto compare_chunk = [&](FunctionContext* chunk_ctx, int i) {
+    Datum chunk_out;
+    chunk_out.value = ArrayData::Make(kernel->out_type(), chunked.chunk(i)->length());
+    Datum chunk(chunked.chunk(i));
+    RETURN_NOT_OK(chunked_left ? kernel->Call(chunk_ctx, chunk, right, &chunk_out)
+                               : kernel->Call(chunk_ctx, left, chunk, &chunk_out));
+    chunks[i] = chunk_out.make_array();
+    return Status::OK();
+  };
+  RETURN_NOT_OK(detail::ParallelForChunks(ctx, chunked.num_chunks(), chunked.length(),
+                                          compare_chunk));
+  *out = std::make_shared<ChunkedArray>(chunks, boolean());
+  return Status::OK();
+}
+
 ARROW_EXPORT
 Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
                struct CompareOptions options, Datum* out) {
   DCHECK(out);
 
-  auto type = left.type();
-  if (!type->Equals(right.type())) {
-    return Status::TypeError("Cannot compare data of differing type ", *type, " vs ",
-                             *right.type());
-  }
-  // Requires that both types are equal.
+  // Only a scalar operand is cast, arrays are compared as they are
+  Datum cast_left, cast_right;
+  RETURN_NOT_OK(UnifyCompareOperands(left, right, &options, &cast_left, &cast_right));
+  auto type = cast_left.type();
   auto fn = MakeCompareFunction(context, *type, options);
   if (fn == nullptr) {
     return Status::NotImplemented("Compare not implemented for type ", type->ToString());
@@ -257,10 +623,14 @@ Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
   CompareBinaryKernel filter_kernel(fn);
   detail::PrimitiveAllocatingBinaryKernel kernel(&filter_kernel);
 
+  if (left.kind() == Datum::CHUNKED_ARRAY || right.kind() == Datum::CHUNKED_ARRAY) {
+    return CompareChunked(context, &kernel, cast_left, cast_right, out);
+  }
+
   const int64_t length = CompareBinaryKernel::out_length(left, right);
   out->value = ArrayData::Make(filter_kernel.out_type(), length);
 
-  return kernel.Call(context, left, right, out);
+  return kernel.Call(context, cast_left, cast_right, out);
 }
 
 }  // namespace compute
@@ -90,6 +90,8 @@ class ARROW_EXPORT CompareBinaryKernel : public BinaryKernel {
 
   std::shared_ptr<DataType> out_type() const override;
 
+  bool is_thread_safe() const override { return true; }
+
  private:
   std::shared_ptr<CompareFunction> compare_function_;
 };
@@ -142,6 +144,33 @@ struct CompareOptions {
   enum CompareOperator op;
 };
 
+/// \brief The operator of the same comparison with its operands swapped
+///
+/// e.g. `a < b` is `b > a`.
+ARROW_EXPORT
+CompareOperator MirrorCompareOperator(CompareOperator op);
+
+/// \brief Give both operands of a comparison the same type without casting arrays
+///
+/// When an array-like is compared with a scalar of another numeric type, only
+/// the scalar is cast to the type of the array-like, and the operator adjusted
+/// so that the comparison is unchanged, e.g. an int32 array `< 2.5` becomes
+/// `<= 2`. A scalar out of the range of the array type gives a comparison
+/// with the same result for all valid values, which is rewritten as such, e.g.
+/// an int8 array `== 300` becomes `< -128`.
+///
+/// \param[in] left the left operand
+/// \param[in] right the right operand
+/// \param[in,out] options the comparison options, whose operator may be changed
+/// \param[out] left_out the left operand, cast if it was a scalar
+/// \param[out] right_out the right operand, cast if it was a scalar
+///
+/// Operands of the same type are output unchanged, other combinations of
+/// differing types are a TypeError.
+ARROW_EXPORT
+Status UnifyCompareOperands(const Datum& left, const Datum& right,
+                            CompareOptions* options, Datum* left_out, Datum* right_out);
+
 /// \brief Return a Compare CompareFunction
 ///
 /// \param[in] context FunctionContext passing context information
@@ -157,10 +186,14 @@ std::shared_ptr<CompareFunction> MakeCompareFunction(FunctionContext* context,
 
 /// \brief Compare a numeric array with a scalar.
 ///
+/// If either side is a ChunkedArray the output is a ChunkedArray, whose chunks
+/// are compared concurrently when context->use_threads() is true.
+///
 /// \param[in] context the FunctionContext
-/// \param[in] left datum to compare, must be an Array
-/// \param[in] right datum to compare, must be a Scalar of the same type than
-///            left Datum.
+/// \param[in] left datum to compare, an Array or a ChunkedArray
+/// \param[in] right datum to compare, an Array, a ChunkedArray or a Scalar of the
+///            same type than left Datum. Either side may also be a Scalar of
+///            another numeric type, see UnifyCompareOperands.
 /// \param[in] options compare options
 /// \param[out] out resulting datum
 ///
@@ -16,6 +16,8 @@
 // under the License.
 
 #include <algorithm>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -28,6 +30,7 @@
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/compare.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
@@ -387,5 +390,139 @@ TYPED_TEST(TestNumericCompareKernel, RandomCompareArrayArray) {
   }
 }
 
+TYPED_TEST(TestNumericCompareKernel, CompareChunked) {
+  auto rand = random::RandomArrayGenerator(0x2d4f1a);
+  // Large enough for the chunks to be compared concurrently
+  const int num_chunks = 8;
+  const int64_t chunk_length = 10000;
+  ArrayVector left_chunks, right_chunks, expected_chunks, expected_scalar_chunks;
+  auto scalar = std::make_shared<typename TypeTraits<TypeParam>::ScalarType>(
+      static_cast<typename TypeParam::c_type>(50));
+  CompareOptions options(GREATER_EQUAL);
+  for (int i = 0; i < num_chunks; i++) {
+    left_chunks.push_back(rand.Numeric<TypeParam>(chunk_length, 0, 100, 0.1));
+    right_chunks.push_back(rand.Numeric<TypeParam>(chunk_length, 0, 100, 0.1));
+    Datum expected;
+    ASSERT_OK(Compare(&this->ctx_, left_chunks[i], right_chunks[i], options, &expected));
+    expected_chunks.push_back(expected.make_array());
+    ASSERT_OK(Compare(&this->ctx_, left_chunks[i], Datum(scalar), options, &expected));
+    expected_scalar_chunks.push_back(expected.make_array());
+  }
+  auto left = std::make_shared<ChunkedArray>(left_chunks);
+  auto right = std::make_shared<ChunkedArray>(right_chunks);
+
+  for (bool use_threads : {true, false}) {
+    this->ctx_.set_use_threads(use_threads);
+    Datum out;
+    ASSERT_OK(Compare(&this->ctx_, left, right, options, &out));
+    ASSERT_EQ(out.kind(), Datum::CHUNKED_ARRAY);
+    ASSERT_TRUE(out.chunked_array()->Equals(ChunkedArray(expected_chunks)));
+
+    ASSERT_OK(Compare(&this->ctx_, left, Datum(scalar), options, &out));
+    ASSERT_EQ(out.kind(), Datum::CHUNKED_ARRAY);
+    ASSERT_TRUE(out.chunked_array()->Equals(ChunkedArray(expected_scalar_chunks)));
+  }
+}
+
+class TestCompareDifferingTypes : public ComputeFixture, public TestBase {};
+
+TEST_F(TestCompareDifferingTypes, IntegerArray) {
+  CompareOptions eq(EQUAL), neq(NOT_EQUAL), gt(GREATER), gte(GREATER_EQUAL), lt(LESS);
+  const char* values = "[0, 1, 2, 3, null]";
+
+  Datum two(std::make_shared<Int64Scalar>(2));
+  ValidateCompare<Int32Type>(&ctx_, gt, values, two, "[0, 0, 0, 1, null]");
+  ValidateCompare<Int32Type>(&ctx_, eq, values, two, "[0, 0, 1, 0, null]");
+
+  // Fractional scalars fall between two values
+  Datum fraction(std::make_shared<DoubleScalar>(1.5));
+  ValidateCompare<Int32Type>(&ctx_, lt, values, fraction, "[1, 1, 0, 0, null]");
+  ValidateCompare<Int32Type>(&ctx_, gte, values, fraction, "[0, 0, 1, 1, null]");
+  ValidateCompare<Int32Type>(&ctx_, eq, values, fraction, "[0, 0, 0, 0, null]");
+  ValidateCompare<Int32Type>(&ctx_, neq, values, fraction, "[1, 1, 1, 1, null]");
+
+  // Scalars out of the range of the array type
+  Datum huge(std::make_shared<Int64Scalar>(int64_t(1) << 40));
+  ValidateCompare<Int32Type>(&ctx_, lt, values, huge, "[1, 1, 1, 1, null]");
+  ValidateCompare<Int32Type>(&ctx_, eq, values, huge, "[0, 0, 0, 0, null]");
+  ValidateCompare<Int32Type>(&ctx_, gt, values, huge, "[0, 0, 0, 0, null]");
+  Datum tiny(std::make_shared<Int64Scalar>(-(int64_t(1) << 40)));
+  ValidateCompare<Int32Type>(&ctx_, gt, values, tiny, "[1, 1, 1, 1, null]");
+  Datum negative(std::make_shared<Int32Scalar>(-1));
+  ValidateCompare<UInt8Type>(&ctx_, gt, "[0, 200, 255, null]", negative,
+                             "[1, 1, 1, null]");
+  Datum above_max(std::make_shared<DoubleScalar>(255.5));
+  ValidateCompare<UInt8Type>(&ctx_, lt, "[0, 200, 255, null]", above_max,
+                             "[1, 1, 1, null]");
+  ValidateCompare<UInt8Type>(&ctx_, gt, "[0, 200, 255, null]", above_max,
+                             "[0, 0, 0, null]");
+
+  Datum nan(std::make_shared<DoubleScalar>(std::numeric_limits<double>::quiet_NaN()));
+  ValidateCompare<Int32Type>(&ctx_, neq, values, nan, "[1, 1, 1, 1, null]");
+  ValidateCompare<Int32Type>(&ctx_, lt, values, nan, "[0, 0, 0, 0, null]");
+
+  Datum null(std::make_shared<Int64Scalar>(0, false));
+  ValidateCompare<Int32Type>(&ctx_, eq, values, null, "[null, null, null, null, null]");
+}
+
+TEST_F(TestCompareDifferingTypes, FloatingArray) {
+  CompareOptions eq(EQUAL), gt(GREATER), lte(LESS_EQUAL), lt(LESS);
+
+  // 0.1 isn't a float, the nearest float is greater
+  Datum tenth(std::make_shared<DoubleScalar>(0.1));
+  ValidateCompare<FloatType>(&ctx_, eq, "[0.1, 0.5, 1, null]", tenth, "[0, 0, 0, null]");
+  ValidateCompare<FloatType>(&ctx_, gt, "[0.1, 0.5, 1, null]", tenth, "[1, 1, 1, null]");
+  ValidateCompare<FloatType>(&ctx_, lte, "[0.1, 0.5, 1, null]", tenth,
+                             "[0, 0, 0, null]");
+  Datum half(std::make_shared<DoubleScalar>(0.5));
+  ValidateCompare<FloatType>(&ctx_, eq, "[0.1, 0.5, 1, null]", half, "[0, 1, 0, null]");
+  Datum huge(std::make_shared<DoubleScalar>(1e300));
+  ValidateCompare<FloatType>(&ctx_, lt, "[0.1, 0.5, 1, null]", huge, "[1, 1, 1, null]");
+
+  // Integers which aren't exactly representable
+  Datum odd(std::make_shared<Int64Scalar>((int64_t(1) << 24) + 1));
+  ValidateCompare<FloatType>(&ctx_, lt, "[16777216, 16777218]", odd, "[1, 0]");
+  ValidateCompare<FloatType>(&ctx_, eq, "[16777216, 16777218]", odd, "[0, 0]");
+  odd = Datum(std::make_shared<Int64Scalar>((int64_t(1) << 53) + 1));
+  ValidateCompare<DoubleType>(&ctx_, lt, "[9007199254740992, 9007199254740994]", odd,
+                              "[1, 0]");
+  ValidateCompare<DoubleType>(&ctx_, gt, "[9007199254740992, 9007199254740994]", odd,
+                              "[0, 1]");
+}
+
+TEST_F(TestCompareDifferingTypes, ScalarFirst) {
+  Datum fraction(std::make_shared<DoubleScalar>(1.5));
+  ValidateCompare<Int32Type>(&ctx_, CompareOptions(LESS), fraction, "[0, 1, 2, 3, null]",
+                             "[0, 0, 1, 1, null]");
+  ValidateCompare<Int32Type>(&ctx_, CompareOptions(GREATER_EQUAL), fraction,
+                             "[0, 1, 2, 3, null]", "[1, 1, 0, 0, null]");
+}
+
+TEST_F(TestCompareDifferingTypes, Chunked) {
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(int16(), "[0, 1, 2]"), ArrayFromJSON(int16(), "[3]")});
+  Datum fraction(std::make_shared<FloatScalar>(1.5f));
+  Datum out;
+  ASSERT_OK(Compare(&ctx_, chunked, fraction, CompareOptions(GREATER), &out));
+  ASSERT_EQ(out.kind(), Datum::CHUNKED_ARRAY);
+  ASSERT_TRUE(out.chunked_array()->Equals(
+      ChunkedArray({ArrayFromJSON(boolean(), "[false, false, true]"),
+                    ArrayFromJSON(boolean(), "[true]")})));
+}
+
+TEST_F(TestCompareDifferingTypes, Errors) {
+  auto values = ArrayFromJSON(int32(), "[0, 1]");
+  Datum out;
+  Datum string(std::make_shared<StringScalar>(Buffer::FromString("0")));
+  ASSERT_RAISES(TypeError, Compare(&ctx_, values, string, CompareOptions(EQUAL), &out));
+  // Only scalars are cast
+  ASSERT_RAISES(TypeError, Compare(&ctx_, values, ArrayFromJSON(int64(), "[0, 1]"),
+                                   CompareOptions(EQUAL), &out));
+  Datum timestamp(
+      std::make_shared<TimestampScalar>(0, ::arrow::timestamp(TimeUnit::SECOND)));
+  ASSERT_RAISES(TypeError,
+                Compare(&ctx_, values, timestamp, CompareOptions(EQUAL), &out));
+}
+
 }  // namespace compute
 }  // namespace arrow
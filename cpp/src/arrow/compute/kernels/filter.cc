@@ -20,9 +20,12 @@
 #include <limits>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "arrow/builder.h"
 #include "arrow/compute/kernels/take_internal.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/table.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 
@@ -78,41 +81,58 @@ static int64_t OutputSize(const BooleanArray& filter) {
 
 class FilterKernelImpl : public FilterKernel {
  public:
-  FilterKernelImpl(const std::shared_ptr<DataType>& type,
-                   std::unique_ptr<Taker<FilterIndexSequence>> taker)
-      : FilterKernel(type), taker_(std::move(taker)) {}
+  explicit FilterKernelImpl(const std::shared_ptr<DataType>& type)
+      : FilterKernel(type) {}
 
   Status Filter(FunctionContext* ctx, const Array& values, const BooleanArray& filter,
                 int64_t length, std::shared_ptr<Array>* out) override {
     if (values.length() != filter.length()) {
       return Status::Invalid("filter and value array must have identical lengths");
     }
-    RETURN_NOT_OK(taker_->SetContext(ctx));
-    RETURN_NOT_OK(taker_->Take(values, FilterIndexSequence(filter, length)));
-    return taker_->Finish(out);
+    // A Taker holds builders, so each call gets its own to keep the kernel
+    // thread-safe
+    std::unique_ptr<Taker<FilterIndexSequence>> taker;
+    RETURN_NOT_OK(Taker<FilterIndexSequence>::Make(type_, &taker));
+    RETURN_NOT_OK(taker->SetContext(ctx));
+    RETURN_NOT_OK(taker->Take(values, FilterIndexSequence(filter, length)));
+    return taker->Finish(out);
   }
-
-  std::unique_ptr<Taker<FilterIndexSequence>> taker_;
 };
 
 Status FilterKernel::Make(const std::shared_ptr<DataType>& value_type,
                           std::unique_ptr<FilterKernel>* out) {
+  // Check that the value type is supported
   std::unique_ptr<Taker<FilterIndexSequence>> taker;
   RETURN_NOT_OK(Taker<FilterIndexSequence>::Make(value_type, &taker));
 
-  out->reset(new FilterKernelImpl(value_type, std::move(taker)));
+  out->reset(new FilterKernelImpl(value_type));
   return Status::OK();
 }
 
 Status FilterKernel::Call(FunctionContext* ctx, const Datum& values, const Datum& filter,
                           Datum* out) {
-  if (!values.is_array() || !filter.is_array()) {
-    return Status::Invalid("FilterKernel expects array values and filter");
+  if (!values.is_arraylike() || !filter.is_arraylike()) {
+    return Status::Invalid("FilterKernel expects array-like values and filter");
   }
   auto filter_type = filter.type();
   if (filter_type->id() != Type::BOOL) {
     return Status::TypeError("filter array must be of boolean type, got ", *filter_type);
   }
+  if (!values.is_array() || !filter.is_array()) {
+    if (values.length() != filter.length()) {
+      return Status::Invalid("filter and value array must have identical lengths");
+    }
+    // Filter the aligned slices of values and filter, each of them is then an
+    // Array and handled below
+    std::vector<Datum> outputs;
+    RETURN_NOT_OK(detail::InvokeBinaryArrayKernel(ctx, this, values, filter, &outputs));
+    std::vector<std::shared_ptr<Array>> chunks;
+    for (const Datum& output : outputs) {
+      chunks.push_back(output.make_array());
+    }
+    *out = std::make_shared<ChunkedArray>(chunks, type_);
+    return Status::OK();
+  }
 
   auto values_array = values.make_array();
   auto filter_array = checked_pointer_cast<BooleanArray>(filter.make_array());
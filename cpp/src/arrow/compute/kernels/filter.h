@@ -51,6 +51,10 @@ Status Filter(FunctionContext* ctx, const Array& values, const Array& filter,
 
 /// \brief Filter an array with a boolean selection filter
 ///
+/// values and filter may be Arrays or ChunkedArrays of the same length. If
+/// either is a ChunkedArray the output is a ChunkedArray, whose chunks are
+/// filtered concurrently when ctx->use_threads() is true.
+///
 /// \param[in] ctx the FunctionContext
 /// \param[in] values datum to filter
 /// \param[in] filter indicates which values should be filtered out
@@ -72,6 +76,9 @@ class ARROW_EXPORT FilterKernel : public BinaryKernel {
   /// \brief output type of this kernel (identical to type of values filtered)
   std::shared_ptr<DataType> out_type() const override { return type_; }
 
+  /// \brief Filter() implementations may be called concurrently
+  bool is_thread_safe() const override { return true; }
+
   /// \brief factory for FilterKernels
   ///
   /// \param[in] value_type constructed FilterKernel will support filtering
@@ -20,11 +20,13 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/boolean.h"
 #include "arrow/compute/kernels/compare.h"
 #include "arrow/compute/kernels/filter.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -169,6 +171,40 @@ TYPED_TEST(TestFilterKernelWithNumeric, FilterRandomNumeric) {
   }
 }
 
+TYPED_TEST(TestFilterKernelWithNumeric, FilterChunkedNumeric) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  // Large enough for the chunks to be filtered concurrently, the chunks of
+  // values and filter don't have the same boundaries
+  ArrayVector value_chunks, filter_chunks;
+  for (int i = 0; i < 8; i++) {
+    value_chunks.push_back(rand.Numeric<TypeParam>(10000, 0, 127, 0.1));
+  }
+  for (int i = 0; i < 10; i++) {
+    filter_chunks.push_back(rand.Boolean(8000, 0.5, 0.1));
+  }
+  std::shared_ptr<Array> values, filter, expected;
+  ASSERT_OK(Concatenate(value_chunks, default_memory_pool(), &values));
+  ASSERT_OK(Concatenate(filter_chunks, default_memory_pool(), &filter));
+  ASSERT_OK(arrow::compute::Filter(&this->ctx_, *values, *filter, &expected));
+
+  auto chunked_values = std::make_shared<ChunkedArray>(value_chunks);
+  auto chunked_filter = std::make_shared<ChunkedArray>(filter_chunks);
+  for (bool use_threads : {true, false}) {
+    this->ctx_.set_use_threads(use_threads);
+    Datum out;
+    ASSERT_OK(arrow::compute::Filter(&this->ctx_, chunked_values, chunked_filter, &out));
+    ASSERT_EQ(out.kind(), Datum::CHUNKED_ARRAY);
+    ASSERT_TRUE(out.chunked_array()->Equals(ChunkedArray({expected})));
+
+    ASSERT_OK(arrow::compute::Filter(&this->ctx_, chunked_values, filter, &out));
+    ASSERT_TRUE(out.chunked_array()->Equals(ChunkedArray({expected})));
+  }
+
+  Datum out;
+  ASSERT_RAISES(Invalid, arrow::compute::Filter(&this->ctx_, chunked_values,
+                                                filter->Slice(1), &out));
+}
+
 template <typename CType>
 decltype(Comparator<CType, EQUAL>::Compare)* GetComparator(CompareOperator op) {
   using cmp_t = decltype(Comparator<CType, EQUAL>::Compare);
@@ -0,0 +1,623 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/group_by.h"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+#include "arrow/array.h"
+#include "arrow/array/dict_internal.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/sum_internal.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::BitmapReader;
+
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Key encoding
+
+// Maps the values of a key column to dense ids. Null is given an id like any
+// other value.
+class GroupKeyEncoder {
+ public:
+  virtual ~GroupKeyEncoder() = default;
+
+  // Write the id of every value of the input to ids
+  virtual Status Encode(const ArrayData& input, int32_t* ids) = 0;
+
+  // The distinct values seen so far, in id order
+  virtual Status GetDictionary(std::shared_ptr<ArrayData>* out) const = 0;
+};
+
+template <typename Type>
+class GroupKeyEncoderImpl : public GroupKeyEncoder {
+ public:
+  GroupKeyEncoderImpl(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : type_(type), pool_(pool), memo_table_(pool, 0) {}
+
+  Status Encode(const ArrayData& input, int32_t* ids) override {
+    out_ids_ = ids;
+    // Make sure the visitor doesn't see an unknown null count
+    input.GetNullCount();
+    return ArrayDataVisitor<Type>::Visit(input, this);
+  }
+
+  Status GetDictionary(std::shared_ptr<ArrayData>* out) const override {
+    return internal::DictionaryTraits<Type>::GetDictionaryArrayData(
+        pool_, type_, memo_table_, 0 /* start_offset */, out);
+  }
+
+  Status VisitNull() {
+    *out_ids_++ = memo_table_.GetOrInsertNull();
+    return Status::OK();
+  }
+
+  template <typename Scalar>
+  Status VisitValue(const Scalar& value) {
+    *out_ids_++ = memo_table_.GetOrInsert(value);
+    return Status::OK();
+  }
+
+ private:
+  using MemoTable = typename internal::DictionaryTraits<Type>::MemoTableType;
+
+  std::shared_ptr<DataType> type_;
+  MemoryPool* pool_;
+  MemoTable memo_table_;
+  int32_t* out_ids_;
+};
+
+struct GroupKeyEncoderFactory {
+  template <typename T>
+  enable_if_memoize<T, Status> Visit(const T&) {
+    out->reset(new GroupKeyEncoderImpl<T>(type, pool));
+    return Status::OK();
+  }
+
+  Status Visit(const DataType&) {
+    return Status::NotImplemented("Grouping by keys of type ", type->ToString());
+  }
+
+  std::shared_ptr<DataType> type;
+  MemoryPool* pool;
+  std::unique_ptr<GroupKeyEncoder>* out;
+};
+
+// ----------------------------------------------------------------------
+// Aggregates
+
+// AggregateFunction counterpart keeping one state per group
+class GroupedAggregateFunction {
+ public:
+  virtual ~GroupedAggregateFunction() = default;
+
+  // Grow the states to num_groups groups
+  virtual void Resize(int64_t num_groups) = 0;
+
+  // Add value i of the input to the state of group group_ids[i]
+  virtual Status Consume(const ArrayData& input, const int32_t* group_ids) = 0;
+
+  // Merge the state of group i of other into the state of group group_ids[i]
+  virtual Status Merge(const GroupedAggregateFunction& other,
+                       const int32_t* group_ids) = 0;
+
+  virtual Status Finalize(MemoryPool* pool, std::shared_ptr<Array>* out) const = 0;
+
+  virtual std::shared_ptr<DataType> out_type() const = 0;
+};
+
+// Call visit(i) for every non-null value i of the input
+template <typename Visit>
+void VisitValidIndices(const ArrayData& input, Visit&& visit) {
+  if (input.GetNullCount() == 0) {
+    for (int64_t i = 0; i < input.length; i++) {
+      visit(i);
+    }
+    return;
+  }
+  BitmapReader reader(input.buffers[0]->data(), input.offset, input.length);
+  for (int64_t i = 0; i < input.length; i++) {
+    if (reader.IsSet()) {
+      visit(i);
+    }
+    reader.Next();
+  }
+}
+
+template <typename ArrowType, typename CType>
+Status MakeAggregateArray(MemoryPool* pool, const std::shared_ptr<DataType>& type,
+                          const std::vector<CType>& values,
+                          const std::vector<uint8_t>& valid_bytes,
+                          std::shared_ptr<Array>* out) {
+  NumericBuilder<ArrowType> builder(type, pool);
+  RETURN_NOT_OK(builder.AppendValues(values.data(), static_cast<int64_t>(values.size()),
+                                     valid_bytes.data()));
+  return builder.Finish(out);
+}
+
+class GroupedCount final : public GroupedAggregateFunction {
+ public:
+  void Resize(int64_t num_groups) override { counts_.resize(num_groups, 0); }
+
+  Status Consume(const ArrayData& input, const int32_t* group_ids) override {
+    VisitValidIndices(input, [&](int64_t i) { counts_[group_ids[i]]++; });
+    return Status::OK();
+  }
+
+  Status Merge(const GroupedAggregateFunction& other,
+               const int32_t* group_ids) override {
+    const auto& other_counts = static_cast<const GroupedCount&>(other).counts_;
+    for (size_t i = 0; i < other_counts.size(); i++) {
+      counts_[group_ids[i]] += other_counts[i];
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(MemoryPool* pool, std::shared_ptr<Array>* out) const override {
+    std::vector<uint8_t> valid_bytes(counts_.size(), 1);
+    return MakeAggregateArray<Int64Type>(pool, int64(), counts_, valid_bytes, out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int64(); }
+
+ private:
+  std::vector<int64_t> counts_;
+};
+
+// Sum and mean
+template <typename ArrowType, typename SumType>
+class GroupedSum final : public GroupedAggregateFunction {
+ public:
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using SumCType = typename TypeTraits<SumType>::CType;
+
+  explicit GroupedSum(bool mean) : mean_(mean) {}
+
+  void Resize(int64_t num_groups) override {
+    sums_.resize(num_groups, 0);
+    counts_.resize(num_groups, 0);
+  }
+
+  Status Consume(const ArrayData& input, const int32_t* group_ids) override {
+    const CType* values = input.GetValues<CType>(1);
+    VisitValidIndices(input, [&](int64_t i) {
+      sums_[group_ids[i]] += values[i];
+      counts_[group_ids[i]]++;
+    });
+    return Status::OK();
+  }
+
+  Status Merge(const GroupedAggregateFunction& other,
+               const int32_t* group_ids) override {
+    const auto& other_sum = static_cast<const GroupedSum&>(other);
+    for (size_t i = 0; i < other_sum.sums_.size(); i++) {
+      sums_[group_ids[i]] += other_sum.sums_[i];
+      counts_[group_ids[i]] += other_sum.counts_[i];
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(MemoryPool* pool, std::shared_ptr<Array>* out) const override {
+    std::vector<uint8_t> valid_bytes(counts_.size());
+    for (size_t i = 0; i < counts_.size(); i++) {
+      valid_bytes[i] = counts_[i] > 0;
+    }
+    if (!mean_) {
+      return MakeAggregateArray<SumType>(pool, out_type(), sums_, valid_bytes, out);
+    }
+    std::vector<double> means(sums_.size());
+    for (size_t i = 0; i < sums_.size(); i++) {
+      means[i] = counts_[i] > 0 ? static_cast<double>(sums_[i]) / counts_[i] : 0;
+    }
+    return MakeAggregateArray<DoubleType>(pool, out_type(), means, valid_bytes, out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return mean_ ? float64() : TypeTraits<SumType>::type_singleton();
+  }
+
+ private:
+  bool mean_;
+  std::vector<SumCType> sums_;
+  std::vector<int64_t> counts_;
+};
+
+// Min and max
+template <typename ArrowType>
+class GroupedMinMax final : public GroupedAggregateFunction {
+ public:
+  using CType = typename TypeTraits<ArrowType>::CType;
+
+  GroupedMinMax(const std::shared_ptr<DataType>& type, bool max)
+      : type_(type), max_(max) {}
+
+  void Resize(int64_t num_groups) override {
+    values_.resize(num_groups, 0);
+    has_values_.resize(num_groups, 0);
+  }
+
+  Status Consume(const ArrayData& input, const int32_t* group_ids) override {
+    const CType* values = input.GetValues<CType>(1);
+    VisitValidIndices(input, [&](int64_t i) { Update(group_ids[i], values[i]); });
+    return Status::OK();
+  }
+
+  Status Merge(const GroupedAggregateFunction& other,
+               const int32_t* group_ids) override {
+    const auto& other_min_max = static_cast<const GroupedMinMax&>(other);
+    for (size_t i = 0; i < other_min_max.values_.size(); i++) {
+      if (other_min_max.has_values_[i]) {
+        Update(group_ids[i], other_min_max.values_[i]);
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(MemoryPool* pool, std::shared_ptr<Array>* out) const override {
+    return MakeAggregateArray<ArrowType>(pool, type_, values_, has_values_, out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return type_; }
+
+ private:
+  void Update(int32_t group, CType value) {
+    if (!has_values_[group] ||
+        (max_ ? value > values_[group] : value < values_[group])) {
+      values_[group] = value;
+      has_values_[group] = 1;
+    }
+  }
+
+  std::shared_ptr<DataType> type_;
+  bool max_;
+  std::vector<CType> values_;
+  std::vector<uint8_t> has_values_;
+};
+
+struct GroupedAggregateFactory {
+  template <typename T>
+  enable_if_number<T, Status> Visit(const T&) {
+    using SumType = typename FindAccumulatorType<T>::Type;
+    switch (kind) {
+      case GroupByAggregate::SUM:
+        out->reset(new GroupedSum<T, SumType>(/*mean=*/false));
+        break;
+      case GroupByAggregate::MEAN:
+        out->reset(new GroupedSum<T, SumType>(/*mean=*/true));
+        break;
+      case GroupByAggregate::MIN:
+        out->reset(new GroupedMinMax<T>(type, /*max=*/false));
+        break;
+      case GroupByAggregate::MAX:
+        out->reset(new GroupedMinMax<T>(type, /*max=*/true));
+        break;
+      default:
+        return Status::Invalid("Unknown aggregate ", static_cast<int>(kind));
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const HalfFloatType&) { return NotImplemented(); }
+
+  Status Visit(const DataType&) { return NotImplemented(); }
+
+  Status NotImplemented() {
+    return Status::NotImplemented("Aggregating values of type ", type->ToString());
+  }
+
+  GroupByAggregate::Kind kind;
+  std::shared_ptr<DataType> type;
+  std::unique_ptr<GroupedAggregateFunction>* out;
+};
+
+Status MakeGroupedAggregateFunction(GroupByAggregate::Kind kind,
+                                    const std::shared_ptr<DataType>& type,
+                                    std::unique_ptr<GroupedAggregateFunction>* out) {
+  if (kind == GroupByAggregate::COUNT) {
+    out->reset(new GroupedCount());
+    return Status::OK();
+  }
+  GroupedAggregateFactory factory{kind, type, out};
+  return VisitTypeInline(*type, &factory);
+}
+
+const char* AggregateName(GroupByAggregate::Kind kind) {
+  switch (kind) {
+    case GroupByAggregate::SUM:
+      return "sum";
+    case GroupByAggregate::COUNT:
+      return "count";
+    case GroupByAggregate::MEAN:
+      return "mean";
+    case GroupByAggregate::MIN:
+      return "min";
+    case GroupByAggregate::MAX:
+      return "max";
+  }
+  return "unknown";
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// HashAggregator
+
+class HashAggregator::Impl {
+ public:
+  Impl(FunctionContext* ctx, std::shared_ptr<Schema> schema, std::vector<int> keys,
+       std::vector<GroupByAggregate> aggregates)
+      : ctx_(ctx),
+        schema_(std::move(schema)),
+        keys_(std::move(keys)),
+        aggregates_(std::move(aggregates)),
+        num_groups_(0) {}
+
+  Status Init() {
+    if (keys_.empty()) {
+      return Status::Invalid("GroupBy requires at least one key column");
+    }
+    for (int key : keys_) {
+      RETURN_NOT_OK(CheckColumn(key));
+      std::unique_ptr<GroupKeyEncoder> encoder;
+      GroupKeyEncoderFactory factory{schema_->field(key)->type(), ctx_->memory_pool(),
+                                     &encoder};
+      RETURN_NOT_OK(VisitTypeInline(*schema_->field(key)->type(), &factory));
+      encoders_.push_back(std::move(encoder));
+      group_key_ids_.emplace_back();
+    }
+    // The ids of the keys are combined pairwise, from left to right
+    for (size_t i = 1; i < keys_.size(); i++) {
+      combiners_.emplace_back(
+          new internal::ScalarMemoTable<uint64_t>(ctx_->memory_pool()));
+    }
+    for (const auto& aggregate : aggregates_) {
+      RETURN_NOT_OK(CheckColumn(aggregate.column));
+      std::unique_ptr<GroupedAggregateFunction> function;
+      RETURN_NOT_OK(MakeGroupedAggregateFunction(
+          aggregate.kind, schema_->field(aggregate.column)->type(), &function));
+      functions_.push_back(std::move(function));
+    }
+    return Status::OK();
+  }
+
+  Status Consume(const RecordBatch& batch) {
+    if (!batch.schema()->Equals(*schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("Batch schema does not match the aggregator's: ",
+                             batch.schema()->ToString());
+    }
+    std::vector<std::shared_ptr<ArrayData>> keys;
+    for (int key : keys_) {
+      keys.push_back(batch.column_data(key));
+    }
+    RETURN_NOT_OK(ComputeGroupIds(keys, batch.num_rows(), &group_ids_));
+    for (size_t i = 0; i < aggregates_.size(); i++) {
+      RETURN_NOT_OK(functions_[i]->Consume(*batch.column_data(aggregates_[i].column),
+                                           group_ids_.data()));
+    }
+    return Status::OK();
+  }
+
+  Status Merge(const Impl& other) {
+    if (!other.schema_->Equals(*schema_, /*check_metadata=*/false) ||
+        other.keys_ != keys_ || other.aggregates_.size() != aggregates_.size()) {
+      return Status::Invalid("Cannot merge aggregators with different parameters");
+    }
+    for (size_t i = 0; i < aggregates_.size(); i++) {
+      if (other.aggregates_[i].kind != aggregates_[i].kind ||
+          other.aggregates_[i].column != aggregates_[i].column) {
+        return Status::Invalid("Cannot merge aggregators with different parameters");
+      }
+    }
+
+    // Map the groups of the other aggregator by looking up its keys
+    std::vector<std::shared_ptr<Array>> other_keys;
+    RETURN_NOT_OK(other.GetKeys(ctx_, &other_keys));
+    std::vector<std::shared_ptr<ArrayData>> keys;
+    for (const auto& key : other_keys) {
+      keys.push_back(key->data());
+    }
+    std::vector<int32_t> group_ids;
+    RETURN_NOT_OK(ComputeGroupIds(keys, other.num_groups_, &group_ids));
+    for (size_t i = 0; i < aggregates_.size(); i++) {
+      RETURN_NOT_OK(functions_[i]->Merge(*other.functions_[i], group_ids.data()));
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(std::shared_ptr<RecordBatch>* out) const {
+    std::vector<std::shared_ptr<Array>> columns;
+    RETURN_NOT_OK(GetKeys(ctx_, &columns));
+    std::vector<std::shared_ptr<Field>> fields;
+    for (int key : keys_) {
+      fields.push_back(schema_->field(key));
+    }
+    for (size_t i = 0; i < aggregates_.size(); i++) {
+      std::shared_ptr<Array> column;
+      RETURN_NOT_OK(functions_[i]->Finalize(ctx_->memory_pool(), &column));
+      columns.push_back(column);
+      const auto& aggregated = schema_->field(aggregates_[i].column);
+      fields.push_back(field(std::string(AggregateName(aggregates_[i].kind)) + "(" +
+                                 aggregated->name() + ")",
+                             functions_[i]->out_type()));
+    }
+    *out = RecordBatch::Make(::arrow::schema(fields), num_groups_, columns);
+    return Status::OK();
+  }
+
+  int64_t num_groups() const { return num_groups_; }
+
+ private:
+  Status CheckColumn(int i) const {
+    if (i < 0 || i >= schema_->num_fields()) {
+      return Status::IndexError("Column index ", i, " out of bounds");
+    }
+    return Status::OK();
+  }
+
+  // Compute the group id of every row of the key columns, creating groups for
+  // the keys not seen yet
+  Status ComputeGroupIds(const std::vector<std::shared_ptr<ArrayData>>& keys,
+                         int64_t length, std::vector<int32_t>* group_ids) {
+    key_ids_.resize(keys.size());
+    for (size_t k = 0; k < keys.size(); k++) {
+      key_ids_[k].resize(length);
+      RETURN_NOT_OK(encoders_[k]->Encode(*keys[k], key_ids_[k].data()));
+    }
+
+    group_ids->resize(length);
+    for (int64_t i = 0; i < length; i++) {
+      int32_t group = key_ids_[0][i];
+      for (size_t k = 1; k < keys.size(); k++) {
+        const uint64_t pair = (static_cast<uint64_t>(group) << 32) |
+                              static_cast<uint32_t>(key_ids_[k][i]);
+        group = combiners_[k - 1]->GetOrInsert(pair);
+      }
+      if (group >= num_groups_) {
+        DCHECK_EQ(group, num_groups_);
+        for (size_t k = 0; k < keys.size(); k++) {
+          group_key_ids_[k].push_back(key_ids_[k][i]);
+        }
+        num_groups_++;
+      }
+      (*group_ids)[i] = group;
+    }
+
+    for (auto& function : functions_) {
+      function->Resize(num_groups_);
+    }
+    return Status::OK();
+  }
+
+  // The key columns, one value per group
+  Status GetKeys(FunctionContext* ctx, std::vector<std::shared_ptr<Array>>* out) const {
+    out->clear();
+    for (size_t k = 0; k < keys_.size(); k++) {
+      std::shared_ptr<ArrayData> dictionary;
+      RETURN_NOT_OK(encoders_[k]->GetDictionary(&dictionary));
+      Int32Builder builder(ctx->memory_pool());
+      RETURN_NOT_OK(builder.AppendValues(group_key_ids_[k]));
+      std::shared_ptr<Array> indices, key;
+      RETURN_NOT_OK(builder.Finish(&indices));
+      RETURN_NOT_OK(Take(ctx, *MakeArray(dictionary), *indices, TakeOptions(), &key));
+      out->push_back(key);
+    }
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  std::shared_ptr<Schema> schema_;
+  std::vector<int> keys_;
+  std::vector<GroupByAggregate> aggregates_;
+
+  std::vector<std::unique_ptr<GroupKeyEncoder>> encoders_;
+  std::vector<std::unique_ptr<internal::ScalarMemoTable<uint64_t>>> combiners_;
+  std::vector<std::unique_ptr<GroupedAggregateFunction>> functions_;
+
+  int32_t num_groups_;
+  // For every key column, the id of the key of every group
+  std::vector<std::vector<int32_t>> group_key_ids_;
+
+  // Scratch space
+  std::vector<std::vector<int32_t>> key_ids_;
+  std::vector<int32_t> group_ids_;
+};
+
+HashAggregator::HashAggregator(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+HashAggregator::~HashAggregator() {}
+
+Status HashAggregator::Make(FunctionContext* ctx, const std::shared_ptr<Schema>& schema,
+                            const std::vector<int>& keys,
+                            const std::vector<GroupByAggregate>& aggregates,
+                            std::unique_ptr<HashAggregator>* out) {
+  std::unique_ptr<Impl> impl(new Impl(ctx, schema, keys, aggregates));
+  RETURN_NOT_OK(impl->Init());
+  out->reset(new HashAggregator(std::move(impl)));
+  return Status::OK();
+}
+
+Status HashAggregator::Consume(const RecordBatch& batch) {
+  return impl_->Consume(batch);
+}
+
+Status HashAggregator::Merge(const HashAggregator& other) {
+  return impl_->Merge(*other.impl_);
+}
+
+Status HashAggregator::Finalize(std::shared_ptr<RecordBatch>* out) {
+  return impl_->Finalize(out);
+}
+
+int64_t HashAggregator::num_groups() const { return impl_->num_groups(); }
+
+// ----------------------------------------------------------------------
+// GroupBy
+
+Status GroupBy(FunctionContext* ctx, const Table& table, const std::vector<int>& keys,
+               const std::vector<GroupByAggregate>& aggregates,
+               std::shared_ptr<RecordBatch>* out) {
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  TableBatchReader reader(table);
+  RETURN_NOT_OK(reader.ReadAll(&batches));
+
+  const int capacity = ctx->use_threads() ? ctx->executor()->GetCapacity() : 1;
+  const int num_tasks =
+      std::max(1, std::min(capacity, static_cast<int>(batches.size())));
+
+  // Each task aggregates every num_tasks-th batch with its own context
+  std::vector<std::unique_ptr<FunctionContext>> contexts;
+  std::vector<std::unique_ptr<HashAggregator>> partials(num_tasks);
+  for (int i = 0; i < num_tasks; i++) {
+    contexts.emplace_back(new FunctionContext(ctx->memory_pool()));
+    RETURN_NOT_OK(HashAggregator::Make(contexts.back().get(), table.schema(), keys,
+                                       aggregates, &partials[i]));
+  }
+  RETURN_NOT_OK(detail::ParallelForChunks(
+      ctx, num_tasks, table.num_rows(), [&](FunctionContext*, int task) {
+        for (size_t i = task; i < batches.size(); i += num_tasks) {
+          RETURN_NOT_OK(partials[task]->Consume(*batches[i]));
+        }
+        return Status::OK();
+      }));
+
+  for (int i = 1; i < num_tasks; i++) {
+    RETURN_NOT_OK(partials[0]->Merge(*partials[i]));
+  }
+  return partials[0]->Finalize(out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,127 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class RecordBatch;
+class Schema;
+class Table;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief An aggregation computed for each group of a GroupBy
+struct ARROW_EXPORT GroupByAggregate {
+  enum Kind {
+    /// Sum of the non-null values, accumulated as int64, uint64 or double
+    SUM = 0,
+    /// Number of non-null values
+    COUNT,
+    /// Mean of the non-null values, as double
+    MEAN,
+    /// Smallest non-null value
+    MIN,
+    /// Largest non-null value
+    MAX,
+  };
+
+  GroupByAggregate(Kind kind, int column) : kind(kind), column(column) {}
+
+  Kind kind;
+  /// Index of the aggregated column in the input
+  int column;
+};
+
+/// \brief Hash aggregation of record batches grouped by key columns
+///
+/// The values of the key columns are mapped to dense group ids with hash memo
+/// tables, and the state of every aggregate is kept per group. Any number of
+/// batches can be consumed. Aggregators which consumed different batches, e.g.
+/// on different threads, can be merged before being finalized.
+///
+/// Keys can be of any primitive, binary, string or fixed size binary type; a
+/// null key forms its own group. COUNT supports any value type, the other
+/// aggregates support integer and floating point values. Aggregates over
+/// groups without non-null values are null, except for COUNT.
+///
+/// This class is not thread-safe.
+class ARROW_EXPORT HashAggregator {
+ public:
+  ~HashAggregator();
+
+  /// \brief Create an aggregator
+  ///
+  /// \param[in] ctx the FunctionContext, which must outlive the aggregator
+  /// \param[in] schema the schema of the consumed batches
+  /// \param[in] keys indices of the key columns
+  /// \param[in] aggregates the aggregates to compute
+  /// \param[out] out the aggregator
+  static Status Make(FunctionContext* ctx, const std::shared_ptr<Schema>& schema,
+                     const std::vector<int>& keys,
+                     const std::vector<GroupByAggregate>& aggregates,
+                     std::unique_ptr<HashAggregator>* out);
+
+  /// \brief Aggregate a batch
+  Status Consume(const RecordBatch& batch);
+
+  /// \brief Merge the groups of another aggregator created with the same
+  /// parameters into this one
+  Status Merge(const HashAggregator& other);
+
+  /// \brief Produce a batch with one row per group, made of the key columns
+  /// followed by one column per aggregate, named like "sum(column)"
+  Status Finalize(std::shared_ptr<RecordBatch>* out);
+
+  /// \brief The number of groups seen so far
+  int64_t num_groups() const;
+
+ private:
+  class Impl;
+  explicit HashAggregator(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief Compute aggregates over the rows of a table grouped by key columns
+///
+/// The batches of the table are aggregated in parallel on the CPU thread pool,
+/// and the partial aggregates are merged. The order of the groups in the
+/// output is unspecified.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] table the input table
+/// \param[in] keys indices of the key columns
+/// \param[in] aggregates the aggregates to compute
+/// \param[out] out one row per group, see HashAggregator::Finalize
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GroupBy(FunctionContext* ctx, const Table& table, const std::vector<int>& keys,
+               const std::vector<GroupByAggregate>& aggregates,
+               std::shared_ptr<RecordBatch>* out);
+
+}  // namespace compute
+}  // namespace arrow
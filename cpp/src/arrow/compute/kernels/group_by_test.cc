@@ -0,0 +1,212 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernels/group_by.h"
+#include "arrow/compute/kernels/sort_to_indices.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+class TestHashAggregator : public ComputeFixture, public TestBase {
+ protected:
+  std::shared_ptr<RecordBatch> MakeBatch(const std::shared_ptr<Schema>& schema,
+                                         const std::vector<std::string>& columns) {
+    std::vector<std::shared_ptr<Array>> arrays;
+    for (int i = 0; i < schema->num_fields(); i++) {
+      arrays.push_back(ArrayFromJSON(schema->field(i)->type(), columns[i]));
+    }
+    return RecordBatch::Make(schema, arrays[0]->length(), arrays);
+  }
+
+  void AssertColumn(const RecordBatch& batch, int i,
+                    const std::shared_ptr<DataType>& type, const std::string& json) {
+    AssertArraysEqual(*ArrayFromJSON(type, json), *batch.column(i));
+  }
+
+  // Sort the rows of a batch by its first column, which must not have nulls
+  void SortByFirstColumn(std::shared_ptr<RecordBatch>* batch) {
+    std::shared_ptr<Array> indices;
+    ASSERT_OK(SortToIndices(&ctx_, *(*batch)->column(0), &indices));
+    std::vector<std::shared_ptr<Array>> columns;
+    for (int i = 0; i < (*batch)->num_columns(); i++) {
+      std::shared_ptr<Array> column;
+      ASSERT_OK(Take(&ctx_, *(*batch)->column(i), *indices, TakeOptions(), &column));
+      columns.push_back(column);
+    }
+    *batch = RecordBatch::Make((*batch)->schema(), (*batch)->num_rows(), columns);
+  }
+};
+
+TEST_F(TestHashAggregator, StringKey) {
+  auto schema = ::arrow::schema({field("key", utf8()), field("value", int32())});
+  std::unique_ptr<HashAggregator> aggregator;
+  ASSERT_OK(HashAggregator::Make(
+      &ctx_, schema, {0},
+      {{GroupByAggregate::SUM, 1},
+       {GroupByAggregate::COUNT, 1},
+       {GroupByAggregate::MEAN, 1},
+       {GroupByAggregate::MIN, 1},
+       {GroupByAggregate::MAX, 1}},
+      &aggregator));
+
+  ASSERT_OK(aggregator->Consume(*MakeBatch(
+      schema, {R"(["a", "b", null, "a", "c"])", "[1, 2, 3, null, null]"})));
+  ASSERT_OK(aggregator->Consume(
+      *MakeBatch(schema, {R"(["b", null, "a", "d"])", "[-5, 7, 4, 6]"})));
+  ASSERT_EQ(aggregator->num_groups(), 5);
+
+  std::shared_ptr<RecordBatch> out;
+  ASSERT_OK(aggregator->Finalize(&out));
+  ASSERT_OK(out->Validate());
+  ASSERT_EQ(out->schema()->ToString(),
+            ::arrow::schema({field("key", utf8()), field("sum(value)", int64()),
+                             field("count(value)", int64()),
+                             field("mean(value)", float64()),
+                             field("min(value)", int32()), field("max(value)", int32())})
+                ->ToString());
+
+  // Groups are in the order of their first appearance
+  AssertColumn(*out, 0, utf8(), R"(["a", "b", null, "c", "d"])");
+  AssertColumn(*out, 1, int64(), "[5, -3, 10, null, 6]");
+  AssertColumn(*out, 2, int64(), "[2, 2, 2, 0, 1]");
+  AssertColumn(*out, 3, float64(), "[2.5, -1.5, 5, null, 6]");
+  AssertColumn(*out, 4, int32(), "[1, -5, 3, null, 6]");
+  AssertColumn(*out, 5, int32(), "[4, 2, 7, null, 6]");
+}
+
+TEST_F(TestHashAggregator, MultipleKeys) {
+  auto schema = ::arrow::schema(
+      {field("k1", int64()), field("k2", boolean()), field("value", float64())});
+  std::unique_ptr<HashAggregator> aggregator;
+  ASSERT_OK(HashAggregator::Make(&ctx_, schema, {0, 1}, {{GroupByAggregate::SUM, 2}},
+                                 &aggregator));
+
+  ASSERT_OK(aggregator->Consume(*MakeBatch(
+      schema,
+      {"[1, 1, 2, 1, null, 2]", "[true, false, true, true, false, null]",
+       "[1.5, 2, 3, 4, 5, 6]"})));
+  ASSERT_EQ(aggregator->num_groups(), 5);
+
+  std::shared_ptr<RecordBatch> out;
+  ASSERT_OK(aggregator->Finalize(&out));
+  AssertColumn(*out, 0, int64(), "[1, 1, 2, null, 2]");
+  AssertColumn(*out, 1, boolean(), "[true, false, true, false, null]");
+  AssertColumn(*out, 2, float64(), "[5.5, 2, 3, 5, 6]");
+}
+
+TEST_F(TestHashAggregator, Merge) {
+  auto schema = ::arrow::schema({field("key", int16()), field("value", uint8())});
+  std::vector<GroupByAggregate> aggregates = {{GroupByAggregate::SUM, 1},
+                                              {GroupByAggregate::MAX, 1}};
+  std::unique_ptr<HashAggregator> left, right;
+  ASSERT_OK(HashAggregator::Make(&ctx_, schema, {0}, aggregates, &left));
+  ASSERT_OK(HashAggregator::Make(&ctx_, schema, {0}, aggregates, &right));
+
+  ASSERT_OK(left->Consume(*MakeBatch(schema, {"[1, 2, 1]", "[1, 2, 3]"})));
+  ASSERT_OK(right->Consume(*MakeBatch(schema, {"[3, null, 2]", "[4, 5, null]"})));
+  ASSERT_OK(left->Merge(*right));
+  ASSERT_EQ(left->num_groups(), 4);
+
+  std::shared_ptr<RecordBatch> out;
+  ASSERT_OK(left->Finalize(&out));
+  AssertColumn(*out, 0, int16(), "[1, 2, 3, null]");
+  AssertColumn(*out, 1, uint64(), "[4, 2, 4, 5]");
+  AssertColumn(*out, 2, uint8(), "[3, 2, 4, 5]");
+}
+
+TEST_F(TestHashAggregator, Errors) {
+  auto schema = ::arrow::schema({field("key", int32()), field("value", utf8())});
+  std::unique_ptr<HashAggregator> aggregator;
+  ASSERT_RAISES(Invalid, HashAggregator::Make(&ctx_, schema, {},
+                                              {{GroupByAggregate::COUNT, 1}},
+                                              &aggregator));
+  ASSERT_RAISES(IndexError, HashAggregator::Make(&ctx_, schema, {2},
+                                                 {{GroupByAggregate::COUNT, 1}},
+                                                 &aggregator));
+  ASSERT_RAISES(NotImplemented, HashAggregator::Make(&ctx_, schema, {0},
+                                                     {{GroupByAggregate::SUM, 1}},
+                                                     &aggregator));
+
+  ASSERT_OK(HashAggregator::Make(&ctx_, schema, {0}, {{GroupByAggregate::COUNT, 1}},
+                                 &aggregator));
+  auto other_schema = ::arrow::schema({field("key", int64()), field("value", utf8())});
+  ASSERT_RAISES(Invalid,
+                aggregator->Consume(*MakeBatch(other_schema, {"[1]", R"(["a"])"})));
+}
+
+TEST_F(TestHashAggregator, GroupByTable) {
+  auto schema = ::arrow::schema({field("key", int32()), field("value", int64())});
+  const int64_t num_batches = 16;
+  const int64_t batch_size = 100;
+  const int32_t num_keys = 7;
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  std::vector<int64_t> expected_sums(num_keys, 0), expected_counts(num_keys, 0);
+  for (int64_t b = 0; b < num_batches; b++) {
+    std::vector<int32_t> keys;
+    std::vector<int64_t> values;
+    for (int64_t i = 0; i < batch_size; i++) {
+      const int64_t row = b * batch_size + i;
+      keys.push_back(static_cast<int32_t>(row % num_keys));
+      values.push_back(row);
+      expected_sums[row % num_keys] += row;
+      expected_counts[row % num_keys]++;
+    }
+    std::shared_ptr<Array> key_array, value_array;
+    ArrayFromVector<Int32Type, int32_t>(keys, &key_array);
+    ArrayFromVector<Int64Type, int64_t>(values, &value_array);
+    batches.push_back(RecordBatch::Make(schema, batch_size, {key_array, value_array}));
+  }
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches(batches, &table));
+
+  std::shared_ptr<RecordBatch> out;
+  ASSERT_OK(GroupBy(&ctx_, *table, {0},
+                    {{GroupByAggregate::SUM, 1}, {GroupByAggregate::COUNT, 1}}, &out));
+  ASSERT_OK(out->Validate());
+  ASSERT_EQ(out->num_rows(), num_keys);
+  SortByFirstColumn(&out);
+
+  std::vector<int32_t> expected_keys;
+  for (int32_t k = 0; k < num_keys; k++) {
+    expected_keys.push_back(k);
+  }
+  std::shared_ptr<Array> expected;
+  ArrayFromVector<Int32Type, int32_t>(expected_keys, &expected);
+  AssertArraysEqual(*expected, *out->column(0));
+  ArrayFromVector<Int64Type, int64_t>(expected_sums, &expected);
+  AssertArraysEqual(*expected, *out->column(1));
+  ArrayFromVector<Int64Type, int64_t>(expected_counts, &expected);
+  AssertArraysEqual(*expected, *out->column(2));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,493 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/hash_join.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/array/dict_internal.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/hashing.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+using internal::kKeyNotFound;
+
+// ----------------------------------------------------------------------
+// Key encoding
+
+// Maps the values of a key column to dense ids, or kKeyNotFound for nulls.
+class JoinKeyEncoder {
+ public:
+  virtual ~JoinKeyEncoder() = default;
+
+  // Write the id of every value of the input to ids, adding the unknown values
+  virtual Status Insert(const ArrayData& input, int32_t* ids) = 0;
+
+  // Write the id of every value of the input to ids, or kKeyNotFound for the
+  // unknown values
+  virtual Status Lookup(const ArrayData& input, int32_t* ids) = 0;
+};
+
+template <typename Type>
+class JoinKeyEncoderImpl : public JoinKeyEncoder {
+ public:
+  explicit JoinKeyEncoderImpl(MemoryPool* pool) : memo_table_(pool, 0) {}
+
+  Status Insert(const ArrayData& input, int32_t* ids) override {
+    return Encode(input, ids, /*insert=*/true);
+  }
+
+  Status Lookup(const ArrayData& input, int32_t* ids) override {
+    return Encode(input, ids, /*insert=*/false);
+  }
+
+  Status VisitNull() {
+    *out_ids_++ = kKeyNotFound;
+    return Status::OK();
+  }
+
+  template <typename Scalar>
+  Status VisitValue(const Scalar& value) {
+    *out_ids_++ = insert_ ? memo_table_.GetOrInsert(value) : memo_table_.Get(value);
+    return Status::OK();
+  }
+
+ private:
+  using MemoTable = typename internal::DictionaryTraits<Type>::MemoTableType;
+
+  Status Encode(const ArrayData& input, int32_t* ids, bool insert) {
+    out_ids_ = ids;
+    insert_ = insert;
+    // Make sure the visitor doesn't see an unknown null count
+    input.GetNullCount();
+    return ArrayDataVisitor<Type>::Visit(input, this);
+  }
+
+  MemoTable memo_table_;
+  int32_t* out_ids_;
+  bool insert_;
+};
+
+struct JoinKeyEncoderFactory {
+  template <typename T>
+  enable_if_memoize<T, Status> Visit(const T&) {
+    out->reset(new JoinKeyEncoderImpl<T>(pool));
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Joining on keys of type ", type.ToString());
+  }
+
+  MemoryPool* pool;
+  std::unique_ptr<JoinKeyEncoder>* out;
+};
+
+int64_t ArrayDataSize(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer) {
+      size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += ArrayDataSize(*child);
+  }
+  if (data.dictionary) {
+    size += ArrayDataSize(*data.dictionary->data());
+  }
+  return size;
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// HashJoiner
+
+class HashJoiner::Impl {
+ public:
+  Impl(FunctionContext* ctx, std::shared_ptr<Schema> left_schema,
+       std::shared_ptr<Schema> right_schema, std::vector<int> left_keys,
+       std::vector<int> right_keys, const JoinOptions& options)
+      : ctx_(ctx),
+        left_schema_(std::move(left_schema)),
+        right_schema_(std::move(right_schema)),
+        left_keys_(std::move(left_keys)),
+        right_keys_(std::move(right_keys)),
+        options_(options) {}
+
+  Status Init() {
+    if (left_keys_.empty() || left_keys_.size() != right_keys_.size()) {
+      return Status::Invalid("Join requires the same number of left and right keys");
+    }
+    for (size_t k = 0; k < left_keys_.size(); k++) {
+      RETURN_NOT_OK(CheckColumn(*left_schema_, left_keys_[k]));
+      RETURN_NOT_OK(CheckColumn(*right_schema_, right_keys_[k]));
+      const auto& type = right_schema_->field(right_keys_[k])->type();
+      if (!left_schema_->field(left_keys_[k])->type()->Equals(type)) {
+        return Status::TypeError("Join keys ", left_keys_[k], " and ", right_keys_[k],
+                                 " have different types");
+      }
+      std::unique_ptr<JoinKeyEncoder> encoder;
+      JoinKeyEncoderFactory factory{ctx_->memory_pool(), &encoder};
+      RETURN_NOT_OK(VisitTypeInline(*type, &factory));
+      encoders_.push_back(std::move(encoder));
+    }
+    // The ids of the keys are combined pairwise, from left to right
+    for (size_t k = 1; k < left_keys_.size(); k++) {
+      combiners_.emplace_back(
+          new internal::ScalarMemoTable<uint64_t>(ctx_->memory_pool()));
+    }
+
+    std::vector<std::shared_ptr<Field>> fields = left_schema_->fields();
+    if (options_.type == JoinOptions::INNER || options_.type == JoinOptions::LEFT_OUTER) {
+      // The right keys are equal to the left keys, they are only emitted once
+      for (int i = 0; i < right_schema_->num_fields(); i++) {
+        if (std::find(right_keys_.begin(), right_keys_.end(), i) == right_keys_.end()) {
+          right_columns_.push_back(i);
+        }
+      }
+      for (int i : right_columns_) {
+        const auto& right_field = right_schema_->field(i);
+        // Unmatched left rows have null right columns
+        fields.push_back(options_.type == JoinOptions::LEFT_OUTER
+                             ? field(right_field->name(), right_field->type(), true,
+                                     right_field->metadata())
+                             : right_field);
+      }
+    }
+    schema_ = ::arrow::schema(fields);
+    return Status::OK();
+  }
+
+  Status Build(const RecordBatch& batch) {
+    if (finished_) {
+      return Status::Invalid("Cannot build after FinishBuild");
+    }
+    if (!batch.schema()->Equals(*right_schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("Build batch schema does not match the right schema: ",
+                             batch.schema()->ToString());
+    }
+    int64_t batch_size = batch.num_rows() * sizeof(int32_t);
+    for (int i = 0; i < batch.num_columns(); i++) {
+      batch_size += ArrayDataSize(*batch.column_data(i));
+    }
+    RETURN_NOT_OK(Reserve(batch_size));
+
+    const int64_t offset = static_cast<int64_t>(row_key_ids_.size());
+    row_key_ids_.resize(offset + batch.num_rows());
+    RETURN_NOT_OK(ComputeKeyIds(batch, right_keys_, /*insert=*/true,
+                                row_key_ids_.data() + offset));
+    build_batches_.push_back(batch.Slice(0));
+    return Status::OK();
+  }
+
+  Status FinishBuild() {
+    if (finished_) {
+      return Status::Invalid("FinishBuild was already called");
+    }
+    finished_ = true;
+
+    // Group the build rows by key, as a list of rows per key id
+    int32_t num_keys = 0;
+    for (int32_t id : row_key_ids_) {
+      num_keys = std::max(num_keys, id + 1);
+    }
+    RETURN_NOT_OK(Reserve(static_cast<int64_t>(num_keys + 1 + row_key_ids_.size()) *
+                          sizeof(int64_t)));
+    key_offsets_.assign(num_keys + 1, 0);
+    for (int32_t id : row_key_ids_) {
+      if (id != kKeyNotFound) {
+        key_offsets_[id + 1]++;
+      }
+    }
+    for (int32_t id = 0; id < num_keys; id++) {
+      key_offsets_[id + 1] += key_offsets_[id];
+    }
+    key_rows_.resize(key_offsets_[num_keys]);
+    std::vector<int64_t> positions(key_offsets_.begin(), key_offsets_.end() - 1);
+    for (size_t row = 0; row < row_key_ids_.size(); row++) {
+      if (row_key_ids_[row] != kKeyNotFound) {
+        key_rows_[positions[row_key_ids_[row]]++] = static_cast<int64_t>(row);
+      }
+    }
+    row_key_ids_.clear();
+    row_key_ids_.shrink_to_fit();
+
+    // Concatenate the build batches so that matches can be taken at once
+    for (int i : right_columns_) {
+      std::shared_ptr<Array> column;
+      if (build_batches_.empty()) {
+        std::unique_ptr<ArrayBuilder> builder;
+        RETURN_NOT_OK(MakeBuilder(ctx_->memory_pool(), right_schema_->field(i)->type(),
+                                  &builder));
+        RETURN_NOT_OK(builder->Finish(&column));
+      } else {
+        ArrayVector chunks;
+        for (const auto& batch : build_batches_) {
+          chunks.push_back(batch->column(i));
+        }
+        RETURN_NOT_OK(Concatenate(chunks, ctx_->memory_pool(), &column));
+      }
+      build_columns_.push_back(column);
+    }
+    build_batches_.clear();
+    return Status::OK();
+  }
+
+  Status Probe(const RecordBatch& batch, std::shared_ptr<RecordBatch>* out) {
+    if (!finished_) {
+      return Status::Invalid("FinishBuild must be called before probing");
+    }
+    if (!batch.schema()->Equals(*left_schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("Probe batch schema does not match the left schema: ",
+                             batch.schema()->ToString());
+    }
+    probe_key_ids_.resize(batch.num_rows());
+    RETURN_NOT_OK(
+        ComputeKeyIds(batch, left_keys_, /*insert=*/false, probe_key_ids_.data()));
+
+    // Gather the indices of the output rows on both sides, the right row is
+    // null for the unmatched rows of a left outer join
+    left_rows_.clear();
+    right_rows_.clear();
+    right_valid_.clear();
+    left_rows_.reserve(batch.num_rows());
+    for (int64_t i = 0; i < batch.num_rows(); i++) {
+      const int32_t id = probe_key_ids_[i];
+      // Every key id was inserted by at least one build row
+      const bool matched = id != kKeyNotFound;
+      switch (options_.type) {
+        case JoinOptions::INNER:
+          if (matched) {
+            for (int64_t j = key_offsets_[id]; j < key_offsets_[id + 1]; j++) {
+              left_rows_.push_back(i);
+              right_rows_.push_back(key_rows_[j]);
+            }
+          }
+          break;
+        case JoinOptions::LEFT_OUTER:
+          if (matched) {
+            for (int64_t j = key_offsets_[id]; j < key_offsets_[id + 1]; j++) {
+              left_rows_.push_back(i);
+              right_rows_.push_back(key_rows_[j]);
+              right_valid_.push_back(1);
+            }
+          } else {
+            left_rows_.push_back(i);
+            right_rows_.push_back(0);
+            right_valid_.push_back(0);
+          }
+          break;
+        case JoinOptions::LEFT_SEMI:
+          if (matched) {
+            left_rows_.push_back(i);
+          }
+          break;
+        case JoinOptions::LEFT_ANTI:
+          if (!matched) {
+            left_rows_.push_back(i);
+          }
+          break;
+      }
+    }
+
+    std::shared_ptr<Array> left_taken, right_taken;
+    Int64Builder left_indices(ctx_->memory_pool());
+    RETURN_NOT_OK(left_indices.AppendValues(left_rows_));
+    RETURN_NOT_OK(left_indices.Finish(&left_taken));
+    std::vector<std::shared_ptr<Array>> columns;
+    for (int i = 0; i < batch.num_columns(); i++) {
+      std::shared_ptr<Array> column;
+      RETURN_NOT_OK(Take(ctx_, *batch.column(i), *left_taken, TakeOptions(), &column));
+      columns.push_back(column);
+    }
+    if (!build_columns_.empty()) {
+      Int64Builder right_indices(ctx_->memory_pool());
+      RETURN_NOT_OK(right_indices.AppendValues(
+          right_rows_.data(), static_cast<int64_t>(right_rows_.size()),
+          right_valid_.empty() ? nullptr : right_valid_.data()));
+      RETURN_NOT_OK(right_indices.Finish(&right_taken));
+      for (const auto& build_column : build_columns_) {
+        std::shared_ptr<Array> column;
+        RETURN_NOT_OK(Take(ctx_, *build_column, *right_taken, TakeOptions(), &column));
+        columns.push_back(column);
+      }
+    }
+    *out = RecordBatch::Make(schema_, left_taken->length(), columns);
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const { return schema_; }
+
+  int64_t memory_used() const { return memory_used_; }
+
+ private:
+  static Status CheckColumn(const Schema& schema, int i) {
+    if (i < 0 || i >= schema.num_fields()) {
+      return Status::IndexError("Column index ", i, " out of bounds");
+    }
+    return Status::OK();
+  }
+
+  Status Reserve(int64_t bytes) {
+    if (options_.memory_limit > 0 && memory_used_ + bytes > options_.memory_limit) {
+      return Status::CapacityError("Join build side exceeds the memory limit of ",
+                                   options_.memory_limit, " bytes");
+    }
+    memory_used_ += bytes;
+    return Status::OK();
+  }
+
+  // Compute the id of the key of every row, kKeyNotFound if a key is null
+  // or, when looking up, unknown
+  Status ComputeKeyIds(const RecordBatch& batch, const std::vector<int>& keys,
+                       bool insert, int32_t* ids) {
+    const int64_t length = batch.num_rows();
+    column_ids_.resize(length);
+    for (size_t k = 0; k < keys.size(); k++) {
+      int32_t* out_ids = k == 0 ? ids : column_ids_.data();
+      const auto& column = *batch.column_data(keys[k]);
+      RETURN_NOT_OK(insert ? encoders_[k]->Insert(column, out_ids)
+                           : encoders_[k]->Lookup(column, out_ids));
+      if (k == 0) {
+        continue;
+      }
+      auto& combiner = *combiners_[k - 1];
+      for (int64_t i = 0; i < length; i++) {
+        if (ids[i] == kKeyNotFound || column_ids_[i] == kKeyNotFound) {
+          ids[i] = kKeyNotFound;
+          continue;
+        }
+        const uint64_t pair = (static_cast<uint64_t>(ids[i]) << 32) |
+                              static_cast<uint32_t>(column_ids_[i]);
+        ids[i] = insert ? combiner.GetOrInsert(pair) : combiner.Get(pair);
+      }
+    }
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  std::shared_ptr<Schema> left_schema_;
+  std::shared_ptr<Schema> right_schema_;
+  std::vector<int> left_keys_;
+  std::vector<int> right_keys_;
+  // The right columns in the output, all but the keys
+  std::vector<int> right_columns_;
+  JoinOptions options_;
+  std::shared_ptr<Schema> schema_;
+
+  std::vector<std::unique_ptr<JoinKeyEncoder>> encoders_;
+  std::vector<std::unique_ptr<internal::ScalarMemoTable<uint64_t>>> combiners_;
+
+  bool finished_ = false;
+  int64_t memory_used_ = 0;
+  // Build side, until FinishBuild
+  std::vector<std::shared_ptr<RecordBatch>> build_batches_;
+  std::vector<int32_t> row_key_ids_;
+  // Build side, after FinishBuild: the rows with key id i are
+  // key_rows_[key_offsets_[i]:key_offsets_[i + 1]]
+  std::vector<std::shared_ptr<Array>> build_columns_;
+  std::vector<int64_t> key_offsets_;
+  std::vector<int64_t> key_rows_;
+
+  // Scratch space
+  std::vector<int32_t> column_ids_;
+  std::vector<int32_t> probe_key_ids_;
+  std::vector<int64_t> left_rows_;
+  std::vector<int64_t> right_rows_;
+  std::vector<uint8_t> right_valid_;
+};
+
+HashJoiner::HashJoiner(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+HashJoiner::~HashJoiner() {}
+
+Status HashJoiner::Make(FunctionContext* ctx, const std::shared_ptr<Schema>& left_schema,
+                        const std::shared_ptr<Schema>& right_schema,
+                        const std::vector<int>& left_keys,
+                        const std::vector<int>& right_keys, const JoinOptions& options,
+                        std::unique_ptr<HashJoiner>* out) {
+  std::unique_ptr<Impl> impl(
+      new Impl(ctx, left_schema, right_schema, left_keys, right_keys, options));
+  RETURN_NOT_OK(impl->Init());
+  out->reset(new HashJoiner(std::move(impl)));
+  return Status::OK();
+}
+
+Status HashJoiner::Build(const RecordBatch& batch) { return impl_->Build(batch); }
+
+Status HashJoiner::FinishBuild() { return impl_->FinishBuild(); }
+
+Status HashJoiner::Probe(const RecordBatch& batch, std::shared_ptr<RecordBatch>* out) {
+  return impl_->Probe(batch, out);
+}
+
+std::shared_ptr<Schema> HashJoiner::schema() const { return impl_->schema(); }
+
+int64_t HashJoiner::memory_used() const { return impl_->memory_used(); }
+
+// ----------------------------------------------------------------------
+// HashJoin
+
+Status HashJoin(FunctionContext* ctx, RecordBatchReader* left, RecordBatchReader* right,
+                const std::vector<int>& left_keys, const std::vector<int>& right_keys,
+                const JoinOptions& options, std::shared_ptr<Table>* out) {
+  std::unique_ptr<HashJoiner> joiner;
+  RETURN_NOT_OK(HashJoiner::Make(ctx, left->schema(), right->schema(), left_keys,
+                                 right_keys, options, &joiner));
+
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(right->ReadNext(&batch));
+    if (!batch) {
+      break;
+    }
+    RETURN_NOT_OK(joiner->Build(*batch));
+  }
+  RETURN_NOT_OK(joiner->FinishBuild());
+
+  std::vector<std::shared_ptr<RecordBatch>> joined;
+  while (true) {
+    RETURN_NOT_OK(left->ReadNext(&batch));
+    if (!batch) {
+      break;
+    }
+    std::shared_ptr<RecordBatch> joined_batch;
+    RETURN_NOT_OK(joiner->Probe(*batch, &joined_batch));
+    joined.push_back(joined_batch);
+  }
+  return Table::FromRecordBatches(joiner->schema(), joined, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
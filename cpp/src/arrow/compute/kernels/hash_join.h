@@ -0,0 +1,134 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class RecordBatch;
+class RecordBatchReader;
+class Schema;
+class Table;
+
+namespace compute {
+
+class FunctionContext;
+
+struct ARROW_EXPORT JoinOptions {
+  enum Type {
+    /// One row for every pair of matching left and right rows
+    INNER = 0,
+    /// Like INNER, plus the left rows without a match, with null right columns
+    LEFT_OUTER,
+    /// The left rows which have a match, with the left columns only
+    LEFT_SEMI,
+    /// The left rows which don't have a match, with the left columns only
+    LEFT_ANTI,
+  };
+
+  explicit JoinOptions(Type type = INNER, int64_t memory_limit = 0)
+      : type(type), memory_limit(memory_limit) {}
+
+  Type type;
+  /// Maximum number of bytes held by the build side, or 0 for no limit. The
+  /// join doesn't spill, it fails with CapacityError once the limit is exceeded.
+  int64_t memory_limit;
+};
+
+/// \brief Equi-join of record batches on key columns
+///
+/// The right side is the build side: its batches are all kept in memory, with a
+/// hash table from its keys to its rows. Batches of the left side are then
+/// probed one at a time, and the matching rows are gathered with Take.
+///
+/// Keys are compared column by column, the key columns of both sides must have
+/// the same types. As in SQL, a null key never matches, so left rows with a
+/// null key are only output by LEFT_OUTER and LEFT_ANTI joins.
+///
+/// The output has the left columns followed by the right columns other than the
+/// right keys, except for semi and anti joins which only have the left columns.
+///
+/// This class is not thread-safe.
+class ARROW_EXPORT HashJoiner {
+ public:
+  ~HashJoiner();
+
+  /// \brief Create a joiner
+  ///
+  /// \param[in] ctx the FunctionContext, which must outlive the joiner
+  /// \param[in] left_schema the schema of the probed batches
+  /// \param[in] right_schema the schema of the build batches
+  /// \param[in] left_keys indices of the left key columns
+  /// \param[in] right_keys indices of the right key columns, in the same order
+  /// \param[in] options the join options
+  /// \param[out] out the joiner
+  static Status Make(FunctionContext* ctx, const std::shared_ptr<Schema>& left_schema,
+                     const std::shared_ptr<Schema>& right_schema,
+                     const std::vector<int>& left_keys,
+                     const std::vector<int>& right_keys, const JoinOptions& options,
+                     std::unique_ptr<HashJoiner>* out);
+
+  /// \brief Add a batch of the right side to the hash table
+  Status Build(const RecordBatch& batch);
+
+  /// \brief Finish the hash table, must be called once before probing
+  Status FinishBuild();
+
+  /// \brief Join a batch of the left side with the right side
+  Status Probe(const RecordBatch& batch, std::shared_ptr<RecordBatch>* out);
+
+  /// \brief The schema of the joined batches
+  std::shared_ptr<Schema> schema() const;
+
+  /// \brief The number of bytes held by the build side
+  int64_t memory_used() const;
+
+ private:
+  class Impl;
+  explicit HashJoiner(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief Join two streams of record batches on key columns
+///
+/// The right stream is read entirely to build the hash table, then the left
+/// stream is probed batch by batch. See HashJoiner.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] left the left (probe) side
+/// \param[in] right the right (build) side
+/// \param[in] left_keys indices of the left key columns
+/// \param[in] right_keys indices of the right key columns, in the same order
+/// \param[in] options the join options
+/// \param[out] out the joined table
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashJoin(FunctionContext* ctx, RecordBatchReader* left, RecordBatchReader* right,
+                const std::vector<int>& left_keys, const std::vector<int>& right_keys,
+                const JoinOptions& options, std::shared_ptr<Table>* out);
+
+}  // namespace compute
+}  // namespace arrow
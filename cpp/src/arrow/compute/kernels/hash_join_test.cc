@@ -0,0 +1,200 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernels/hash_join.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+namespace compute {
+
+// Make a batch from a JSON array of rows, each an object keyed by field name
+std::shared_ptr<RecordBatch> RecordBatchFromJSON(const std::shared_ptr<Schema>& schema,
+                                                 const std::string& json) {
+  // Parse the rows as a struct array, whose children are the batch columns
+  auto struct_array = ArrayFromJSON(struct_(schema->fields()), json);
+  ArrayVector columns;
+  ABORT_NOT_OK(internal::checked_cast<const StructArray&>(*struct_array)
+                   .Flatten(default_memory_pool(), &columns));
+  return RecordBatch::Make(schema, struct_array->length(), columns);
+}
+
+class TestHashJoin : public ComputeFixture, public TestBase {
+ protected:
+  void SetUp() override {
+    left_schema_ = ::arrow::schema(
+        {field("id", int32()), field("name", utf8()), field("l", int64())});
+    right_schema_ = ::arrow::schema(
+        {field("r", float64()), field("name", utf8()), field("id", int32())});
+    left_ = RecordBatchFromJSON(left_schema_, R"([
+      {"id": 1, "name": "a", "l": 10},
+      {"id": 2, "name": "b", "l": 20},
+      {"id": 3, "name": "c", "l": 30},
+      {"id": 1, "name": "x", "l": 40},
+      {"id": null, "name": "a", "l": 50},
+      {"id": 2, "name": null, "l": 60}
+    ])");
+    right_ = RecordBatchFromJSON(right_schema_, R"([
+      {"r": 0.5, "name": "a", "id": 1},
+      {"r": 1.5, "name": "a", "id": 1},
+      {"r": 2.5, "name": "c", "id": 3},
+      {"r": 3.5, "name": null, "id": 2},
+      {"r": 4.5, "name": "a", "id": null}
+    ])");
+  }
+
+  // Join left_ with right_ on (id, name)
+  void Join(JoinOptions::Type type, std::shared_ptr<RecordBatch>* out) {
+    std::unique_ptr<HashJoiner> joiner;
+    ASSERT_OK(HashJoiner::Make(&ctx_, left_schema_, right_schema_, {0, 1}, {2, 1},
+                               JoinOptions(type), &joiner));
+    ASSERT_OK(joiner->Build(*right_->Slice(0, 2)));
+    ASSERT_OK(joiner->Build(*right_->Slice(2)));
+    ASSERT_OK(joiner->FinishBuild());
+    ASSERT_OK(joiner->Probe(*left_, out));
+    ASSERT_OK((*out)->Validate());
+    ASSERT_TRUE((*out)->schema()->Equals(*joiner->schema()));
+  }
+
+  std::shared_ptr<Schema> left_schema_, right_schema_;
+  std::shared_ptr<RecordBatch> left_, right_;
+};
+
+TEST_F(TestHashJoin, Inner) {
+  std::shared_ptr<RecordBatch> out;
+  Join(JoinOptions::INNER, &out);
+  // The right keys are not repeated in the output
+  ASSERT_EQ(out->schema()->field_names(),
+            std::vector<std::string>({"id", "name", "l", "r"}));
+  AssertBatchesEqual(*RecordBatchFromJSON(out->schema(), R"([
+    {"id": 1, "name": "a", "l": 10, "r": 0.5},
+    {"id": 1, "name": "a", "l": 10, "r": 1.5},
+    {"id": 3, "name": "c", "l": 30, "r": 2.5}
+  ])"),
+                     *out);
+}
+
+TEST_F(TestHashJoin, LeftOuter) {
+  std::shared_ptr<RecordBatch> out;
+  Join(JoinOptions::LEFT_OUTER, &out);
+  ASSERT_TRUE(out->schema()->field(3)->nullable());
+  AssertBatchesEqual(*RecordBatchFromJSON(out->schema(), R"([
+    {"id": 1, "name": "a", "l": 10, "r": 0.5},
+    {"id": 1, "name": "a", "l": 10, "r": 1.5},
+    {"id": 2, "name": "b", "l": 20, "r": null},
+    {"id": 3, "name": "c", "l": 30, "r": 2.5},
+    {"id": 1, "name": "x", "l": 40, "r": null},
+    {"id": null, "name": "a", "l": 50, "r": null},
+    {"id": 2, "name": null, "l": 60, "r": null}
+  ])"),
+                     *out);
+}
+
+TEST_F(TestHashJoin, Semi) {
+  std::shared_ptr<RecordBatch> out;
+  Join(JoinOptions::LEFT_SEMI, &out);
+  AssertBatchesEqual(*RecordBatchFromJSON(left_schema_, R"([
+    {"id": 1, "name": "a", "l": 10},
+    {"id": 3, "name": "c", "l": 30}
+  ])"),
+                     *out);
+}
+
+TEST_F(TestHashJoin, Anti) {
+  std::shared_ptr<RecordBatch> out;
+  Join(JoinOptions::LEFT_ANTI, &out);
+  // Rows with null keys never match
+  AssertBatchesEqual(*RecordBatchFromJSON(left_schema_, R"([
+    {"id": 2, "name": "b", "l": 20},
+    {"id": 1, "name": "x", "l": 40},
+    {"id": null, "name": "a", "l": 50},
+    {"id": 2, "name": null, "l": 60}
+  ])"),
+                     *out);
+}
+
+TEST_F(TestHashJoin, EmptyBuildSide) {
+  std::unique_ptr<HashJoiner> joiner;
+  ASSERT_OK(HashJoiner::Make(&ctx_, left_schema_, right_schema_, {0}, {2},
+                             JoinOptions(JoinOptions::LEFT_OUTER), &joiner));
+  ASSERT_OK(joiner->FinishBuild());
+  std::shared_ptr<RecordBatch> out;
+  ASSERT_OK(joiner->Probe(*left_, &out));
+  ASSERT_OK(out->Validate());
+  ASSERT_EQ(out->num_rows(), left_->num_rows());
+  ASSERT_EQ(out->column(3)->null_count(), left_->num_rows());
+}
+
+TEST_F(TestHashJoin, Errors) {
+  std::unique_ptr<HashJoiner> joiner;
+  ASSERT_RAISES(Invalid, HashJoiner::Make(&ctx_, left_schema_, right_schema_, {0},
+                                          {2, 1}, JoinOptions(), &joiner));
+  ASSERT_RAISES(IndexError, HashJoiner::Make(&ctx_, left_schema_, right_schema_, {3},
+                                             {2}, JoinOptions(), &joiner));
+  ASSERT_RAISES(TypeError, HashJoiner::Make(&ctx_, left_schema_, right_schema_, {0},
+                                            {1}, JoinOptions(), &joiner));
+
+  ASSERT_OK(HashJoiner::Make(&ctx_, left_schema_, right_schema_, {0}, {2},
+                             JoinOptions(), &joiner));
+  std::shared_ptr<RecordBatch> out;
+  ASSERT_RAISES(Invalid, joiner->Probe(*left_, &out));
+  ASSERT_RAISES(Invalid, joiner->Build(*left_));
+}
+
+TEST_F(TestHashJoin, MemoryLimit) {
+  std::unique_ptr<HashJoiner> joiner;
+  ASSERT_OK(HashJoiner::Make(&ctx_, left_schema_, right_schema_, {0}, {2},
+                             JoinOptions(JoinOptions::INNER, 1024), &joiner));
+  ASSERT_OK(joiner->Build(*right_));
+  ASSERT_GT(joiner->memory_used(), 0);
+  ASSERT_LE(joiner->memory_used(), 1024);
+
+  ASSERT_OK(HashJoiner::Make(&ctx_, left_schema_, right_schema_, {0}, {2},
+                             JoinOptions(JoinOptions::INNER, 16), &joiner));
+  ASSERT_RAISES(CapacityError, joiner->Build(*right_));
+}
+
+TEST_F(TestHashJoin, Streams) {
+  std::shared_ptr<Table> left_table, right_table;
+  ASSERT_OK(Table::FromRecordBatches({left_->Slice(0, 3), left_->Slice(3)}, &left_table));
+  ASSERT_OK(Table::FromRecordBatches({right_}, &right_table));
+  TableBatchReader left_reader(*left_table);
+  TableBatchReader right_reader(*right_table);
+
+  std::shared_ptr<Table> out;
+  ASSERT_OK(HashJoin(&ctx_, &left_reader, &right_reader, {0}, {2},
+                     JoinOptions(JoinOptions::INNER), &out));
+  ASSERT_OK(out->Validate());
+  ASSERT_EQ(out->num_columns(), 5);
+  // 1 -> 2 matches (twice), 2 -> 1 match (twice), 3 -> 1 match
+  ASSERT_EQ(out->num_rows(), 7);
+}
+
+}  // namespace compute
+}  // namespace arrow
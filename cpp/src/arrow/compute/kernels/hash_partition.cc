@@ -0,0 +1,234 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/hash_partition.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/record_batch.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/hash_util.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// Types whose values Gandiva hashes as the bits of their conversion to double
+template <typename T>
+struct is_hashed_as_double {
+  static constexpr bool value =
+      has_c_type<T>::value && !std::is_same<BooleanType, T>::value &&
+      !std::is_same<HalfFloatType, T>::value && !std::is_base_of<IntervalType, T>::value;
+};
+
+// Combines the hashes of the rows with the values of a key column. Null values
+// leave the hash unchanged, like Gandiva's hash32WithSeed.
+class KeyHasher {
+ public:
+  KeyHasher(const ArrayData& data, uint32_t* hashes) : data_(data), hashes_(hashes) {}
+
+  template <typename T>
+  typename std::enable_if<is_hashed_as_double<T>::value, Status>::type Visit(const T&) {
+    const auto values = data_.GetValues<typename T::c_type>(1);
+    HashValues([&](int64_t i, uint32_t seed) {
+      return HashDouble(static_cast<double>(values[i]), seed);
+    });
+    return Status::OK();
+  }
+
+  Status Visit(const BooleanType&) {
+    const uint8_t* values = data_.buffers[1]->data();
+    HashValues([&](int64_t i, uint32_t seed) {
+      return HashDouble(BitUtil::GetBit(values, data_.offset + i) ? 1.0 : 0.0, seed);
+    });
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_base_binary<T, Status> Visit(const T&) {
+    using offset_type = typename T::offset_type;
+    const auto offsets = data_.GetValues<offset_type>(1);
+    const uint8_t* values = data_.buffers[2] ? data_.buffers[2]->data() : NULLPTR;
+    HashValues([&](int64_t i, uint32_t seed) {
+      return HashUtil::MurmurHash3_32(values + offsets[i],
+                                      static_cast<int32_t>(offsets[i + 1] - offsets[i]),
+                                      seed);
+    });
+    return Status::OK();
+  }
+
+  Status Visit(const FixedSizeBinaryType& type) {
+    const int32_t width = type.byte_width();
+    const uint8_t* values = data_.GetValues<uint8_t>(1, data_.offset * width);
+    HashValues([&](int64_t i, uint32_t seed) {
+      return HashUtil::MurmurHash3_32(values + i * width, width, seed);
+    });
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Hashing keys of type ", type.ToString());
+  }
+
+ private:
+  static uint32_t HashDouble(double value, uint32_t seed) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return HashUtil::MurmurHash3_32(bits, seed);
+  }
+
+  template <typename HashValue>
+  void HashValues(HashValue&& hash_value) {
+    if (data_.GetNullCount() == 0) {
+      for (int64_t i = 0; i < data_.length; i++) {
+        hashes_[i] = hash_value(i, hashes_[i]);
+      }
+      return;
+    }
+    internal::BitmapReader valid(data_.buffers[0]->data(), data_.offset, data_.length);
+    for (int64_t i = 0; i < data_.length; i++) {
+      if (valid.IsSet()) {
+        hashes_[i] = hash_value(i, hashes_[i]);
+      }
+      valid.Next();
+    }
+  }
+
+  const ArrayData& data_;
+  uint32_t* hashes_;
+};
+
+Status CheckKeys(const RecordBatch& batch, const std::vector<int>& keys) {
+  if (keys.empty()) {
+    return Status::Invalid("At least one key column is required");
+  }
+  for (int key : keys) {
+    if (key < 0 || key >= batch.num_columns()) {
+      return Status::IndexError("Key column ", key, " out of bounds");
+    }
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status HashRows(FunctionContext* ctx, const RecordBatch& batch,
+                const std::vector<int>& keys, std::shared_ptr<Array>* out) {
+  RETURN_NOT_OK(CheckKeys(batch, keys));
+  const int64_t length = batch.num_rows();
+
+  std::shared_ptr<Buffer> hashes_buf;
+  RETURN_NOT_OK(
+      AllocateBuffer(ctx->memory_pool(), length * sizeof(uint32_t), &hashes_buf));
+  auto hashes = reinterpret_cast<uint32_t*>(hashes_buf->mutable_data());
+  std::fill(hashes, hashes + length, 0);
+
+  // Hash column by column, so that the inner loops are over a single type
+  for (int key : keys) {
+    const ArrayData& data = *batch.column_data(key);
+    KeyHasher hasher(data, hashes);
+    RETURN_NOT_OK(VisitTypeInline(*data.type, &hasher));
+  }
+  *out = std::make_shared<Int32Array>(length, hashes_buf);
+  return Status::OK();
+}
+
+Status HashPartitionIndices(FunctionContext* ctx, const RecordBatch& batch,
+                            const std::vector<int>& keys, int32_t num_partitions,
+                            std::shared_ptr<Array>* partition_ids,
+                            std::vector<std::shared_ptr<Array>>* partition_indices) {
+  if (num_partitions <= 0) {
+    return Status::Invalid("The number of partitions must be positive, got ",
+                           num_partitions);
+  }
+  std::shared_ptr<Array> hashes;
+  RETURN_NOT_OK(HashRows(ctx, batch, keys, &hashes));
+  const int64_t length = batch.num_rows();
+
+  // The hashes are turned into partition ids in place
+  std::shared_ptr<Buffer> ids_buf = hashes->data()->buffers[1];
+  auto ids = reinterpret_cast<int32_t*>(ids_buf->mutable_data());
+  std::vector<int64_t> offsets(num_partitions + 1, 0);
+  for (int64_t i = 0; i < length; i++) {
+    int32_t id = ids[i] % num_partitions;
+    id = id < 0 ? id + num_partitions : id;
+    ids[i] = id;
+    offsets[id + 1]++;
+  }
+  for (int32_t p = 0; p < num_partitions; p++) {
+    offsets[p + 1] += offsets[p];
+  }
+
+  std::shared_ptr<Buffer> indices_buf;
+  RETURN_NOT_OK(
+      AllocateBuffer(ctx->memory_pool(), length * sizeof(uint64_t), &indices_buf));
+  auto indices = reinterpret_cast<uint64_t*>(indices_buf->mutable_data());
+  std::vector<int64_t> positions(offsets.begin(), offsets.end() - 1);
+  for (int64_t i = 0; i < length; i++) {
+    indices[positions[ids[i]]++] = static_cast<uint64_t>(i);
+  }
+
+  *partition_ids = hashes;
+  auto all_indices = std::make_shared<UInt64Array>(length, indices_buf);
+  partition_indices->clear();
+  for (int32_t p = 0; p < num_partitions; p++) {
+    partition_indices->push_back(
+        all_indices->Slice(offsets[p], offsets[p + 1] - offsets[p]));
+  }
+  return Status::OK();
+}
+
+Status HashPartition(FunctionContext* ctx, const RecordBatch& batch,
+                     const std::vector<int>& keys, int32_t num_partitions,
+                     std::vector<std::shared_ptr<RecordBatch>>* out) {
+  std::shared_ptr<Array> partition_ids;
+  std::vector<std::shared_ptr<Array>> partition_indices;
+  RETURN_NOT_OK(HashPartitionIndices(ctx, batch, keys, num_partitions, &partition_ids,
+                                     &partition_indices));
+
+  // The indices of the partitions are contiguous, gather every column once
+  const int64_t length = batch.num_rows();
+  auto indices = std::make_shared<UInt64Array>(
+      length, partition_indices[0]->data()->buffers[1]);
+  std::vector<std::shared_ptr<Array>> columns(batch.num_columns());
+  for (int i = 0; i < batch.num_columns(); i++) {
+    RETURN_NOT_OK(Take(ctx, *batch.column(i), *indices, TakeOptions(), &columns[i]));
+  }
+  auto gathered = RecordBatch::Make(batch.schema(), length, std::move(columns));
+
+  out->clear();
+  int64_t offset = 0;
+  for (const auto& part : partition_indices) {
+    out->push_back(gathered->Slice(offset, part->length()));
+    offset += part->length();
+  }
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
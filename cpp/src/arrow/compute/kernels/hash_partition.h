@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class RecordBatch;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Hash the key columns of every row of a record batch
+///
+/// The hashes are 32-bit MurmurHash3, identical to Gandiva's: a row with keys
+/// (k1, k2, ..., kn) hashes to hash32WithSeed(kn, ... hash32WithSeed(k2,
+/// hash32(k1))). A null key leaves the hash unchanged, 0 for the first key.
+/// Numeric, boolean and temporal keys are hashed as the bits of their
+/// conversion to double, binary, string and fixed-size binary keys (including
+/// decimals) as their bytes.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] batch the record batch
+/// \param[in] keys indices of the key columns
+/// \param[out] out an Int32Array of hashes, without nulls
+ARROW_EXPORT
+Status HashRows(FunctionContext* ctx, const RecordBatch& batch,
+                const std::vector<int>& keys, std::shared_ptr<Array>* out);
+
+/// \brief Assign every row of a record batch to a partition by the hash of its keys
+///
+/// The partition of a row is its hash (see HashRows) modulo num_partitions,
+/// made non-negative. The rows are split with a single counting pass over the
+/// partition ids followed by a scatter of the row indices.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] batch the record batch
+/// \param[in] keys indices of the key columns
+/// \param[in] num_partitions the number of partitions
+/// \param[out] partition_ids an Int32Array with the partition of every row
+/// \param[out] partition_indices a UInt64Array for every partition, with the
+///             indices of its rows in increasing order. They are slices of a
+///             single buffer.
+ARROW_EXPORT
+Status HashPartitionIndices(FunctionContext* ctx, const RecordBatch& batch,
+                            const std::vector<int>& keys, int32_t num_partitions,
+                            std::shared_ptr<Array>* partition_ids,
+                            std::vector<std::shared_ptr<Array>>* partition_indices);
+
+/// \brief Split a record batch into partitions by the hash of its keys
+///
+/// See HashPartitionIndices. The columns are gathered once in partition order
+/// and the partitions are zero-copy slices of the gathered batch.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] batch the record batch
+/// \param[in] keys indices of the key columns
+/// \param[in] num_partitions the number of partitions
+/// \param[out] out a record batch for every partition, possibly empty
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashPartition(FunctionContext* ctx, const RecordBatch& batch,
+                     const std::vector<int>& keys, int32_t num_partitions,
+                     std::vector<std::shared_ptr<RecordBatch>>* out);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,143 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernels/hash_partition.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+namespace compute {
+
+using internal::checked_cast;
+
+class TestHashPartition : public ComputeFixture, public TestBase {
+ protected:
+  void SetUp() override {
+    schema_ = ::arrow::schema({field("f", float64()), field("s", utf8()),
+                               field("i", int32()), field("d", decimal(5, 2))});
+    batch_ = RecordBatch::Make(
+        schema_, 3,
+        {ArrayFromJSON(float64(), "[1.0, -3.0, null]"),
+         ArrayFromJSON(utf8(), R"(["hello", "hello", "hello"])"),
+         ArrayFromJSON(int32(), "[1, -3, null]"),
+         ArrayFromJSON(decimal(5, 2), R"(["1.00", "-3.00", null])")});
+  }
+
+  void AssertHashes(const std::vector<int>& keys, const std::string& expected) {
+    std::shared_ptr<Array> hashes;
+    ASSERT_OK(HashRows(&ctx_, *batch_, keys, &hashes));
+    ASSERT_OK(hashes->Validate());
+    AssertArraysEqual(*ArrayFromJSON(int32(), expected), *hashes);
+  }
+
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<RecordBatch> batch_;
+};
+
+TEST_F(TestHashPartition, HashRows) {
+  // Values of Gandiva's hash32 and hash32WithSeed
+  AssertHashes({0}, "[-142385009, -2127878026, 0]");
+  AssertHashes({1}, "[613153351, 613153351, 613153351]");
+  // Integers are hashed as doubles
+  AssertHashes({2}, "[-142385009, -2127878026, 0]");
+  // Null keys leave the hash unchanged
+  AssertHashes({0, 1}, "[-1261217583, 1151697747, 613153351]");
+  AssertHashes({1, 0}, "[402235297, 90866449, 613153351]");
+}
+
+TEST_F(TestHashPartition, HashRowsSliced) {
+  std::shared_ptr<Array> hashes, sliced_hashes;
+  ASSERT_OK(HashRows(&ctx_, *batch_, {0, 1, 3}, &hashes));
+  ASSERT_OK(HashRows(&ctx_, *batch_->Slice(1), {0, 1, 3}, &sliced_hashes));
+  AssertArraysEqual(*hashes->Slice(1), *sliced_hashes);
+}
+
+TEST_F(TestHashPartition, Partition) {
+  auto rand = random::RandomArrayGenerator(0x7a3c91);
+  const int64_t length = 1000;
+  const int32_t num_partitions = 7;
+  auto schema = ::arrow::schema({field("key", int64()), field("value", utf8())});
+  auto batch = RecordBatch::Make(
+      schema, length,
+      {rand.Int64(length, -100, 100, 0.1), rand.String(length, 0, 10, 0.1)});
+
+  std::shared_ptr<Array> hashes, ids;
+  std::vector<std::shared_ptr<Array>> indices;
+  ASSERT_OK(HashRows(&ctx_, *batch, {0, 1}, &hashes));
+  ASSERT_OK(HashPartitionIndices(&ctx_, *batch, {0, 1}, num_partitions, &ids, &indices));
+  ASSERT_EQ(static_cast<int32_t>(indices.size()), num_partitions);
+
+  const auto& hash_values = checked_cast<const Int32Array&>(*hashes);
+  const auto& id_values = checked_cast<const Int32Array&>(*ids);
+  for (int64_t i = 0; i < length; i++) {
+    const int32_t expected = ((hash_values.Value(i) % num_partitions) + num_partitions) %
+                             num_partitions;
+    ASSERT_EQ(id_values.Value(i), expected);
+  }
+
+  std::vector<std::shared_ptr<RecordBatch>> partitions;
+  ASSERT_OK(HashPartition(&ctx_, *batch, {0, 1}, num_partitions, &partitions));
+  ASSERT_EQ(static_cast<int32_t>(partitions.size()), num_partitions);
+
+  int64_t total = 0;
+  for (int32_t p = 0; p < num_partitions; p++) {
+    const auto& part_indices = checked_cast<const UInt64Array&>(*indices[p]);
+    ASSERT_EQ(partitions[p]->num_rows(), part_indices.length());
+    ASSERT_OK(partitions[p]->Validate());
+    for (int64_t j = 0; j < part_indices.length(); j++) {
+      const int64_t row = static_cast<int64_t>(part_indices.Value(j));
+      if (j > 0) {
+        ASSERT_LT(part_indices.Value(j - 1), part_indices.Value(j));
+      }
+      ASSERT_EQ(id_values.Value(row), p);
+      for (int c = 0; c < batch->num_columns(); c++) {
+        ASSERT_TRUE(
+            batch->column(c)->RangeEquals(row, row + 1, j, partitions[p]->column(c)));
+      }
+    }
+    total += part_indices.length();
+  }
+  ASSERT_EQ(total, length);
+}
+
+TEST_F(TestHashPartition, Errors) {
+  std::shared_ptr<Array> ids;
+  std::vector<std::shared_ptr<Array>> indices;
+  ASSERT_RAISES(Invalid, HashPartitionIndices(&ctx_, *batch_, {0}, 0, &ids, &indices));
+  ASSERT_RAISES(Invalid, HashPartitionIndices(&ctx_, *batch_, {}, 4, &ids, &indices));
+  ASSERT_RAISES(IndexError,
+                HashPartitionIndices(&ctx_, *batch_, {4}, 4, &ids, &indices));
+
+  auto schema = ::arrow::schema({field("l", list(int32()))});
+  auto batch = RecordBatch::Make(schema, 1, {ArrayFromJSON(list(int32()), "[[1]]")});
+  ASSERT_RAISES(NotImplemented, HashRows(&ctx_, *batch, {0}, &ids));
+}
+
+}  // namespace compute
+}  // namespace arrow
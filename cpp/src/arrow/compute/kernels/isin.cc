@@ -39,6 +39,7 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/hash_util.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
@@ -66,12 +67,16 @@ class IsInKernelImpl : public UnaryKernel {
 
   std::shared_ptr<DataType> out_type() const override { return boolean(); }
 
+  // The right values are only read once constructed
+  bool is_thread_safe() const override { return true; }
+
   virtual Status ConstructRight(FunctionContext* ctx, const Datum& right) = 0;
+
+  virtual IsInValueSet::Strategy strategy() const { return IsInValueSet::HASH_TABLE; }
 };
 
 // ----------------------------------------------------------------------
 // Using a visitor create a memo_table_ for the right array
-// TODO: Implement for small lists
 
 template <typename T, typename Scalar>
 struct MemoTableRight {
@@ -99,13 +104,208 @@ struct MemoTableRight {
 };
 
 // ----------------------------------------------------------------------
+// Lookups of the left values in the right values
 
-template <typename Type, typename Scalar>
-class IsInKernel : public IsInKernelImpl {
+template <typename MemoTable>
+struct HashTableLookup {
+  template <typename Scalar>
+  bool operator()(const Scalar& value) const {
+    return memo_table->Get(value) != -1;
+  }
+
+  const MemoTable* memo_table;
+};
+
+// Compare with every value of a fixed size set, padded with copies of its first
+// value. There are no branches, so the compiler can unroll and vectorize it.
+template <typename Scalar>
+struct SmallSetLookup {
+  static constexpr int kMaxSize = 8;
+
+  bool operator()(Scalar value) const {
+    bool found = false;
+    for (int i = 0; i < kMaxSize; i++) {
+      found |= values[i] == value;
+    }
+    return found;
+  }
+
+  Scalar values[kMaxSize];
+};
+
+// Test the bit of the offset of the value from the minimum of the set
+template <typename Scalar>
+struct BitmapLookup {
+  bool operator()(Scalar value) const {
+    const uint64_t offset = static_cast<uint64_t>(value) - static_cast<uint64_t>(min);
+    return offset <= range && BitUtil::GetBit(bitmap, offset);
+  }
+
+  Scalar min;
+  uint64_t range;
+  const uint8_t* bitmap;
+};
+
+// Hash to a slot holding the index of the only value which can be equal
+struct PerfectHashLookup {
+  bool operator()(const util::string_view& value) const {
+    const uint32_t hash = HashUtil::MurmurHash3_32(
+        value.data(), static_cast<int32_t>(value.size()), seed);
+    const int32_t index = slots[hash & mask];
+    return index >= 0 && values[index] == value;
+  }
+
+  uint32_t seed;
+  uint32_t mask;
+  const int32_t* slots;
+  const util::string_view* values;
+};
+
+// Lookups other than the hash table, picked from the values of the right input.
+// Types without faster lookups always use the hash table.
+template <typename Scalar, typename Enable = void>
+class FastLookups {
  public:
-  IsInKernel(const std::shared_ptr<DataType>& type, MemoryPool* pool)
-      : type_(type), pool_(pool) {}
+  template <typename MemoTable>
+  IsInValueSet::Strategy Init(const MemoTable& memo_table) {
+    return IsInValueSet::HASH_TABLE;
+  }
 
+  template <typename Visitor>
+  Status Visit(IsInValueSet::Strategy strategy, Visitor&& visitor) const {
+    return Status::UnknownError("Unexpected IsIn strategy ", strategy);
+  }
+};
+
+template <typename Scalar>
+struct is_integer_scalar {
+  static constexpr bool value =
+      std::is_integral<Scalar>::value && !std::is_same<Scalar, bool>::value;
+};
+
+template <typename Scalar>
+class FastLookups<Scalar,
+                  typename std::enable_if<is_integer_scalar<Scalar>::value>::type> {
+ public:
+  // Bitmaps of up to kMinBitmapRange bits are always dense enough
+  static constexpr uint64_t kMinBitmapRange = 1 << 16;
+  static constexpr uint64_t kMaxBitsPerValue = 32;
+
+  template <typename MemoTable>
+  IsInValueSet::Strategy Init(const MemoTable& memo_table) {
+    const int32_t size = memo_table.size();
+    if (size == 0) {
+      return IsInValueSet::HASH_TABLE;
+    }
+    std::vector<Scalar> values(size);
+    memo_table.CopyValues(values.data());
+
+    if (size <= SmallSetLookup<Scalar>::kMaxSize) {
+      for (int i = 0; i < SmallSetLookup<Scalar>::kMaxSize; i++) {
+        small_set_.values[i] = values[i < size ? i : 0];
+      }
+      return IsInValueSet::SMALL_SET;
+    }
+
+    const auto min_max = std::minmax_element(values.begin(), values.end());
+    const uint64_t range =
+        static_cast<uint64_t>(*min_max.second) - static_cast<uint64_t>(*min_max.first);
+    uint64_t max_range = kMaxBitsPerValue * size;
+    if (max_range < kMinBitmapRange) {
+      max_range = kMinBitmapRange;
+    }
+    if (range >= max_range) {
+      return IsInValueSet::HASH_TABLE;
+    }
+    bitmap_.assign(BitUtil::BytesForBits(range + 1), 0);
+    const Scalar min = *min_max.first;
+    for (Scalar value : values) {
+      BitUtil::SetBit(bitmap_.data(),
+                      static_cast<uint64_t>(value) - static_cast<uint64_t>(min));
+    }
+    bitmap_lookup_ = {min, range, bitmap_.data()};
+    return IsInValueSet::BITMAP;
+  }
+
+  template <typename Visitor>
+  Status Visit(IsInValueSet::Strategy strategy, Visitor&& visitor) const {
+    switch (strategy) {
+      case IsInValueSet::SMALL_SET:
+        return visitor(small_set_);
+      case IsInValueSet::BITMAP:
+        return visitor(bitmap_lookup_);
+      default:
+        return Status::UnknownError("Unexpected IsIn strategy ", strategy);
+    }
+  }
+
+ private:
+  SmallSetLookup<Scalar> small_set_;
+  std::vector<uint8_t> bitmap_;
+  BitmapLookup<Scalar> bitmap_lookup_;
+};
+
+template <>
+class FastLookups<util::string_view> {
+ public:
+  static constexpr int32_t kMaxSize = 64;
+  static constexpr int kMaxSeeds = 16;
+
+  template <typename MemoTable>
+  IsInValueSet::Strategy Init(const MemoTable& memo_table) {
+    const int32_t size = memo_table.size();
+    if (size == 0 || size > kMaxSize) {
+      return IsInValueSet::HASH_TABLE;
+    }
+    memo_table.VisitValues(0, [&](const util::string_view& value) {
+      values_.push_back(value);
+    });
+
+    // With more slots than the square of the number of values, a random seed
+    // has no collisions with probability over 1/2
+    const uint32_t num_slots =
+        static_cast<uint32_t>(BitUtil::NextPower2(std::max(16, 2 * size * size)));
+    std::vector<int32_t> slots(num_slots);
+    for (uint32_t seed = 0; seed < kMaxSeeds; seed++) {
+      std::fill(slots.begin(), slots.end(), -1);
+      bool collision = false;
+      for (int32_t i = 0; i < size && !collision; i++) {
+        const uint32_t hash = HashUtil::MurmurHash3_32(
+            values_[i].data(), static_cast<int32_t>(values_[i].size()), seed);
+        int32_t* slot = &slots[hash & (num_slots - 1)];
+        collision = *slot >= 0;
+        *slot = i;
+      }
+      if (!collision) {
+        slots_ = std::move(slots);
+        lookup_ = {seed, num_slots - 1, slots_.data(), values_.data()};
+        return IsInValueSet::PERFECT_HASH;
+      }
+    }
+    return IsInValueSet::HASH_TABLE;
+  }
+
+  template <typename Visitor>
+  Status Visit(IsInValueSet::Strategy strategy, Visitor&& visitor) const {
+    DCHECK_EQ(strategy, IsInValueSet::PERFECT_HASH);
+    return visitor(lookup_);
+  }
+
+ private:
+  // Views of the values of the memo table, which must outlive them
+  std::vector<util::string_view> values_;
+  std::vector<int32_t> slots_;
+  PerfectHashLookup lookup_;
+};
+
+// ----------------------------------------------------------------------
+// Probing of the left values
+
+// Iterate over the left array with a visitor, writing whether each value is in
+// the right values. The state of an iteration is kept here rather than in the
+// kernel, so that several arrays can be visited at once.
+template <typename Scalar, typename Lookup>
+struct LeftVisitor {
   // \brief if left array has a null return true
   Status VisitNull() {
     writer->Set();
@@ -113,12 +313,8 @@ class IsInKernel : public IsInKernelImpl {
     return Status::OK();
   }
 
-  // \brief Iterate over the left array using another visitor.
-  // In VisitValue, use the memo_table_ (for right array) and check if value
-  // in left array is in the memo_table_. Return true if condition satisfied,
-  // else false.
   Status VisitValue(const Scalar& value) {
-    if (memo_table_->Get(value) != -1) {
+    if (lookup(value)) {
       writer->Set();
     } else {
       writer->Clear();
@@ -127,17 +323,79 @@ class IsInKernel : public IsInKernelImpl {
     return Status::OK();
   }
 
+  const Lookup& lookup;
+  internal::FirstTimeBitmapWriter* writer;
+};
+
+// Whether the values of a type are stored as an array of its c_type
+template <typename T>
+struct is_c_type_array {
+  static constexpr bool value =
+      has_c_type<T>::value && !std::is_same<BooleanType, T>::value;
+};
+
+template <typename Type, typename Scalar>
+struct LeftProber {
+  // Values of primitive types are probed in a tight loop, including the slots
+  // of nulls, which are then set to true
+  template <typename Lookup, typename T = Type>
+  typename std::enable_if<is_c_type_array<T>::value, Status>::type operator()(
+      const Lookup& lookup) const {
+    if (left.length == 0) {
+      return Status::OK();
+    }
+    const Scalar* values = left.GetValues<Scalar>(1);
+    uint8_t* out_bitmap = output->buffers[1]->mutable_data();
+    int64_t i = 0;
+    internal::GenerateBitsUnrolled(out_bitmap, output->offset, left.length,
+                                   [&]() { return lookup(values[i++]); });
+    if (left.GetNullCount() != 0) {
+      internal::BitmapReader valid(left.buffers[0]->data(), left.offset, left.length);
+      for (int64_t j = 0; j < left.length; j++) {
+        if (valid.IsNotSet()) {
+          BitUtil::SetBit(out_bitmap, output->offset + j);
+        }
+        valid.Next();
+      }
+    }
+    return Status::OK();
+  }
+
+  template <typename Lookup, typename T = Type>
+  typename std::enable_if<!is_c_type_array<T>::value, Status>::type operator()(
+      const Lookup& lookup) const {
+    internal::FirstTimeBitmapWriter writer(output->buffers[1]->mutable_data(),
+                                           output->offset, left.length);
+    LeftVisitor<Scalar, Lookup> visitor{lookup, &writer};
+    RETURN_NOT_OK(ArrayDataVisitor<Type>::Visit(left, &visitor));
+    writer.Finish();
+    return Status::OK();
+  }
+
+  const ArrayData& left;
+  ArrayData* output;
+};
+
+// ----------------------------------------------------------------------
+
+template <typename Type, typename Scalar>
+class IsInKernel : public IsInKernelImpl {
+ public:
+  IsInKernel(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : type_(type), pool_(pool) {}
+
   Status Compute(FunctionContext* ctx, const Datum& left, Datum* out) override {
     const ArrayData& left_data = *left.array();
 
-    output = out->array();
+    std::shared_ptr<ArrayData> output = out->array();
     output->type = boolean();
 
-    writer = std::make_shared<internal::FirstTimeBitmapWriter>(
-        output.get()->buffers[1]->mutable_data(), output.get()->offset, left_data.length);
-
-    RETURN_NOT_OK(ArrayDataVisitor<Type>::Visit(left_data, this));
-    writer->Finish();
+    LeftProber<Type, Scalar> prober{left_data, output.get()};
+    if (strategy_ == IsInValueSet::HASH_TABLE) {
+      RETURN_NOT_OK(prober(HashTableLookup<MemoTable>{memo_table_.get()}));
+    } else {
+      RETURN_NOT_OK(fast_lookups_.Visit(strategy_, prober));
+    }
 
     // if right null count is zero and left null count is not zero, propagate nulls
     if (right_null_count_ == 0 && left_data.GetNullCount() != 0) {
@@ -163,9 +421,12 @@ class IsInKernel : public IsInKernelImpl {
 
     memo_table_ = std::move(func.memo_table_);
     right_null_count_ = func.right_null_count;
+    strategy_ = fast_lookups_.Init(*memo_table_);
     return Status::OK();
   }
 
+  IsInValueSet::Strategy strategy() const override { return strategy_; }
+
  protected:
   using MemoTable = typename HashTraits<Type>::MemoTableType;
   std::unique_ptr<MemoTable> memo_table_;
@@ -173,11 +434,12 @@ class IsInKernel : public IsInKernelImpl {
   MemoryPool* pool_;
 
  private:
+  FastLookups<Scalar> fast_lookups_;
+  IsInValueSet::Strategy strategy_ = IsInValueSet::HASH_TABLE;
+
   // \brief Additional member "right_null_count" is used to check if
   // null count in right is not 0
   int64_t right_null_count_{};
-  std::shared_ptr<internal::FirstTimeBitmapWriter> writer;
-  std::shared_ptr<ArrayData> output;
 };
 
 // ----------------------------------------------------------------------
@@ -191,22 +453,22 @@ class NullIsInKernel : public IsInKernelImpl {
   // return true, else propagate to all nulls
   Status Compute(FunctionContext* ctx, const Datum& left, Datum* out) override {
     const ArrayData& left_data = *left.array();
-    left_null_count = left_data.GetNullCount();
+    const int64_t left_null_count = left_data.GetNullCount();
 
-    output = out->array();
+    std::shared_ptr<ArrayData> output = out->array();
     output->type = boolean();
 
-    writer = std::make_shared<internal::FirstTimeBitmapWriter>(
-        output.get()->buffers[1]->mutable_data(), output.get()->offset, left_data.length);
+    internal::FirstTimeBitmapWriter writer(output->buffers[1]->mutable_data(),
+                                           output->offset, left_data.length);
 
     if (left_null_count != 0 && right_null_count == 0) {
       RETURN_NOT_OK(detail::PropagateNulls(ctx, left_data, output.get()));
     } else {
       for (int64_t i = 0; i < left_data.length; ++i) {
-        writer->Set();
-        writer->Next();
+        writer.Set();
+        writer.Next();
       }
-      writer->Finish();
+      writer.Finish();
     }
     return Status::OK();
   }
@@ -227,10 +489,7 @@ class NullIsInKernel : public IsInKernelImpl {
   }
 
  private:
-  int64_t left_null_count{};
   int64_t right_null_count{};
-  std::shared_ptr<internal::FirstTimeBitmapWriter> writer;
-  std::shared_ptr<ArrayData> output;
 };
 
 // ----------------------------------------------------------------------
@@ -309,13 +568,37 @@ Status GetIsInKernel(FunctionContext* ctx, const std::shared_ptr<DataType>& type
   return Status::OK();
 }
 
+IsInValueSet::IsInValueSet(std::shared_ptr<DataType> type,
+                           std::unique_ptr<IsInKernelImpl> kernel)
+    : type_(std::move(type)), kernel_(std::move(kernel)) {}
+
+IsInValueSet::~IsInValueSet() {}
+
+Status IsInValueSet::Make(FunctionContext* ctx, const Datum& values,
+                          std::shared_ptr<IsInValueSet>* out) {
+  std::unique_ptr<IsInKernelImpl> kernel;
+  RETURN_NOT_OK(GetIsInKernel(ctx, values.type(), values, &kernel));
+  out->reset(new IsInValueSet(values.type(), std::move(kernel)));
+  return Status::OK();
+}
+
+IsInValueSet::Strategy IsInValueSet::strategy() const { return kernel_->strategy(); }
+
 Status IsIn(FunctionContext* ctx, const Datum& left, const Datum& right, Datum* out) {
   DCHECK(left.type()->Equals(right.type()));
-  std::vector<Datum> outputs;
-  std::unique_ptr<IsInKernelImpl> lkernel;
+  std::shared_ptr<IsInValueSet> value_set;
+  RETURN_NOT_OK(IsInValueSet::Make(ctx, right, &value_set));
+  return IsIn(ctx, left, *value_set, out);
+}
 
-  RETURN_NOT_OK(GetIsInKernel(ctx, left.type(), right, &lkernel));
-  detail::PrimitiveAllocatingUnaryKernel kernel(lkernel.get());
+Status IsIn(FunctionContext* ctx, const Datum& left, const IsInValueSet& right,
+            Datum* out) {
+  if (!left.type()->Equals(right.type())) {
+    return Status::TypeError("IsIn expects a value set of type ", *left.type(),
+                             ", got ", *right.type());
+  }
+  std::vector<Datum> outputs;
+  detail::PrimitiveAllocatingUnaryKernel kernel(right.kernel_.get());
   RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, &kernel, left, &outputs));
 
   *out = detail::WrapDatumsLike(left, outputs);
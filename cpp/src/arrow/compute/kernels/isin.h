@@ -29,12 +29,60 @@
 namespace arrow {
 namespace compute {
 
+class IsInKernelImpl;
+
+/// \brief A set of values to look up with IsIn
+///
+/// The set is built once from the right input of IsIn and can be reused for
+/// many left inputs, e.g. the batches of a stream filtered by an IN-list. It is
+/// immutable once built, so it can be probed from several threads.
+///
+/// The lookup strategy is picked from the values:
+/// - sets of at most 8 integers are scanned linearly, without branches;
+/// - integers spanning a range at most 32 times their number (or 65536) are
+///   looked up in a bitmap over their range;
+/// - sets of at most 64 binary or string values get a perfect hash table;
+/// - other sets use a general hash table.
+class ARROW_EXPORT IsInValueSet {
+ public:
+  enum Strategy {
+    HASH_TABLE = 0,
+    SMALL_SET,
+    BITMAP,
+    PERFECT_HASH,
+  };
+
+  ~IsInValueSet();
+
+  /// \brief Build the set of the values of an Array or ChunkedArray
+  static Status Make(FunctionContext* context, const Datum& values,
+                     std::shared_ptr<IsInValueSet>* out);
+
+  /// \brief The type of the values
+  const std::shared_ptr<DataType>& type() const { return type_; }
+
+  /// \brief The lookup strategy picked for the values
+  Strategy strategy() const;
+
+ private:
+  IsInValueSet(std::shared_ptr<DataType> type, std::unique_ptr<IsInKernelImpl> kernel);
+
+  std::shared_ptr<DataType> type_;
+  std::unique_ptr<IsInKernelImpl> kernel_;
+
+  friend ARROW_EXPORT Status IsIn(FunctionContext* context, const Datum& left,
+                                  const IsInValueSet& right, Datum* out);
+};
+
 /// \brief IsIn returns boolean values if the value
 /// is in both left and right arrays.
 ///
 /// If null occurs in left, if null count in right is not 0,
 /// it returns true, else returns null.
 ///
+/// The values of right are put in an IsInValueSet, see there for the lookup
+/// strategies.
+///
 /// \param[in] context the FunctionContext
 /// \param[in] left array-like input
 /// \param[in] right array-like input
@@ -45,5 +93,17 @@ namespace compute {
 ARROW_EXPORT
 Status IsIn(FunctionContext* context, const Datum& left, const Datum& right, Datum* out);
 
+/// \brief IsIn with a prebuilt set of values
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left array-like input
+/// \param[in] right the set of values, of the same type as left
+/// \param[out] out resulting datum
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status IsIn(FunctionContext* context, const Datum& left, const IsInValueSet& right,
+            Datum* out);
+
 }  // namespace compute
 }  // namespace arrow
@@ -19,8 +19,11 @@
 #include <cstdint>
 #include <cstdio>
 #include <functional>
+#include <limits>
 #include <locale>
 #include <memory>
+#include <random>
+#include <set>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -38,6 +41,8 @@
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
@@ -410,5 +415,159 @@ TEST_F(TestIsInKernel, IsInChunkedArrayInvoke) {
   AssertChunkedEqual(*expected_carr, *encoded_out.chunked_array());
 }
 
+TEST_F(TestIsInKernel, ValueSetStrategy) {
+  auto CheckStrategy = [this](const std::shared_ptr<DataType>& type,
+                              const std::string& json,
+                              IsInValueSet::Strategy expected) {
+    std::shared_ptr<IsInValueSet> value_set;
+    ASSERT_OK(IsInValueSet::Make(&this->ctx_, ArrayFromJSON(type, json), &value_set));
+    ASSERT_TRUE(value_set->type()->Equals(type));
+    ASSERT_EQ(value_set->strategy(), expected);
+  };
+  CheckStrategy(int32(), "[]", IsInValueSet::HASH_TABLE);
+  CheckStrategy(int32(), "[3, 1, null, 3, -7]", IsInValueSet::SMALL_SET);
+  CheckStrategy(uint8(), "[1, 2, 3, 4, 5, 6, 7, 8, 9]", IsInValueSet::BITMAP);
+  // Small ranges always use a bitmap
+  CheckStrategy(int64(), "[0, 10, 1000, 20000, 30000, 40000, 50000, 60000, 65535]",
+                IsInValueSet::BITMAP);
+  CheckStrategy(int64(), "[0, 10, 1000, 20000, 30000, 40000, 50000, 60000, 65536]",
+                IsInValueSet::HASH_TABLE);
+  CheckStrategy(float64(), "[1, 2]", IsInValueSet::HASH_TABLE);
+  CheckStrategy(utf8(), R"(["a", "", "bc", null])", IsInValueSet::PERFECT_HASH);
+  CheckStrategy(boolean(), "[true]", IsInValueSet::HASH_TABLE);
+}
+
+template <typename Type>
+class TestIsInKernelStrategies : public ComputeFixture, public TestBase {
+ protected:
+  using CType = typename Type::c_type;
+
+  // Check IsIn on random values against a std::set of the member values
+  void Check(const std::vector<CType>& members, IsInValueSet::Strategy strategy) {
+    std::shared_ptr<Array> member_array;
+    ArrayFromVector<Type, CType>(members, &member_array);
+    std::shared_ptr<IsInValueSet> value_set;
+    ASSERT_OK(IsInValueSet::Make(&this->ctx_, member_array, &value_set));
+    ASSERT_EQ(value_set->strategy(), strategy);
+
+    // Half of the left values are members, the others are close to members
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<size_t> index(0, members.size() - 1);
+    std::vector<CType> values;
+    std::vector<bool> is_valid;
+    for (int i = 0; i < 1000; i++) {
+      CType value = members[index(engine)];
+      if (i % 2 != 0) {
+        value = static_cast<CType>(static_cast<uint64_t>(value) + i % 7 - 3);
+      }
+      values.push_back(value);
+      is_valid.push_back(i % 10 != 0);
+    }
+    std::shared_ptr<Array> left;
+    ArrayFromVector<Type, CType>(is_valid, values, &left);
+
+    const std::set<CType> member_set(members.begin(), members.end());
+    std::vector<bool> expected;
+    for (CType value : values) {
+      expected.push_back(member_set.count(value) > 0);
+    }
+    std::shared_ptr<Array> expected_array;
+    ArrayFromVector<BooleanType, bool>(is_valid, expected, &expected_array);
+
+    // Sliced inputs and reuse of the value set
+    for (int64_t offset : {0, 3}) {
+      Datum out;
+      ASSERT_OK(IsIn(&this->ctx_, left->Slice(offset), *value_set, &out));
+      AssertArraysEqual(*expected_array->Slice(offset), *out.make_array());
+    }
+  }
+};
+
+typedef ::testing::Types<Int8Type, UInt8Type, Int16Type, UInt32Type, Int64Type,
+                         UInt64Type, Date32Type, Date64Type>
+    IntegerLikeTypes;
+
+TYPED_TEST_CASE(TestIsInKernelStrategies, IntegerLikeTypes);
+
+TYPED_TEST(TestIsInKernelStrategies, SmallSet) {
+  using CType = typename TypeParam::c_type;
+  this->Check({5, 3, 120}, IsInValueSet::SMALL_SET);
+  this->Check({0, 1, 2, 3, 4, 5, 6, 127}, IsInValueSet::SMALL_SET);
+  this->Check({std::numeric_limits<CType>::min(), std::numeric_limits<CType>::max()},
+              IsInValueSet::SMALL_SET);
+}
+
+TYPED_TEST(TestIsInKernelStrategies, Bitmap) {
+  using CType = typename TypeParam::c_type;
+  std::vector<CType> members;
+  for (int i = 0; i < 50; i++) {
+    members.push_back(static_cast<CType>(i * 2 + 3));
+  }
+  this->Check(members, IsInValueSet::BITMAP);
+  // The whole domain of 8-bit integers
+  if (sizeof(CType) == 1) {
+    members.push_back(std::numeric_limits<CType>::min());
+    members.push_back(std::numeric_limits<CType>::max());
+    this->Check(members, IsInValueSet::BITMAP);
+  }
+}
+
+TYPED_TEST(TestIsInKernelStrategies, HashTable) {
+  using CType = typename TypeParam::c_type;
+  if (sizeof(CType) < 4) {
+    return;
+  }
+  std::vector<CType> members;
+  for (int i = 0; i < 50; i++) {
+    members.push_back(static_cast<CType>(i * 100003));
+  }
+  this->Check(members, IsInValueSet::HASH_TABLE);
+}
+
+TEST_F(TestIsInKernel, PerfectHash) {
+  std::vector<std::string> members;
+  for (int i = 0; i < 64; i++) {
+    members.push_back(std::string(i % 5, 'x') + std::to_string(i));
+  }
+  std::shared_ptr<Array> member_array, left;
+  ArrayFromVector<StringType, std::string>(members, &member_array);
+  std::shared_ptr<IsInValueSet> value_set;
+  ASSERT_OK(IsInValueSet::Make(&this->ctx_, member_array, &value_set));
+  ASSERT_EQ(value_set->strategy(), IsInValueSet::PERFECT_HASH);
+
+  std::vector<std::string> values;
+  std::vector<bool> expected;
+  for (int i = 0; i < 128; i++) {
+    values.push_back(std::string(i % 5, 'x') + std::to_string(i));
+    expected.push_back(i < 64);
+  }
+  values.push_back("");
+  expected.push_back(false);
+  ArrayFromVector<StringType, std::string>(values, &left);
+
+  Datum out;
+  ASSERT_OK(IsIn(&this->ctx_, left, *value_set, &out));
+  std::shared_ptr<Array> expected_array;
+  ArrayFromVector<BooleanType, bool>(expected, &expected_array);
+  AssertArraysEqual(*expected_array, *out.make_array());
+
+  // Too many values for a perfect hash
+  members.push_back("more");
+  ArrayFromVector<StringType, std::string>(members, &member_array);
+  ASSERT_OK(IsInValueSet::Make(&this->ctx_, member_array, &value_set));
+  ASSERT_EQ(value_set->strategy(), IsInValueSet::HASH_TABLE);
+  ASSERT_OK(IsIn(&this->ctx_, left, *value_set, &out));
+  AssertArraysEqual(*expected_array, *out.make_array());
+}
+
+TEST_F(TestIsInKernel, ValueSetTypeMismatch) {
+  std::shared_ptr<IsInValueSet> value_set;
+  ASSERT_OK(IsInValueSet::Make(&this->ctx_, ArrayFromJSON(int32(), "[1, 2]"),
+                               &value_set));
+  Datum out;
+  ASSERT_RAISES(TypeError,
+                IsIn(&this->ctx_, ArrayFromJSON(int64(), "[1, 2]"), *value_set, &out));
+}
+
 }  // namespace compute
 }  // namespace arrow
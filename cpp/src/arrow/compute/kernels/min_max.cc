@@ -0,0 +1,242 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "arrow/compute/kernels/min_max.h"
+
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernels/min_max_internal.h"
+#include "arrow/compute/kernels/sum_internal.h"
+#include "arrow/scalar.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/cpu_info.h"
+
+namespace arrow {
+namespace compute {
+
+template <typename ArrowType>
+struct MinMaxState {
+  using ThisType = MinMaxState<ArrowType>;
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using SumType = typename FindAccumulatorType<ArrowType>::Type;
+  using SumCType = typename SumType::c_type;
+
+  ThisType& operator+=(const ThisType& rhs) {
+    this->min = rhs.min < this->min ? rhs.min : this->min;
+    this->max = this->max < rhs.max ? rhs.max : this->max;
+    this->sum += rhs.sum;
+    this->count += rhs.count;
+    this->null_count += rhs.null_count;
+
+    return *this;
+  }
+
+  void ConsumeOne(CType value) {
+    this->min = value < this->min ? value : this->min;
+    this->max = this->max < value ? value : this->max;
+    this->sum += value;
+  }
+
+  std::vector<Datum> Finalize() const {
+    using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+    using SumScalarType = typename TypeTraits<SumType>::ScalarType;
+
+    // Null results have zero values rather than the initial bounds
+    const bool is_valid = count > 0;
+    CType min_value = is_valid ? min : CType(0);
+    CType max_value = is_valid ? max : CType(0);
+    // The bounds are still crossed only if all the values were NaN
+    if (std::numeric_limits<CType>::has_quiet_NaN && is_valid && max < min) {
+      min_value = max_value = std::numeric_limits<CType>::quiet_NaN();
+    }
+    std::shared_ptr<Scalar> min_scalar = std::make_shared<ScalarType>(min_value, is_valid);
+    std::shared_ptr<Scalar> max_scalar = std::make_shared<ScalarType>(max_value, is_valid);
+    std::shared_ptr<Scalar> sum_scalar = std::make_shared<SumScalarType>(sum, is_valid);
+    std::shared_ptr<Scalar> count_scalar = std::make_shared<Int64Scalar>(count);
+    std::shared_ptr<Scalar> null_count_scalar = std::make_shared<Int64Scalar>(null_count);
+    return {min_scalar, max_scalar, sum_scalar, count_scalar, null_count_scalar};
+  }
+
+  static std::shared_ptr<DataType> out_type() {
+    auto type = TypeTraits<ArrowType>::type_singleton();
+    return struct_({field("min", type), field("max", type),
+                    field("sum", TypeTraits<SumType>::type_singleton()),
+                    field("count", int64()), field("null_count", int64())});
+  }
+
+  // Infinities rather than the largest finite values, so that infinite
+  // values are found
+  CType min = std::numeric_limits<CType>::has_infinity
+                  ? std::numeric_limits<CType>::infinity()
+                  : std::numeric_limits<CType>::max();
+  CType max = std::numeric_limits<CType>::has_infinity
+                  ? -std::numeric_limits<CType>::infinity()
+                  : std::numeric_limits<CType>::lowest();
+  SumCType sum = 0;
+  int64_t count = 0;
+  int64_t null_count = 0;
+};
+
+template <typename ArrowType>
+class MinMaxAggregateFunction final
+    : public AggregateFunctionStaticState<MinMaxState<ArrowType>> {
+  using StateType = MinMaxState<ArrowType>;
+  using CType = typename StateType::CType;
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+ public:
+  Status Consume(const Array& input, StateType* state) const override {
+    const ArrayType& array = static_cast<const ArrayType&>(input);
+    const bool use_avx2 =
+        HaveMinMaxAvx2() &&
+        internal::CpuInfo::GetInstance()->IsSupported(internal::CpuInfo::AVX2);
+
+    StateType local;
+    local.null_count = array.null_count();
+    local.count = array.length() - local.null_count;
+    if (local.null_count == 0) {
+      ConsumeDense(use_avx2, array.raw_values(), array.length(), &local);
+    } else if (local.count > 0) {
+      ConsumeSparse(use_avx2, array, &local);
+    }
+
+    *state += local;
+    return Status::OK();
+  }
+
+  Status Merge(const StateType& src, StateType* dst) const override {
+    *dst += src;
+    return Status::OK();
+  }
+
+  Status Finalize(const StateType& src, Datum* output) const override {
+    *output = src.Finalize();
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return StateType::out_type(); }
+
+ private:
+  static void ConsumeDense(bool use_avx2, const CType* values, int64_t length,
+                           StateType* state) {
+    if (use_avx2) {
+      ConsumeDenseMinMaxAvx2(values, length, &state->min, &state->max, &state->sum);
+    } else {
+      ConsumeDenseMinMax<SimdLevel::NONE>(values, length, &state->min, &state->max,
+                                          &state->sum);
+    }
+  }
+
+  // Runs of valid values covering whole bytes of the bitmap are consumed as
+  // dense values, the others one at a time
+  static void ConsumeSparse(bool use_avx2, const ArrayType& array, StateType* state) {
+    const CType* values = array.raw_values();
+    const uint8_t* bitmap = array.null_bitmap_data();
+    const int64_t offset = array.offset();
+    const int64_t length = array.length();
+
+    int64_t i = 0;
+    // Values up to the first byte boundary of the bitmap
+    for (; i < length && (offset + i) % 8 != 0; i++) {
+      if (BitUtil::GetBit(bitmap, offset + i)) {
+        state->ConsumeOne(values[i]);
+      }
+    }
+    while (i + 8 <= length) {
+      const uint8_t bits = bitmap[(offset + i) / 8];
+      if (bits == 0xFF) {
+        int64_t end = i + 8;
+        while (end + 8 <= length && bitmap[(offset + end) / 8] == 0xFF) {
+          end += 8;
+        }
+        ConsumeDense(use_avx2, values + i, end - i, state);
+        i = end;
+        continue;
+      }
+      for (int bit = 0; bits != 0 && bit < 8; bit++) {
+        if (bits & (1 << bit)) {
+          state->ConsumeOne(values[i + bit]);
+        }
+      }
+      i += 8;
+    }
+    for (; i < length; i++) {
+      if (BitUtil::GetBit(bitmap, offset + i)) {
+        state->ConsumeOne(values[i]);
+      }
+    }
+  }
+};
+
+#define MIN_MAX_AGG_FN_CASE(T)                          \
+  case T::type_id:                                      \
+    return std::static_pointer_cast<AggregateFunction>( \
+        std::make_shared<MinMaxAggregateFunction<T>>());
+
+std::shared_ptr<AggregateFunction> MakeMinMaxAggregateFunction(const DataType& type,
+                                                               FunctionContext* ctx) {
+  switch (type.id()) {
+    MIN_MAX_AGG_FN_CASE(UInt8Type);
+    MIN_MAX_AGG_FN_CASE(Int8Type);
+    MIN_MAX_AGG_FN_CASE(UInt16Type);
+    MIN_MAX_AGG_FN_CASE(Int16Type);
+    MIN_MAX_AGG_FN_CASE(UInt32Type);
+    MIN_MAX_AGG_FN_CASE(Int32Type);
+    MIN_MAX_AGG_FN_CASE(UInt64Type);
+    MIN_MAX_AGG_FN_CASE(Int64Type);
+    MIN_MAX_AGG_FN_CASE(FloatType);
+    MIN_MAX_AGG_FN_CASE(DoubleType);
+    default:
+      return nullptr;
+  }
+
+#undef MIN_MAX_AGG_FN_CASE
+}
+
+Status SummaryStatistics(FunctionContext* ctx, const Datum& value, Datum* out) {
+  auto data_type = value.type();
+  if (data_type == nullptr)
+    return Status::Invalid("Datum must be array-like");
+  else if (!is_integer(data_type->id()) && !is_floating(data_type->id()))
+    return Status::Invalid("Datum must contain a NumericType");
+
+  std::shared_ptr<AggregateFunction> aggregate =
+      MakeMinMaxAggregateFunction(*data_type, ctx);
+  if (!aggregate) return Status::Invalid("No min/max for type ", *data_type);
+
+  return AggregateUnaryKernel(aggregate).Call(ctx, value, out);
+}
+
+Status MinMax(FunctionContext* ctx, const Datum& value, Datum* out) {
+  Datum statistics;
+  RETURN_NOT_OK(SummaryStatistics(ctx, value, &statistics));
+
+  const auto& values = statistics.collection();
+  *out = std::vector<Datum>{values[0], values[1]};
+  return Status::OK();
+}
+
+Status MinMax(FunctionContext* ctx, const Array& array, Datum* out) {
+  return MinMax(ctx, array.data(), out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,87 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+class Status;
+
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+class AggregateFunction;
+
+/// \brief Return an aggregate computing min, max, sum, count and null count
+///
+/// All the statistics are computed in a single pass over the values and the
+/// validity bitmap. The state is finalized to a collection Datum of scalars
+/// [min, max, sum, count, null_count]; min, max and sum are null if there are
+/// no non-null values. NaN values are ignored by min and max, which are NaN
+/// only if all the non-null values are NaN.
+///
+/// \param[in] type required to specialize the kernel
+/// \param[in] context the FunctionContext
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeMinMaxAggregateFunction(const DataType& type,
+                                                               FunctionContext* context);
+
+/// \brief Compute the minimum and maximum values of a numeric array.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value datum to aggregate, expecting Array or ChunkedArray
+/// \param[out] out collection datum of [min, max] scalars, which are null if
+///             there are no non-null values
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status MinMax(FunctionContext* context, const Datum& value, Datum* out);
+
+/// \brief Compute the minimum and maximum values of a numeric array.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] array to aggregate
+/// \param[out] out collection datum of [min, max] scalars
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status MinMax(FunctionContext* context, const Array& array, Datum* out);
+
+/// \brief Compute min, max, sum, count and null count of a numeric array in a
+/// single pass.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value datum to aggregate, expecting Array or ChunkedArray
+/// \param[out] out collection datum of [min, max, sum, count, null_count]
+///             scalars, see MakeMinMaxAggregateFunction
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status SummaryStatistics(FunctionContext* context, const Datum& value, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
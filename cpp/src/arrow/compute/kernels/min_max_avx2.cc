@@ -0,0 +1,55 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+// This file is compiled with -mavx2 when the compiler supports it. It must
+// only contain code which is run after checking that the CPU supports AVX2.
+
+#include "arrow/compute/kernels/min_max_internal.h"
+
+namespace arrow {
+namespace compute {
+
+bool HaveMinMaxAvx2() {
+#ifdef __AVX2__
+  return true;
+#else
+  return false;
+#endif
+}
+
+#define DEFINE_MIN_MAX_AVX2(CType, SumCType)                                   \
+  void ConsumeDenseMinMaxAvx2(const CType* values, int64_t length, CType* min, \
+                              CType* max, SumCType* sum) {                     \
+    ConsumeDenseMinMax<SimdLevel::AVX2>(values, length, min, max, sum);        \
+  }
+
+DEFINE_MIN_MAX_AVX2(uint8_t, uint64_t)
+DEFINE_MIN_MAX_AVX2(int8_t, int64_t)
+DEFINE_MIN_MAX_AVX2(uint16_t, uint64_t)
+DEFINE_MIN_MAX_AVX2(int16_t, int64_t)
+DEFINE_MIN_MAX_AVX2(uint32_t, uint64_t)
+DEFINE_MIN_MAX_AVX2(int32_t, int64_t)
+DEFINE_MIN_MAX_AVX2(uint64_t, uint64_t)
+DEFINE_MIN_MAX_AVX2(int64_t, int64_t)
+DEFINE_MIN_MAX_AVX2(float, double)
+DEFINE_MIN_MAX_AVX2(double, double)
+
+#undef DEFINE_MIN_MAX_AVX2
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <cstdint>
+
+namespace arrow {
+namespace compute {
+
+enum class SimdLevel { NONE, AVX2 };
+
+// Update min, max and sum with values which are all valid.
+//
+// The values are reduced in independent lanes, which lets the compiler
+// vectorize the loop, floating point sums included. The function is
+// instantiated once per SimdLevel, so that the copy compiled with wider
+// instructions is never picked in place of the portable one. For the same
+// reason it must not call other inline functions.
+template <SimdLevel Level, typename CType, typename SumCType>
+void ConsumeDenseMinMax(const CType* values, int64_t length, CType* min, CType* max,
+                        SumCType* sum) {
+  constexpr int kLanes = 8;
+  CType lane_min[kLanes];
+  CType lane_max[kLanes];
+  SumCType lane_sum[kLanes];
+  for (int j = 0; j < kLanes; j++) {
+    lane_min[j] = *min;
+    lane_max[j] = *max;
+    lane_sum[j] = 0;
+  }
+
+  int64_t i = 0;
+  for (; i + kLanes <= length; i += kLanes) {
+    for (int j = 0; j < kLanes; j++) {
+      const CType value = values[i + j];
+      lane_min[j] = value < lane_min[j] ? value : lane_min[j];
+      lane_max[j] = lane_max[j] < value ? value : lane_max[j];
+      lane_sum[j] += value;
+    }
+  }
+  for (; i < length; i++) {
+    const CType value = values[i];
+    lane_min[0] = value < lane_min[0] ? value : lane_min[0];
+    lane_max[0] = lane_max[0] < value ? value : lane_max[0];
+    lane_sum[0] += value;
+  }
+
+  for (int j = 0; j < kLanes; j++) {
+    *min = lane_min[j] < *min ? lane_min[j] : *min;
+    *max = *max < lane_max[j] ? lane_max[j] : *max;
+    *sum += lane_sum[j];
+  }
+}
+
+// Whether min_max_avx2.cc was compiled with AVX2 enabled
+bool HaveMinMaxAvx2();
+
+// ConsumeDenseMinMax compiled with AVX2, only callable if HaveMinMaxAvx2() and
+// the CPU supports AVX2
+#define DECLARE_MIN_MAX_AVX2(CType, SumCType)                                  \
+  void ConsumeDenseMinMaxAvx2(const CType* values, int64_t length, CType* min, \
+                              CType* max, SumCType* sum)
+
+DECLARE_MIN_MAX_AVX2(uint8_t, uint64_t);
+DECLARE_MIN_MAX_AVX2(int8_t, int64_t);
+DECLARE_MIN_MAX_AVX2(uint16_t, uint64_t);
+DECLARE_MIN_MAX_AVX2(int16_t, int64_t);
+DECLARE_MIN_MAX_AVX2(uint32_t, uint64_t);
+DECLARE_MIN_MAX_AVX2(int32_t, int64_t);
+DECLARE_MIN_MAX_AVX2(uint64_t, uint64_t);
+DECLARE_MIN_MAX_AVX2(int64_t, int64_t);
+DECLARE_MIN_MAX_AVX2(float, double);
+DECLARE_MIN_MAX_AVX2(double, double);
+
+#undef DECLARE_MIN_MAX_AVX2
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,519 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "arrow/compute/kernels/selection.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace compute {
+
+using internal::checked_cast;
+
+namespace {
+
+constexpr int64_t kMaxInt16Length = static_cast<int64_t>(1) << 15;
+constexpr int64_t kMaxInt32Length = static_cast<int64_t>(1) << 31;
+
+// Selected indices are written to a buffer sized for the largest possible
+// selection, which is shrunk once the number of selected rows is known
+template <typename IndexCType>
+class IndexBuilder {
+ public:
+  Status Init(FunctionContext* ctx, int64_t max_selected) {
+    return AllocateResizableBuffer(ctx->memory_pool(), max_selected * sizeof(IndexCType),
+                                   &buffer_);
+  }
+
+  IndexCType* mutable_data() {
+    return reinterpret_cast<IndexCType*>(buffer_->mutable_data());
+  }
+
+  Status Finish(int64_t length, int64_t num_selected,
+                std::shared_ptr<SelectionVector>* out) {
+    RETURN_NOT_OK(buffer_->Resize(num_selected * sizeof(IndexCType)));
+    auto data = ArrayData::Make(SelectionVector::IndexType(length), num_selected,
+                                {nullptr, buffer_}, /*null_count=*/0);
+    *out = std::make_shared<SelectionVector>(length, MakeArray(data));
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<ResizableBuffer> buffer_;
+};
+
+template <typename IndexCType>
+const IndexCType* GetIndices(const SelectionVector& selection) {
+  return selection.indices()->data()->GetValues<IndexCType>(1);
+}
+
+// Call Impl<IndexCType>::Exec with the C type of the indices selecting from
+// length rows
+template <template <typename> class Impl, typename... Args>
+Status VisitIndexType(int64_t length, Args&&... args) {
+  if (length <= kMaxInt16Length) {
+    return Impl<int16_t>::Exec(std::forward<Args>(args)...);
+  } else if (length <= kMaxInt32Length) {
+    return Impl<int32_t>::Exec(std::forward<Args>(args)...);
+  }
+  return Impl<int64_t>::Exec(std::forward<Args>(args)...);
+}
+
+template <typename IndexCType>
+struct CheckIndicesImpl {
+  static Status Exec(const SelectionVector& selection) {
+    const IndexCType* indices = GetIndices<IndexCType>(selection);
+    int64_t previous = -1;
+    for (int64_t i = 0; i < selection.num_selected(); i++) {
+      if (indices[i] <= previous || indices[i] >= selection.length()) {
+        return Status::Invalid("Selection vector indices must be increasing and less ",
+                               "than ", selection.length());
+      }
+      previous = indices[i];
+    }
+    return Status::OK();
+  }
+};
+
+template <typename IndexCType>
+struct AllImpl {
+  static Status Exec(FunctionContext* ctx, int64_t length,
+                     std::shared_ptr<SelectionVector>* out) {
+    IndexBuilder<IndexCType> builder;
+    RETURN_NOT_OK(builder.Init(ctx, length));
+    IndexCType* indices = builder.mutable_data();
+    for (int64_t i = 0; i < length; i++) {
+      indices[i] = static_cast<IndexCType>(i);
+    }
+    return builder.Finish(length, length, out);
+  }
+};
+
+template <typename IndexCType>
+struct FromFilterImpl {
+  static Status Exec(FunctionContext* ctx, const BooleanArray& filter,
+                     std::shared_ptr<SelectionVector>* out) {
+    const int64_t length = filter.length();
+    IndexBuilder<IndexCType> builder;
+    RETURN_NOT_OK(builder.Init(ctx, length));
+    IndexCType* indices = builder.mutable_data();
+
+    // Every index is written, but only kept if selected, which avoids
+    // branching on the filter values
+    int64_t num_selected = 0;
+    internal::BitmapReader value_reader(filter.values()->data(), filter.offset(), length);
+    if (filter.null_count() == 0) {
+      for (int64_t i = 0; i < length; i++) {
+        indices[num_selected] = static_cast<IndexCType>(i);
+        num_selected += value_reader.IsSet();
+        value_reader.Next();
+      }
+    } else {
+      internal::BitmapReader valid_reader(filter.null_bitmap_data(), filter.offset(),
+                                          length);
+      for (int64_t i = 0; i < length; i++) {
+        indices[num_selected] = static_cast<IndexCType>(i);
+        num_selected += value_reader.IsSet() && valid_reader.IsSet();
+        value_reader.Next();
+        valid_reader.Next();
+      }
+    }
+    return builder.Finish(length, num_selected, out);
+  }
+};
+
+template <typename IndexCType>
+struct ToFilterImpl {
+  static Status Exec(FunctionContext* ctx, const SelectionVector& selection,
+                     std::shared_ptr<Array>* out) {
+    std::shared_ptr<Buffer> bitmap;
+    RETURN_NOT_OK(AllocateEmptyBitmap(ctx->memory_pool(), selection.length(), &bitmap));
+    const IndexCType* indices = GetIndices<IndexCType>(selection);
+    uint8_t* bits = bitmap->mutable_data();
+    for (int64_t i = 0; i < selection.num_selected(); i++) {
+      BitUtil::SetBit(bits, indices[i]);
+    }
+    *out = std::make_shared<BooleanArray>(selection.length(), bitmap);
+    return Status::OK();
+  }
+};
+
+// Merge two increasing sequences of indices
+template <typename IndexCType>
+struct AndImpl {
+  static Status Exec(FunctionContext* ctx, const SelectionVector& left,
+                     const SelectionVector& right,
+                     std::shared_ptr<SelectionVector>* out) {
+    const IndexCType* left_indices = GetIndices<IndexCType>(left);
+    const IndexCType* right_indices = GetIndices<IndexCType>(right);
+    const int64_t left_length = left.num_selected();
+    const int64_t right_length = right.num_selected();
+
+    IndexBuilder<IndexCType> builder;
+    RETURN_NOT_OK(builder.Init(ctx, std::min(left_length, right_length)));
+    IndexCType* indices = builder.mutable_data();
+    int64_t num_selected = 0;
+    int64_t i = 0, j = 0;
+    while (i < left_length && j < right_length) {
+      if (left_indices[i] < right_indices[j]) {
+        ++i;
+      } else if (right_indices[j] < left_indices[i]) {
+        ++j;
+      } else {
+        indices[num_selected++] = left_indices[i];
+        ++i;
+        ++j;
+      }
+    }
+    return builder.Finish(left.length(), num_selected, out);
+  }
+};
+
+template <typename IndexCType>
+struct OrImpl {
+  static Status Exec(FunctionContext* ctx, const SelectionVector& left,
+                     const SelectionVector& right,
+                     std::shared_ptr<SelectionVector>* out) {
+    const IndexCType* left_indices = GetIndices<IndexCType>(left);
+    const IndexCType* right_indices = GetIndices<IndexCType>(right);
+    const int64_t left_length = left.num_selected();
+    const int64_t right_length = right.num_selected();
+
+    IndexBuilder<IndexCType> builder;
+    RETURN_NOT_OK(
+        builder.Init(ctx, std::min(left_length + right_length, left.length())));
+    IndexCType* indices = builder.mutable_data();
+    int64_t num_selected = 0;
+    int64_t i = 0, j = 0;
+    while (i < left_length && j < right_length) {
+      if (left_indices[i] < right_indices[j]) {
+        indices[num_selected++] = left_indices[i++];
+      } else if (right_indices[j] < left_indices[i]) {
+        indices[num_selected++] = right_indices[j++];
+      } else {
+        indices[num_selected++] = left_indices[i];
+        ++i;
+        ++j;
+      }
+    }
+    for (; i < left_length; i++) {
+      indices[num_selected++] = left_indices[i];
+    }
+    for (; j < right_length; j++) {
+      indices[num_selected++] = right_indices[j];
+    }
+    return builder.Finish(left.length(), num_selected, out);
+  }
+};
+
+// Keep the selected indices for which is_selected(index) is true
+template <typename IndexCType, typename Predicate>
+Status SelectWhere(FunctionContext* ctx, const SelectionVector& selection,
+                   Predicate&& is_selected, std::shared_ptr<SelectionVector>* out) {
+  const IndexCType* selected = GetIndices<IndexCType>(selection);
+  const int64_t length = selection.num_selected();
+
+  IndexBuilder<IndexCType> builder;
+  RETURN_NOT_OK(builder.Init(ctx, length));
+  IndexCType* indices = builder.mutable_data();
+  int64_t num_selected = 0;
+  for (int64_t i = 0; i < length; i++) {
+    const IndexCType index = selected[i];
+    indices[num_selected] = index;
+    num_selected += is_selected(index);
+  }
+  return builder.Finish(selection.length(), num_selected, out);
+}
+
+template <typename Predicate>
+Status SelectWhere(FunctionContext* ctx, const SelectionVector& selection,
+                   Predicate&& is_selected, std::shared_ptr<SelectionVector>* out) {
+  switch (selection.indices()->type_id()) {
+    case Type::INT16:
+      return SelectWhere<int16_t>(ctx, selection, std::forward<Predicate>(is_selected),
+                                  out);
+    case Type::INT32:
+      return SelectWhere<int32_t>(ctx, selection, std::forward<Predicate>(is_selected),
+                                  out);
+    default:
+      return SelectWhere<int64_t>(ctx, selection, std::forward<Predicate>(is_selected),
+                                  out);
+  }
+}
+
+// The validity bitmap of an array, or null if all its values are valid
+const uint8_t* GetValidity(const ArrayData& array) {
+  return array.GetNullCount() == 0 ? nullptr : array.buffers[0]->data();
+}
+
+template <typename T, CompareOperator Op>
+Status CompareSelected(FunctionContext* ctx, const ArrayData& array, T scalar,
+                       const SelectionVector& selection,
+                       std::shared_ptr<SelectionVector>* out) {
+  const T* values = array.GetValues<T>(1);
+  const uint8_t* validity = GetValidity(array);
+  const int64_t offset = array.offset;
+  return SelectWhere(
+      ctx, selection,
+      [=](int64_t index) {
+        return (validity == nullptr || BitUtil::GetBit(validity, offset + index)) &&
+               Comparator<T, Op>::Compare(values[index], scalar);
+      },
+      out);
+}
+
+template <typename T, CompareOperator Op>
+Status CompareSelected(FunctionContext* ctx, const ArrayData& lhs, const ArrayData& rhs,
+                       const SelectionVector& selection,
+                       std::shared_ptr<SelectionVector>* out) {
+  const T* left = lhs.GetValues<T>(1);
+  const T* right = rhs.GetValues<T>(1);
+  const uint8_t* left_validity = GetValidity(lhs);
+  const uint8_t* right_validity = GetValidity(rhs);
+  const int64_t left_offset = lhs.offset;
+  const int64_t right_offset = rhs.offset;
+  return SelectWhere(
+      ctx, selection,
+      [=](int64_t index) {
+        return (left_validity == nullptr ||
+                BitUtil::GetBit(left_validity, left_offset + index)) &&
+               (right_validity == nullptr ||
+                BitUtil::GetBit(right_validity, right_offset + index)) &&
+               Comparator<T, Op>::Compare(left[index], right[index]);
+      },
+      out);
+}
+
+// Compare an array with a Scalar or another Array of C type T
+template <typename T, typename Right>
+Status CompareSelected(FunctionContext* ctx, const ArrayData& left, const Right& right,
+                       CompareOperator op, const SelectionVector& selection,
+                       std::shared_ptr<SelectionVector>* out) {
+  switch (op) {
+    case CompareOperator::EQUAL:
+      return CompareSelected<T, CompareOperator::EQUAL>(ctx, left, right, selection, out);
+    case CompareOperator::NOT_EQUAL:
+      return CompareSelected<T, CompareOperator::NOT_EQUAL>(ctx, left, right, selection,
+                                                            out);
+    case CompareOperator::GREATER:
+      return CompareSelected<T, CompareOperator::GREATER>(ctx, left, right, selection,
+                                                          out);
+    case CompareOperator::GREATER_EQUAL:
+      return CompareSelected<T, CompareOperator::GREATER_EQUAL>(ctx, left, right,
+                                                                selection, out);
+    case CompareOperator::LESS:
+      return CompareSelected<T, CompareOperator::LESS>(ctx, left, right, selection, out);
+    case CompareOperator::LESS_EQUAL:
+      return CompareSelected<T, CompareOperator::LESS_EQUAL>(ctx, left, right, selection,
+                                                             out);
+  }
+  return Status::Invalid("Unknown CompareOperator");
+}
+
+// Dispatch on the logical type, then compare the physical C type, so that
+// e.g. date32 and int32 share their comparisons
+template <typename ArrowType>
+Status CompareSelectedType(FunctionContext* ctx, const Datum& left, const Datum& right,
+                           CompareOperator op, const SelectionVector& selection,
+                           std::shared_ptr<SelectionVector>* out) {
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+  if (left.kind() == Datum::ARRAY && right.kind() == Datum::ARRAY) {
+    return CompareSelected<CType>(ctx, *left.array(), *right.array(), op, selection,
+                                  out);
+  }
+  const bool array_first = left.kind() == Datum::ARRAY;
+  const auto& array = array_first ? *left.array() : *right.array();
+  const auto& scalar =
+      checked_cast<const ScalarType&>(array_first ? *left.scalar() : *right.scalar());
+  if (!scalar.is_valid) {
+    // All comparisons are null
+    return SelectWhere(ctx, selection, [](int64_t) { return false; }, out);
+  }
+  // Comparisons of a scalar with an array are comparisons of the array with the
+  // scalar, with the operator mirrored
+  return CompareSelected<CType>(ctx, array, static_cast<CType>(scalar.value),
+                                array_first ? op : MirrorCompareOperator(op), selection,
+                                out);
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// SelectionVector
+
+SelectionVector::SelectionVector(int64_t length, std::shared_ptr<Array> indices)
+    : length_(length), indices_(std::move(indices)) {}
+
+std::shared_ptr<DataType> SelectionVector::IndexType(int64_t length) {
+  if (length <= kMaxInt16Length) {
+    return int16();
+  } else if (length <= kMaxInt32Length) {
+    return int32();
+  }
+  return int64();
+}
+
+Status SelectionVector::Make(int64_t length, const std::shared_ptr<Array>& indices,
+                             std::shared_ptr<SelectionVector>* out) {
+  if (length < 0) {
+    return Status::Invalid("Selection vector length must be non-negative");
+  }
+  auto index_type = IndexType(length);
+  if (!indices->type()->Equals(*index_type)) {
+    return Status::TypeError("Selection vector indices selecting from ", length,
+                             " rows must be of type ", *index_type, ", got ",
+                             *indices->type());
+  }
+  if (indices->null_count() != 0) {
+    return Status::Invalid("Selection vector indices must not have nulls");
+  }
+  auto selection = std::make_shared<SelectionVector>(length, indices);
+  RETURN_NOT_OK(VisitIndexType<CheckIndicesImpl>(length, *selection));
+  *out = std::move(selection);
+  return Status::OK();
+}
+
+Status SelectionVector::All(FunctionContext* ctx, int64_t length,
+                            std::shared_ptr<SelectionVector>* out) {
+  return VisitIndexType<AllImpl>(length, ctx, length, out);
+}
+
+Status SelectionVector::FromFilter(FunctionContext* ctx, const BooleanArray& filter,
+                                   std::shared_ptr<SelectionVector>* out) {
+  return VisitIndexType<FromFilterImpl>(filter.length(), ctx, filter, out);
+}
+
+Status SelectionVector::ToFilter(FunctionContext* ctx,
+                                 std::shared_ptr<Array>* out) const {
+  return VisitIndexType<ToFilterImpl>(length_, ctx, *this, out);
+}
+
+int64_t SelectionVector::num_selected() const { return indices_->length(); }
+
+// ----------------------------------------------------------------------
+// Kernels
+
+Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
+               struct CompareOptions options, const SelectionVector& selection,
+               std::shared_ptr<SelectionVector>* out) {
+  Datum cast_left, cast_right;
+  RETURN_NOT_OK(UnifyCompareOperands(left, right, &options, &cast_left, &cast_right));
+  auto type = cast_left.type();
+  for (const Datum* operand : {&left, &right}) {
+    if (operand->kind() == Datum::ARRAY) {
+      if (operand->length() != selection.length()) {
+        return Status::Invalid("Selection vector selects from ", selection.length(),
+                               " rows, but the array has ", operand->length());
+      }
+    } else if (operand->kind() != Datum::SCALAR) {
+      return Status::Invalid("Compare expects Array or Scalar operands");
+    }
+  }
+  if (left.kind() != Datum::ARRAY && right.kind() != Datum::ARRAY) {
+    return Status::Invalid("Compare expects at least one Array operand");
+  }
+
+#define COMPARE_SELECTED_CASE(ArrowType)                                              \
+  case ArrowType::type_id:                                                            \
+    return CompareSelectedType<ArrowType>(context, cast_left, cast_right, options.op, \
+                                          selection, out)
+
+  switch (type->id()) {
+    COMPARE_SELECTED_CASE(UInt8Type);
+    COMPARE_SELECTED_CASE(Int8Type);
+    COMPARE_SELECTED_CASE(UInt16Type);
+    COMPARE_SELECTED_CASE(Int16Type);
+    COMPARE_SELECTED_CASE(UInt32Type);
+    COMPARE_SELECTED_CASE(Int32Type);
+    COMPARE_SELECTED_CASE(UInt64Type);
+    COMPARE_SELECTED_CASE(Int64Type);
+    COMPARE_SELECTED_CASE(FloatType);
+    COMPARE_SELECTED_CASE(DoubleType);
+    COMPARE_SELECTED_CASE(Date32Type);
+    COMPARE_SELECTED_CASE(Date64Type);
+    COMPARE_SELECTED_CASE(TimestampType);
+    COMPARE_SELECTED_CASE(Time32Type);
+    COMPARE_SELECTED_CASE(Time64Type);
+    default:
+      break;
+  }
+
+#undef COMPARE_SELECTED_CASE
+
+  return Status::NotImplemented("Compare not implemented for type ", type->ToString());
+}
+
+static Status CheckSameLength(const SelectionVector& left, const SelectionVector& right) {
+  if (left.length() != right.length()) {
+    return Status::Invalid("Selection vectors select from different numbers of rows: ",
+                           left.length(), " vs ", right.length());
+  }
+  return Status::OK();
+}
+
+Status And(FunctionContext* context, const SelectionVector& left,
+           const SelectionVector& right, std::shared_ptr<SelectionVector>* out) {
+  RETURN_NOT_OK(CheckSameLength(left, right));
+  return VisitIndexType<AndImpl>(left.length(), context, left, right, out);
+}
+
+Status Or(FunctionContext* context, const SelectionVector& left,
+          const SelectionVector& right, std::shared_ptr<SelectionVector>* out) {
+  RETURN_NOT_OK(CheckSameLength(left, right));
+  return VisitIndexType<OrImpl>(left.length(), context, left, right, out);
+}
+
+Status Filter(FunctionContext* ctx, const Array& values, const SelectionVector& selection,
+              std::shared_ptr<Array>* out) {
+  if (values.length() != selection.length()) {
+    return Status::Invalid("Selection vector selects from ", selection.length(),
+                           " rows, but the array has ", values.length());
+  }
+  // The indices have no nulls, so Take yields no nulls other than those of values
+  return Take(ctx, values, *selection.indices(), TakeOptions(), out);
+}
+
+Status Filter(FunctionContext* ctx, const RecordBatch& batch,
+              const SelectionVector& selection, std::shared_ptr<RecordBatch>* out) {
+  std::vector<std::shared_ptr<Array>> columns(batch.num_columns());
+  for (int i = 0; i < batch.num_columns(); i++) {
+    RETURN_NOT_OK(Filter(ctx, *batch.column(i), selection, &columns[i]));
+  }
+  *out = RecordBatch::Make(batch.schema(), selection.num_selected(), columns);
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,160 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class BooleanArray;
+class DataType;
+class RecordBatch;
+
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+
+/// \brief The positions of the selected rows of an array or record batch
+///
+/// A selection vector is an alternative to a boolean filter: rather than one
+/// bit per row, it holds the indices of the selected rows, in increasing order
+/// and without nulls. Chained predicates can be evaluated on the selected rows
+/// only, with each predicate narrowing the selection, and the values are only
+/// gathered once at the end by Filter.
+///
+/// Like gandiva::SelectionVector, the width of the indices depends on the
+/// number of rows: int16 for at most 2^15 rows, then int32 and int64.
+///
+/// Selection vectors have no notion of null: a row where a predicate is null
+/// is not selected, as in a SQL WHERE clause.
+class ARROW_EXPORT SelectionVector {
+ public:
+  SelectionVector(int64_t length, std::shared_ptr<Array> indices);
+
+  /// \brief Create a selection vector, checking that the indices are valid
+  ///
+  /// \param[in] length the number of rows the indices select from
+  /// \param[in] indices the selected indices, of type IndexType(length)
+  /// \param[out] out the selection vector
+  static Status Make(int64_t length, const std::shared_ptr<Array>& indices,
+                     std::shared_ptr<SelectionVector>* out);
+
+  /// \brief Select all the rows
+  static Status All(FunctionContext* ctx, int64_t length,
+                    std::shared_ptr<SelectionVector>* out);
+
+  /// \brief Select the rows where a boolean filter is true
+  ///
+  /// Rows where the filter is null are not selected.
+  static Status FromFilter(FunctionContext* ctx, const BooleanArray& filter,
+                           std::shared_ptr<SelectionVector>* out);
+
+  /// \brief The type of the indices selecting from length rows
+  static std::shared_ptr<DataType> IndexType(int64_t length);
+
+  /// \brief Materialize the selection as a boolean filter without nulls
+  Status ToFilter(FunctionContext* ctx, std::shared_ptr<Array>* out) const;
+
+  /// \brief The number of rows the indices select from
+  int64_t length() const { return length_; }
+
+  /// \brief The number of selected rows
+  int64_t num_selected() const;
+
+  /// \brief The selected indices, an integer array of type IndexType(length())
+  const std::shared_ptr<Array>& indices() const { return indices_; }
+
+ private:
+  int64_t length_;
+  std::shared_ptr<Array> indices_;
+};
+
+/// \brief Compare the selected rows of two datums
+///
+/// This is the selection vector equivalent of Compare followed by And with
+/// the selection: only the selected rows are compared, and the output selects
+/// those where the comparison is true.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left datum to compare, an Array or a Scalar
+/// \param[in] right datum to compare, an Array or a Scalar of the same type, or
+///            of another numeric type as in Compare
+/// \param[in] options compare options
+/// \param[in] selection rows to compare, selecting from the array operands
+/// \param[out] out the rows of selection where the comparison is true
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
+               struct CompareOptions options, const SelectionVector& selection,
+               std::shared_ptr<SelectionVector>* out);
+
+/// \brief Rows selected by both selection vectors
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left left operand
+/// \param[in] right right operand, selecting from as many rows as left
+/// \param[out] out resulting selection
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status And(FunctionContext* context, const SelectionVector& left,
+           const SelectionVector& right, std::shared_ptr<SelectionVector>* out);
+
+/// \brief Rows selected by either selection vector
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left left operand
+/// \param[in] right right operand, selecting from as many rows as left
+/// \param[out] out resulting selection
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Or(FunctionContext* context, const SelectionVector& left,
+          const SelectionVector& right, std::shared_ptr<SelectionVector>* out);
+
+/// \brief Gather the selected values of an array
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values array to filter
+/// \param[in] selection rows to keep, selecting from values
+/// \param[out] out resulting array
+ARROW_EXPORT
+Status Filter(FunctionContext* ctx, const Array& values, const SelectionVector& selection,
+              std::shared_ptr<Array>* out);
+
+/// \brief Gather the selected rows of a record batch
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] batch record batch to filter
+/// \param[in] selection rows to keep, selecting from batch
+/// \param[out] out resulting record batch
+ARROW_EXPORT
+Status Filter(FunctionContext* ctx, const RecordBatch& batch,
+              const SelectionVector& selection, std::shared_ptr<RecordBatch>* out);
+
+}  // namespace compute
+}  // namespace arrow
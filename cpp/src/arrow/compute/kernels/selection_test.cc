@@ -0,0 +1,258 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/kernels/filter.h"
+#include "arrow/compute/kernels/selection.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+using internal::checked_cast;
+using internal::checked_pointer_cast;
+
+class TestSelectionVector : public ComputeFixture, public TestBase {
+ protected:
+  std::shared_ptr<SelectionVector> FromFilter(const std::string& json) {
+    std::shared_ptr<SelectionVector> selection;
+    auto filter = ArrayFromJSON(boolean(), json);
+    ABORT_NOT_OK(SelectionVector::FromFilter(
+        &ctx_, checked_cast<const BooleanArray&>(*filter), &selection));
+    return selection;
+  }
+
+  std::shared_ptr<SelectionVector> All(int64_t length) {
+    std::shared_ptr<SelectionVector> selection;
+    ABORT_NOT_OK(SelectionVector::All(&ctx_, length, &selection));
+    return selection;
+  }
+
+  void AssertSelection(const SelectionVector& selection, const std::string& expected) {
+    ASSERT_OK(selection.indices()->Validate());
+    ASSERT_TRUE(selection.indices()->type()->Equals(
+        SelectionVector::IndexType(selection.length())));
+    AssertArraysEqual(*ArrayFromJSON(selection.indices()->type(), expected),
+                      *selection.indices());
+  }
+
+  // Compare the selected rows, and check that the output is the selection of
+  // the materialized comparison
+  void AssertCompare(const Datum& left, const Datum& right, CompareOperator op,
+                     const SelectionVector& selection) {
+    std::shared_ptr<SelectionVector> actual;
+    ASSERT_OK(Compare(&ctx_, left, right, CompareOptions(op), selection, &actual));
+
+    Datum filter;
+    ASSERT_OK(Compare(&ctx_, left, right, CompareOptions(op), &filter));
+    std::shared_ptr<SelectionVector> compared, expected;
+    ASSERT_OK(SelectionVector::FromFilter(
+        &ctx_, checked_cast<const BooleanArray&>(*filter.make_array()), &compared));
+    ASSERT_OK(And(&ctx_, *compared, selection, &expected));
+    AssertArraysEqual(*expected->indices(), *actual->indices());
+  }
+};
+
+TEST_F(TestSelectionVector, IndexType) {
+  ASSERT_TRUE(SelectionVector::IndexType(0)->Equals(int16()));
+  ASSERT_TRUE(SelectionVector::IndexType(1 << 15)->Equals(int16()));
+  ASSERT_TRUE(SelectionVector::IndexType((1 << 15) + 1)->Equals(int32()));
+  ASSERT_TRUE(SelectionVector::IndexType(int64_t(1) << 31)->Equals(int32()));
+  ASSERT_TRUE(SelectionVector::IndexType((int64_t(1) << 31) + 1)->Equals(int64()));
+}
+
+TEST_F(TestSelectionVector, FromFilter) {
+  AssertSelection(*FromFilter("[]"), "[]");
+  AssertSelection(*FromFilter("[true, false, null, true]"), "[0, 3]");
+  AssertSelection(*FromFilter("[null, null]"), "[]");
+
+  auto filter = ArrayFromJSON(boolean(), "[true, false, true, true, false, true]");
+  std::shared_ptr<SelectionVector> selection;
+  ASSERT_OK(SelectionVector::FromFilter(
+      &ctx_, checked_cast<const BooleanArray&>(*filter->Slice(1, 4)), &selection));
+  ASSERT_EQ(selection->length(), 4);
+  AssertSelection(*selection, "[1, 2]");
+
+  std::shared_ptr<Array> materialized;
+  ASSERT_OK(selection->ToFilter(&ctx_, &materialized));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[false, true, true, false]"),
+                    *materialized);
+}
+
+TEST_F(TestSelectionVector, LargeFilter) {
+  auto rand = random::RandomArrayGenerator(0x5e1ec7);
+  const int64_t length = (1 << 15) + 100;
+  auto filter = checked_pointer_cast<BooleanArray>(rand.Boolean(length, 0.5, 0.1));
+
+  std::shared_ptr<SelectionVector> selection;
+  ASSERT_OK(SelectionVector::FromFilter(&ctx_, *filter, &selection));
+  ASSERT_TRUE(selection->indices()->type()->Equals(int32()));
+
+  std::shared_ptr<Array> materialized;
+  ASSERT_OK(selection->ToFilter(&ctx_, &materialized));
+  int64_t num_selected = 0;
+  for (int64_t i = 0; i < length; i++) {
+    const bool selected = filter->IsValid(i) && filter->Value(i);
+    ASSERT_EQ(checked_cast<const BooleanArray&>(*materialized).Value(i), selected);
+    num_selected += selected;
+  }
+  ASSERT_EQ(selection->num_selected(), num_selected);
+}
+
+TEST_F(TestSelectionVector, Make) {
+  std::shared_ptr<SelectionVector> selection;
+  ASSERT_OK(SelectionVector::Make(5, ArrayFromJSON(int16(), "[0, 2, 4]"), &selection));
+  AssertSelection(*selection, "[0, 2, 4]");
+  AssertSelection(*All(3), "[0, 1, 2]");
+
+  ASSERT_RAISES(TypeError,
+                SelectionVector::Make(5, ArrayFromJSON(int32(), "[0]"), &selection));
+  ASSERT_RAISES(Invalid, SelectionVector::Make(5, ArrayFromJSON(int16(), "[0, null]"),
+                                               &selection));
+  ASSERT_RAISES(Invalid,
+                SelectionVector::Make(5, ArrayFromJSON(int16(), "[2, 1]"), &selection));
+  ASSERT_RAISES(Invalid,
+                SelectionVector::Make(5, ArrayFromJSON(int16(), "[1, 1]"), &selection));
+  ASSERT_RAISES(Invalid,
+                SelectionVector::Make(5, ArrayFromJSON(int16(), "[0, 5]"), &selection));
+}
+
+TEST_F(TestSelectionVector, AndOr) {
+  auto left = FromFilter("[true, true, false, false, true, null]");
+  auto right = FromFilter("[false, true, true, null, true, true]");
+  std::shared_ptr<SelectionVector> out;
+  ASSERT_OK(And(&ctx_, *left, *right, &out));
+  AssertSelection(*out, "[1, 4]");
+  ASSERT_OK(Or(&ctx_, *left, *right, &out));
+  AssertSelection(*out, "[0, 1, 2, 4, 5]");
+
+  ASSERT_OK(Or(&ctx_, *FromFilter("[false, false]"), *All(2), &out));
+  AssertSelection(*out, "[0, 1]");
+  ASSERT_OK(And(&ctx_, *FromFilter("[false, false]"), *All(2), &out));
+  AssertSelection(*out, "[]");
+
+  ASSERT_RAISES(Invalid, And(&ctx_, *left, *All(2), &out));
+}
+
+TEST_F(TestSelectionVector, CompareChained) {
+  auto values = ArrayFromJSON(int32(), "[1, 5, null, 7, 3, 9]");
+  auto other = ArrayFromJSON(int32(), "[1, 4, 2, null, 4, 8]");
+
+  // values > 2 and values < 8
+  std::shared_ptr<SelectionVector> selection;
+  ASSERT_OK(Compare(&ctx_, values, Datum(std::make_shared<Int32Scalar>(2)),
+                    CompareOptions(GREATER), *All(6), &selection));
+  AssertSelection(*selection, "[1, 3, 4, 5]");
+  ASSERT_OK(Compare(&ctx_, values, Datum(std::make_shared<Int32Scalar>(8)),
+                    CompareOptions(LESS), *selection, &selection));
+  AssertSelection(*selection, "[1, 3, 4]");
+
+  // 4 < values
+  ASSERT_OK(Compare(&ctx_, Datum(std::make_shared<Int32Scalar>(4)), values,
+                    CompareOptions(LESS), *All(6), &selection));
+  AssertSelection(*selection, "[1, 3, 5]");
+
+  // values >= other
+  ASSERT_OK(Compare(&ctx_, values, other, CompareOptions(GREATER_EQUAL), *All(6),
+                    &selection));
+  AssertSelection(*selection, "[0, 1, 5]");
+
+  // Comparisons with a null scalar are null
+  ASSERT_OK(Compare(&ctx_, values, Datum(std::make_shared<Int32Scalar>(0, false)),
+                    CompareOptions(NOT_EQUAL), *All(6), &selection));
+  AssertSelection(*selection, "[]");
+}
+
+TEST_F(TestSelectionVector, CompareMatchesMaterialized) {
+  auto rand = random::RandomArrayGenerator(0xc0ffee);
+  for (const int64_t length : {int64_t(1000), int64_t(1 << 16)}) {
+    auto left = rand.Int64(length, -10, 10, 0.1);
+    auto right = rand.Int64(length, -10, 10, 0.1);
+    auto doubles = rand.Float64(length, -1, 1, 0.1);
+    auto filter = checked_pointer_cast<BooleanArray>(rand.Boolean(length, 0.7, 0));
+    std::shared_ptr<SelectionVector> selection;
+    ASSERT_OK(SelectionVector::FromFilter(&ctx_, *filter, &selection));
+
+    for (auto op : {EQUAL, NOT_EQUAL, GREATER, GREATER_EQUAL, LESS, LESS_EQUAL}) {
+      Datum scalar(std::make_shared<Int64Scalar>(3));
+      AssertCompare(left, scalar, op, *selection);
+      AssertCompare(scalar, left, op, *selection);
+      AssertCompare(left, right, op, *selection);
+      AssertCompare(doubles, Datum(std::make_shared<DoubleScalar>(0.25)), op,
+                    *selection);
+      // Scalars of another numeric type
+      AssertCompare(left, Datum(std::make_shared<DoubleScalar>(2.5)), op, *selection);
+      AssertCompare(Datum(std::make_shared<Int8Scalar>(-3)), left, op, *selection);
+      AssertCompare(doubles, Datum(std::make_shared<Int32Scalar>(0)), op, *selection);
+    }
+  }
+}
+
+TEST_F(TestSelectionVector, CompareErrors) {
+  auto values = ArrayFromJSON(int32(), "[1, 2, 3]");
+  Datum scalar(std::make_shared<Int32Scalar>(2));
+  std::shared_ptr<SelectionVector> out;
+  ASSERT_RAISES(Invalid, Compare(&ctx_, values, scalar, CompareOptions(EQUAL), *All(4),
+                                 &out));
+  ASSERT_RAISES(Invalid,
+                Compare(&ctx_, scalar, scalar, CompareOptions(EQUAL), *All(3), &out));
+  ASSERT_RAISES(TypeError, Compare(&ctx_, values, ArrayFromJSON(int64(), "[1, 2, 3]"),
+                                   CompareOptions(EQUAL), *All(3), &out));
+  ASSERT_RAISES(NotImplemented,
+                Compare(&ctx_, ArrayFromJSON(utf8(), R"(["a"])"),
+                        ArrayFromJSON(utf8(), R"(["b"])"), CompareOptions(EQUAL),
+                        *All(1), &out));
+}
+
+TEST_F(TestSelectionVector, Filter) {
+  auto values = ArrayFromJSON(utf8(), R"(["a", null, "c", "d", "e"])");
+  auto selection = FromFilter("[true, true, false, null, true]");
+
+  std::shared_ptr<Array> out;
+  ASSERT_OK(Filter(&ctx_, *values, *selection, &out));
+  ASSERT_OK(out->Validate());
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["a", null, "e"])"), *out);
+
+  ASSERT_RAISES(Invalid, Filter(&ctx_, *values, *All(4), &out));
+
+  auto schema = ::arrow::schema({field("s", utf8()), field("i", int8())});
+  auto batch =
+      RecordBatch::Make(schema, 5, {values, ArrayFromJSON(int8(), "[1, 2, 3, 4, 5]")});
+  std::shared_ptr<RecordBatch> filtered;
+  ASSERT_OK(Filter(&ctx_, *batch, *selection, &filtered));
+  ASSERT_OK(filtered->Validate());
+  ASSERT_EQ(filtered->num_rows(), 3);
+  AssertArraysEqual(*ArrayFromJSON(int8(), "[1, 2, 5]"), *filtered->column(1));
+}
+
+}  // namespace compute
+}  // namespace arrow
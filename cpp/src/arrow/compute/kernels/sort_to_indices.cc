@@ -19,13 +19,20 @@
 
 #include <algorithm>
 #include <numeric>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/builder.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/expression.h"
+#include "arrow/compute/kernels/util_internal.h"
 #include "arrow/compute/logical_type.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -33,6 +40,250 @@ class Array;
 
 namespace compute {
 
+namespace {
+
+// Below this length, integers are sorted with std::stable_sort rather than a
+// radix sort
+constexpr int64_t kRadixSortMinLength = 1024;
+// Below this length, sorts run on the calling thread only
+constexpr int64_t kParallelSortMinLength = 1 << 16;
+constexpr int64_t kParallelSortMinChunkLength = 1 << 14;
+
+// Stable sort of the indices in [begin, end). Large ranges are split in chunks
+// sorted on the executor of ctx, which are then merged pairwise, also in parallel.
+template <typename Compare>
+Status ParallelStableSort(FunctionContext* ctx, int64_t* begin, int64_t* end,
+                          const Compare& compare) {
+  const int64_t length = end - begin;
+  const int64_t capacity = ctx->use_threads() ? ctx->executor()->GetCapacity() : 1;
+  const int num_chunks = static_cast<int>(
+      std::min<int64_t>(capacity, length / kParallelSortMinChunkLength));
+  if (length < kParallelSortMinLength || num_chunks < 2) {
+    std::stable_sort(begin, end, compare);
+    return Status::OK();
+  }
+
+  std::vector<int64_t*> bounds;
+  for (int64_t i = 0; i <= num_chunks; i++) {
+    bounds.push_back(begin + length * i / num_chunks);
+  }
+  RETURN_NOT_OK(
+      detail::ParallelForChunks(ctx, num_chunks, length, [&](FunctionContext*, int i) {
+        std::stable_sort(bounds[i], bounds[i + 1], compare);
+        return Status::OK();
+      }));
+
+  // Adjacent chunks are merged in order, which keeps the sort stable
+  while (bounds.size() > 2) {
+    const int num_merges = static_cast<int>(bounds.size() - 1) / 2;
+    RETURN_NOT_OK(
+        detail::ParallelForChunks(ctx, num_merges, length, [&](FunctionContext*, int i) {
+          std::inplace_merge(bounds[2 * i], bounds[2 * i + 1], bounds[2 * i + 2],
+                             compare);
+          return Status::OK();
+        }));
+    std::vector<int64_t*> merged_bounds;
+    for (size_t i = 0; i < bounds.size(); i += 2) {
+      merged_bounds.push_back(bounds[i]);
+    }
+    if (merged_bounds.back() != bounds.back()) {
+      merged_bounds.push_back(bounds.back());
+    }
+    bounds = std::move(merged_bounds);
+  }
+  return Status::OK();
+}
+
+// LSD radix sort of the indices in [begin, end) by their values, one byte at
+// a time. Bytes which are the same for all values are skipped, so that small
+// ranges of values take few passes; 8-bit values take a single counting sort.
+template <typename CType>
+void RadixSort(const CType* values, bool descending, int64_t* begin, int64_t* end) {
+  using UnsignedType = typename std::make_unsigned<CType>::type;
+  constexpr int kBits = sizeof(CType) * 8;
+  // Flipping the sign bit orders signed values as unsigned ones
+  const UnsignedType sign_bit = std::is_signed<CType>::value
+                                    ? static_cast<UnsignedType>(1ULL << (kBits - 1))
+                                    : 0;
+
+  const int64_t length = end - begin;
+  std::vector<UnsignedType> keys(length), sorted_keys(length);
+  std::vector<int64_t> sorted_indices(length);
+  for (int64_t i = 0; i < length; i++) {
+    const UnsignedType key = static_cast<UnsignedType>(values[begin[i]]) ^ sign_bit;
+    keys[i] = descending ? static_cast<UnsignedType>(~key) : key;
+  }
+
+  UnsignedType* src_keys = keys.data();
+  UnsignedType* dest_keys = sorted_keys.data();
+  int64_t* src_indices = begin;
+  int64_t* dest_indices = sorted_indices.data();
+  for (int shift = 0; shift < kBits; shift += 8) {
+    int64_t offsets[257] = {0};
+    for (int64_t i = 0; i < length; i++) {
+      offsets[((src_keys[i] >> shift) & 0xFF) + 1]++;
+    }
+    if (std::find(offsets + 1, offsets + 257, length) != offsets + 257) {
+      continue;
+    }
+    for (int digit = 1; digit < 257; digit++) {
+      offsets[digit] += offsets[digit - 1];
+    }
+    for (int64_t i = 0; i < length; i++) {
+      const int64_t pos = offsets[(src_keys[i] >> shift) & 0xFF]++;
+      dest_keys[pos] = src_keys[i];
+      dest_indices[pos] = src_indices[i];
+    }
+    std::swap(src_keys, dest_keys);
+    std::swap(src_indices, dest_indices);
+  }
+  if (src_indices != begin) {
+    std::copy(src_indices, src_indices + length, begin);
+  }
+}
+
+// Stable sort of indices by the values of one array
+class ColumnSorter {
+ public:
+  virtual ~ColumnSorter() = default;
+
+  virtual Status Sort(FunctionContext* ctx, int64_t* begin, int64_t* end) const = 0;
+};
+
+template <typename ArrowType>
+class ColumnSorterImpl : public ColumnSorter {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+ public:
+  ColumnSorterImpl(const std::shared_ptr<Array>& values, SortKey::Order order,
+                   SortOptions::NullPlacement null_placement)
+      : values_(std::static_pointer_cast<ArrayType>(values)),
+        order_(order),
+        null_placement_(null_placement) {}
+
+  Status Sort(FunctionContext* ctx, int64_t* begin, int64_t* end) const override {
+    const ArrayType& values = *values_;
+    if (values.null_count() > 0) {
+      if (null_placement_ == SortOptions::NULLS_FIRST) {
+        begin = std::stable_partition(
+            begin, end, [&values](int64_t ind) { return values.IsNull(ind); });
+      } else {
+        end = std::stable_partition(
+            begin, end, [&values](int64_t ind) { return !values.IsNull(ind); });
+      }
+    }
+    return SortValues(ctx, begin, end);
+  }
+
+ private:
+  template <typename T = ArrowType>
+  enable_if_integer<T, Status> SortValues(FunctionContext* ctx, int64_t* begin,
+                                          int64_t* end) const {
+    if (end - begin >= kRadixSortMinLength) {
+      RadixSort(values_->raw_values(), order_ == SortKey::DESCENDING, begin, end);
+      return Status::OK();
+    }
+    return CompareSort(ctx, begin, end);
+  }
+
+  template <typename T = ArrowType>
+  typename std::enable_if<!is_integer_type<T>::value, Status>::type SortValues(
+      FunctionContext* ctx, int64_t* begin, int64_t* end) const {
+    return CompareSort(ctx, begin, end);
+  }
+
+  Status CompareSort(FunctionContext* ctx, int64_t* begin, int64_t* end) const {
+    const ArrayType& values = *values_;
+    if (order_ == SortKey::ASCENDING) {
+      return ParallelStableSort(ctx, begin, end, [&values](int64_t left, int64_t right) {
+        return values.GetView(left) < values.GetView(right);
+      });
+    }
+    return ParallelStableSort(ctx, begin, end, [&values](int64_t left, int64_t right) {
+      return values.GetView(right) < values.GetView(left);
+    });
+  }
+
+  std::shared_ptr<ArrayType> values_;
+  SortKey::Order order_;
+  SortOptions::NullPlacement null_placement_;
+};
+
+#define SORT_TO_INDICES_TYPES(ACTION) \
+  ACTION(UINT8, UInt8Type);           \
+  ACTION(INT8, Int8Type);             \
+  ACTION(UINT16, UInt16Type);         \
+  ACTION(INT16, Int16Type);           \
+  ACTION(UINT32, UInt32Type);         \
+  ACTION(INT32, Int32Type);           \
+  ACTION(UINT64, UInt64Type);         \
+  ACTION(INT64, Int64Type);           \
+  ACTION(FLOAT, FloatType);           \
+  ACTION(DOUBLE, DoubleType);         \
+  ACTION(BINARY, BinaryType);         \
+  ACTION(STRING, StringType)
+
+Status MakeColumnSorter(const std::shared_ptr<Array>& values, SortKey::Order order,
+                        SortOptions::NullPlacement null_placement,
+                        std::unique_ptr<ColumnSorter>* out) {
+#define MAKE_COLUMN_SORTER_CASE(TYPE_ID, ARROW_TYPE)                             \
+  case Type::TYPE_ID:                                                            \
+    out->reset(new ColumnSorterImpl<ARROW_TYPE>(values, order, null_placement)); \
+    break
+
+  switch (values->type_id()) {
+    SORT_TO_INDICES_TYPES(MAKE_COLUMN_SORTER_CASE);
+    default:
+      return Status::NotImplemented("Sorting of ", *values->type(), " arrays");
+  }
+
+#undef MAKE_COLUMN_SORTER_CASE
+  return Status::OK();
+}
+
+// Sort the row indices by each sorter, from the least significant one, which
+// gives the lexicographic order since every sort is stable
+Status SortIndices(FunctionContext* ctx, int64_t length,
+                   const std::vector<std::unique_ptr<ColumnSorter>>& sorters,
+                   std::shared_ptr<Array>* offsets) {
+  std::shared_ptr<Buffer> indices_buf;
+  int64_t buf_size = length * sizeof(uint64_t);
+  RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), buf_size, &indices_buf));
+
+  int64_t* indices_begin = reinterpret_cast<int64_t*>(indices_buf->mutable_data());
+  int64_t* indices_end = indices_begin + length;
+
+  std::iota(indices_begin, indices_end, 0);
+  for (auto it = sorters.rbegin(); it != sorters.rend(); ++it) {
+    RETURN_NOT_OK((*it)->Sort(ctx, indices_begin, indices_end));
+  }
+  *offsets = std::make_shared<UInt64Array>(length, indices_buf);
+  return Status::OK();
+}
+
+template <typename GetColumn>
+Status SortRowsToIndices(FunctionContext* ctx, int num_columns, int64_t num_rows,
+                         const std::vector<SortKey>& keys, const SortOptions& options,
+                         GetColumn&& get_column, std::shared_ptr<Array>* offsets) {
+  if (keys.empty()) {
+    return Status::Invalid("Sorting requires at least one key");
+  }
+  std::vector<std::unique_ptr<ColumnSorter>> sorters;
+  for (const auto& key : keys) {
+    if (key.column < 0 || key.column >= num_columns) {
+      return Status::IndexError("Sort key column ", key.column, " out of bounds");
+    }
+    std::shared_ptr<Array> column;
+    RETURN_NOT_OK(get_column(key.column, &column));
+    std::unique_ptr<ColumnSorter> sorter;
+    RETURN_NOT_OK(MakeColumnSorter(column, key.order, options.null_placement, &sorter));
+    sorters.push_back(std::move(sorter));
+  }
+  return SortIndices(ctx, num_rows, sorters, offsets);
+}
+
+}  // namespace
+
 /// \brief UnaryKernel implementing SortToIndices operation
 class ARROW_EXPORT SortToIndicesKernel : public UnaryKernel {
  protected:
@@ -60,26 +311,15 @@ class ARROW_EXPORT SortToIndicesKernel : public UnaryKernel {
                      std::unique_ptr<SortToIndicesKernel>* out);
 };
 
-template <typename ArrayType>
-bool CompareValues(const ArrayType& array, uint64_t lhs, uint64_t rhs) {
-  return array.Value(lhs) < array.Value(rhs);
-}
-
-template <typename ArrayType>
-bool CompareViews(const ArrayType& array, uint64_t lhs, uint64_t rhs) {
-  return array.GetView(lhs) < array.GetView(rhs);
-}
-
-template <typename ArrowType, typename Comparator>
+template <typename ArrowType>
 class SortToIndicesKernelImpl : public SortToIndicesKernel {
-  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
-
  public:
-  explicit SortToIndicesKernelImpl(Comparator compare) : compare_(compare) {}
-
   Status SortToIndices(FunctionContext* ctx, const std::shared_ptr<Array>& values,
                        std::shared_ptr<Array>* offsets) {
-    return SortToIndicesImpl(ctx, std::static_pointer_cast<ArrayType>(values), offsets);
+    std::vector<std::unique_ptr<ColumnSorter>> sorters;
+    sorters.emplace_back(new ColumnSorterImpl<ArrowType>(values, SortKey::ASCENDING,
+                                                         SortOptions::NULLS_LAST));
+    return SortIndices(ctx, values->length(), sorters, offsets);
   }
 
   Status Call(FunctionContext* ctx, const Datum& values, Datum* offsets) {
@@ -94,85 +334,22 @@ class SortToIndicesKernelImpl : public SortToIndicesKernel {
   }
 
   std::shared_ptr<DataType> out_type() const { return type_; }
-
- private:
-  Comparator compare_;
-
-  Status SortToIndicesImpl(FunctionContext* ctx, const std::shared_ptr<ArrayType>& values,
-                           std::shared_ptr<Array>* offsets) {
-    std::shared_ptr<Buffer> indices_buf;
-    int64_t buf_size = values->length() * sizeof(uint64_t);
-    RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), buf_size, &indices_buf));
-
-    int64_t* indices_begin = reinterpret_cast<int64_t*>(indices_buf->mutable_data());
-    int64_t* indices_end = indices_begin + values->length();
-
-    std::iota(indices_begin, indices_end, 0);
-    auto nulls_begin = indices_end;
-    if (values->null_count()) {
-      nulls_begin =
-          std::stable_partition(indices_begin, indices_end,
-                                [&values](uint64_t ind) { return !values->IsNull(ind); });
-    }
-    std::stable_sort(indices_begin, nulls_begin,
-                     [&values, this](uint64_t left, uint64_t right) {
-                       return compare_(*values, left, right);
-                     });
-    *offsets = std::make_shared<UInt64Array>(values->length(), indices_buf);
-    return Status::OK();
-  }
 };
 
-template <typename ArrowType, typename Comparator>
-SortToIndicesKernelImpl<ArrowType, Comparator>* MakeSortToIndicesKernelImpl(
-    Comparator comparator) {
-  return new SortToIndicesKernelImpl<ArrowType, Comparator>(comparator);
-}
-
 Status SortToIndicesKernel::Make(const std::shared_ptr<DataType>& value_type,
                                  std::unique_ptr<SortToIndicesKernel>* out) {
-  SortToIndicesKernel* kernel;
+#define MAKE_KERNEL_CASE(TYPE_ID, ARROW_TYPE)              \
+  case Type::TYPE_ID:                                      \
+    out->reset(new SortToIndicesKernelImpl<ARROW_TYPE>()); \
+    break
+
   switch (value_type->id()) {
-    case Type::UINT8:
-      kernel = MakeSortToIndicesKernelImpl<UInt8Type>(CompareValues<UInt8Array>);
-      break;
-    case Type::INT8:
-      kernel = MakeSortToIndicesKernelImpl<Int8Type>(CompareValues<Int8Array>);
-      break;
-    case Type::UINT16:
-      kernel = MakeSortToIndicesKernelImpl<UInt16Type>(CompareValues<UInt16Array>);
-      break;
-    case Type::INT16:
-      kernel = MakeSortToIndicesKernelImpl<Int16Type>(CompareValues<Int16Array>);
-      break;
-    case Type::UINT32:
-      kernel = MakeSortToIndicesKernelImpl<UInt32Type>(CompareValues<UInt32Array>);
-      break;
-    case Type::INT32:
-      kernel = MakeSortToIndicesKernelImpl<Int32Type>(CompareValues<Int32Array>);
-      break;
-    case Type::UINT64:
-      kernel = MakeSortToIndicesKernelImpl<UInt64Type>(CompareValues<UInt64Array>);
-      break;
-    case Type::INT64:
-      kernel = MakeSortToIndicesKernelImpl<Int64Type>(CompareValues<Int64Array>);
-      break;
-    case Type::FLOAT:
-      kernel = MakeSortToIndicesKernelImpl<FloatType>(CompareValues<FloatArray>);
-      break;
-    case Type::DOUBLE:
-      kernel = MakeSortToIndicesKernelImpl<DoubleType>(CompareValues<DoubleArray>);
-      break;
-    case Type::BINARY:
-      kernel = MakeSortToIndicesKernelImpl<BinaryType>(CompareViews<BinaryArray>);
-      break;
-    case Type::STRING:
-      kernel = MakeSortToIndicesKernelImpl<StringType>(CompareViews<StringArray>);
-      break;
+    SORT_TO_INDICES_TYPES(MAKE_KERNEL_CASE);
     default:
       return Status::NotImplemented("Sorting of ", *value_type, " arrays");
   }
-  out->reset(kernel);
+
+#undef MAKE_KERNEL_CASE
   return Status::OK();
 }
 
@@ -190,5 +367,164 @@ Status SortToIndices(FunctionContext* ctx, const Array& values,
   return Status::OK();
 }
 
+Status SortToIndices(FunctionContext* ctx, const RecordBatch& batch,
+                     const std::vector<SortKey>& keys, const SortOptions& options,
+                     std::shared_ptr<Array>* offsets) {
+  return SortRowsToIndices(ctx, batch.num_columns(), batch.num_rows(), keys, options,
+                           [&](int i, std::shared_ptr<Array>* out) {
+                             *out = batch.column(i);
+                             return Status::OK();
+                           },
+                           offsets);
+}
+
+Status SortToIndices(FunctionContext* ctx, const Table& table,
+                     const std::vector<SortKey>& keys, const SortOptions& options,
+                     std::shared_ptr<Array>* offsets) {
+  // Key columns are made contiguous so that indices are table row numbers
+  return SortRowsToIndices(
+      ctx, table.num_columns(), table.num_rows(), keys, options,
+      [&](int i, std::shared_ptr<Array>* out) {
+        const auto& column = table.column(i);
+        if (column->num_chunks() == 1) {
+          *out = column->chunk(0);
+          return Status::OK();
+        }
+        if (column->num_chunks() == 0) {
+          std::unique_ptr<ArrayBuilder> builder;
+          RETURN_NOT_OK(MakeBuilder(ctx->memory_pool(), column->type(), &builder));
+          return builder->Finish(out);
+        }
+        return Concatenate(column->chunks(), ctx->memory_pool(), out);
+      },
+      offsets);
+}
+
+namespace {
+
+template <typename ArrowType>
+Status TopKImpl(FunctionContext* ctx, const ArrayVector& chunks, int64_t length,
+                const TopKOptions& options, std::shared_ptr<Array>* offsets) {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using ViewType = decltype(std::declval<ArrayType>().GetView(0));
+  // A value along with its index in the whole input
+  using Candidate = std::pair<ViewType, int64_t>;
+
+  const int64_t k = std::min(options.k, length);
+  const bool descending = options.order == SortKey::DESCENDING;
+  // Equal values are ordered by index, as in a stable sort
+  auto less = [descending](const Candidate& left, const Candidate& right) {
+    if (descending ? right.first < left.first : left.first < right.first) {
+      return true;
+    }
+    if (descending ? left.first < right.first : right.first < left.first) {
+      return false;
+    }
+    return left.second < right.second;
+  };
+
+  // Split the input in parts which can be processed in parallel
+  struct Part {
+    const ArrayType* values;
+    // Index of the first value of the chunk in the whole input
+    int64_t chunk_offset;
+    int64_t begin, end;
+  };
+  const int64_t capacity = ctx->use_threads() ? ctx->executor()->GetCapacity() : 1;
+  const int64_t part_length =
+      std::max(kParallelSortMinChunkLength, length / capacity + 1);
+  std::vector<Part> parts;
+  int64_t chunk_offset = 0;
+  for (const auto& chunk : chunks) {
+    const auto values = static_cast<const ArrayType*>(chunk.get());
+    for (int64_t begin = 0; begin < chunk->length(); begin += part_length) {
+      parts.push_back(
+          {values, chunk_offset, begin, std::min(begin + part_length, chunk->length())});
+    }
+    chunk_offset += chunk->length();
+  }
+
+  // Keep the k best values of every part in a heap whose top is the worst
+  std::vector<std::vector<Candidate>> heaps(parts.size());
+  auto select = [&](FunctionContext*, int i) {
+    const Part& part = parts[i];
+    auto& heap = heaps[i];
+    heap.reserve(std::min(k, part.end - part.begin));
+    for (int64_t j = part.begin; j < part.end && k > 0; j++) {
+      if (part.values->IsNull(j)) {
+        continue;
+      }
+      Candidate candidate(part.values->GetView(j), part.chunk_offset + j);
+      if (static_cast<int64_t>(heap.size()) < k) {
+        heap.push_back(candidate);
+        std::push_heap(heap.begin(), heap.end(), less);
+      } else if (less(candidate, heap.front())) {
+        std::pop_heap(heap.begin(), heap.end(), less);
+        heap.back() = candidate;
+        std::push_heap(heap.begin(), heap.end(), less);
+      }
+    }
+    return Status::OK();
+  };
+  RETURN_NOT_OK(detail::ParallelForChunks(ctx, static_cast<int>(parts.size()), length,
+                                          select));
+
+  // Merge the partial results
+  std::vector<Candidate> candidates;
+  for (const auto& heap : heaps) {
+    candidates.insert(candidates.end(), heap.begin(), heap.end());
+  }
+  const int64_t num_values = std::min(k, static_cast<int64_t>(candidates.size()));
+  std::partial_sort(candidates.begin(), candidates.begin() + num_values,
+                    candidates.end(), less);
+
+  std::shared_ptr<Buffer> indices_buf;
+  RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), k * sizeof(uint64_t), &indices_buf));
+  auto indices = reinterpret_cast<uint64_t*>(indices_buf->mutable_data());
+  for (int64_t i = 0; i < num_values; i++) {
+    indices[i] = static_cast<uint64_t>(candidates[i].second);
+  }
+  // Like in a sort, nulls come after all the values
+  int64_t num_indices = num_values;
+  chunk_offset = 0;
+  for (const auto& chunk : chunks) {
+    for (int64_t j = 0; j < chunk->length() && num_indices < k; j++) {
+      if (chunk->IsNull(j)) {
+        indices[num_indices++] = static_cast<uint64_t>(chunk_offset + j);
+      }
+    }
+    chunk_offset += chunk->length();
+  }
+  *offsets = std::make_shared<UInt64Array>(k, indices_buf);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status TopK(FunctionContext* ctx, const ChunkedArray& values, const TopKOptions& options,
+            std::shared_ptr<Array>* offsets) {
+  if (options.k < 0) {
+    return Status::Invalid("TopK requires k >= 0, got ", options.k);
+  }
+#define TOP_K_CASE(TYPE_ID, ARROW_TYPE) \
+  case Type::TYPE_ID:                   \
+    return TopKImpl<ARROW_TYPE>(ctx, values.chunks(), values.length(), options, offsets)
+
+  switch (values.type()->id()) {
+    SORT_TO_INDICES_TYPES(TOP_K_CASE);
+    default:
+      return Status::NotImplemented("Sorting of ", *values.type(), " arrays");
+  }
+
+#undef TOP_K_CASE
+}
+
+Status TopK(FunctionContext* ctx, const Array& values, const TopKOptions& options,
+            std::shared_ptr<Array>* offsets) {
+  return TopK(ctx, ChunkedArray({MakeArray(values.data())}), options, offsets);
+}
+
+#undef SORT_TO_INDICES_TYPES
+
 }  // namespace compute
 }  // namespace arrow
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "arrow/compute/kernel.h"
 #include "arrow/status.h"
@@ -26,11 +27,52 @@
 namespace arrow {
 
 class Array;
+class ChunkedArray;
+class RecordBatch;
+class Table;
 
 namespace compute {
 
 class FunctionContext;
 
+/// \brief A column to sort by, and the order to sort it in
+struct ARROW_EXPORT SortKey {
+  enum Order {
+    ASCENDING = 0,
+    DESCENDING,
+  };
+
+  SortKey(int column, Order order = ASCENDING) : column(column), order(order) {}
+
+  /// Index of the column in the input
+  int column;
+  Order order;
+};
+
+struct ARROW_EXPORT SortOptions {
+  enum NullPlacement {
+    /// Nulls are placed after all the values, whatever the order
+    NULLS_LAST = 0,
+    /// Nulls are placed before all the values, whatever the order
+    NULLS_FIRST,
+  };
+
+  explicit SortOptions(NullPlacement null_placement = NULLS_LAST)
+      : null_placement(null_placement) {}
+
+  NullPlacement null_placement;
+};
+
+struct ARROW_EXPORT TopKOptions {
+  explicit TopKOptions(int64_t k, SortKey::Order order = SortKey::ASCENDING)
+      : k(k), order(order) {}
+
+  /// Number of indices to return
+  int64_t k;
+  /// ASCENDING selects the smallest values, DESCENDING the largest ones
+  SortKey::Order order;
+};
+
 /// \brief Returns the indices that would sort an array.
 ///
 /// Perform an indirect sort of array. The output array will contain
@@ -40,6 +82,9 @@ class FunctionContext;
 /// For example given values = [null, 1, 3.3, null, 2, 5.3], the output
 /// will be [1, 4, 2, 5, 0, 3]
 ///
+/// Integer arrays are radix sorted, other arrays are sorted with a stable
+/// merge sort, in parallel on the CPU thread pool for large arrays.
+///
 /// \param[in] ctx the FunctionContext
 /// \param[in] values array to sort
 /// \param[out] offsets indices that would sort an array
@@ -47,5 +92,69 @@ ARROW_EXPORT
 Status SortToIndices(FunctionContext* ctx, const Array& values,
                      std::shared_ptr<Array>* offsets);
 
+/// \brief Returns the indices that would sort the rows of a record batch.
+///
+/// The rows are sorted lexicographically by the key columns: by the first key,
+/// then the rows with equal first keys by the second key, and so on. The sort
+/// is stable, rows with equal keys keep their order.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] batch record batch to sort
+/// \param[in] keys the columns to sort by, from the most significant
+/// \param[in] options the sort options
+/// \param[out] offsets indices that would sort the batch
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* ctx, const RecordBatch& batch,
+                     const std::vector<SortKey>& keys, const SortOptions& options,
+                     std::shared_ptr<Array>* offsets);
+
+/// \brief Returns the indices that would sort the rows of a table.
+///
+/// The indices are row numbers in the whole table, see the RecordBatch
+/// overload for the sort order.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] table table to sort
+/// \param[in] keys the columns to sort by, from the most significant
+/// \param[in] options the sort options
+/// \param[out] offsets indices that would sort the table
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* ctx, const Table& table,
+                     const std::vector<SortKey>& keys, const SortOptions& options,
+                     std::shared_ptr<Array>* offsets);
+
+/// \brief Returns the indices of the k first values of an array in sort order.
+///
+/// The output is the same as the first k indices returned by a stable sort in
+/// the given order, with nulls at the end, but the values are only partially
+/// sorted: each part of the array keeps its k best values in a bounded heap.
+/// Large arrays are split in parts processed in parallel on the CPU thread pool,
+/// whose results are then merged.
+///
+/// For example given values = [null, 1, 3.3, null, 2, 5.3] and k = 3, the
+/// output will be [1, 4, 2]
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values array to select from
+/// \param[in] options the number of indices to return and the order
+/// \param[out] offsets the min(k, length) selected indices, in sort order
+ARROW_EXPORT
+Status TopK(FunctionContext* ctx, const Array& values, const TopKOptions& options,
+            std::shared_ptr<Array>* offsets);
+
+/// \brief Returns the indices of the k first values of a chunked array in sort
+/// order.
+///
+/// The indices are positions in the whole chunked array, see the Array
+/// overload.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values chunked array to select from
+/// \param[in] options the number of indices to return and the order
+/// \param[out] offsets the min(k, length) selected indices, in sort order
+ARROW_EXPORT
+Status TopK(FunctionContext* ctx, const ChunkedArray& values, const TopKOptions& options,
+            std::shared_ptr<Array>* offsets);
+
 }  // namespace compute
 }  // namespace arrow
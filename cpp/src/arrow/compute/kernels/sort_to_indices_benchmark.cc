@@ -49,11 +49,34 @@ static void SortToIndicesInt64(benchmark::State& state) {
   SortToIndicesBenchmark(state, values);
 }
 
+static void TopKInt64(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+  auto rand = random::RandomArrayGenerator(kSeed);
+
+  auto values = rand.Int64(array_size, -100, 100, args.null_proportion);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(TopK(&ctx, *values, TopKOptions(100), &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
 BENCHMARK(SortToIndicesInt64)
     ->Apply(RegressionSetArgs)
     ->Args({1 << 20, 1})
     ->Args({1 << 23, 1})
     ->MinTime(1.0)
     ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(TopKInt64)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->Args({1 << 23, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
 }  // namespace compute
 }  // namespace arrow
@@ -23,15 +23,20 @@
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/sort_to_indices.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
 
 namespace arrow {
 namespace compute {
 
+using internal::checked_cast;
+
 template <typename ArrowType>
 class TestSortToIndicesKernel : public ComputeFixture, public TestBase {
  private:
@@ -191,5 +196,165 @@ TYPED_TEST(TestSortToIndicesKernelRandom, SortRandomValues) {
   }
 }
 
+// Long enough to be sorted in parallel chunks
+TYPED_TEST(TestSortToIndicesKernelRandom, SortLargeRandomValues) {
+  using ArrayType = typename TypeTraits<TypeParam>::ArrayType;
+
+  Random<TypeParam> rand(0x5487656);
+  auto array = rand.Generate(1 << 17, 0.1);
+  std::shared_ptr<Array> offsets;
+  ASSERT_OK(arrow::compute::SortToIndices(&this->ctx_, *array, &offsets));
+  ASSERT_EQ(offsets->length(), array->length());
+  ValidateSorted<ArrayType>(*std::static_pointer_cast<ArrayType>(array),
+                            *std::static_pointer_cast<UInt64Array>(offsets));
+}
+
+class TestSortToIndicesKernelMultiKey : public ComputeFixture, public TestBase {
+ protected:
+  void SetUp() override {
+    schema_ = ::arrow::schema(
+        {field("a", int32()), field("b", utf8()), field("c", float64())});
+    batch_ = RecordBatch::Make(
+        schema_, 6,
+        {ArrayFromJSON(int32(), "[2, 1, null, 2, 1, 2]"),
+         ArrayFromJSON(utf8(), R"(["x", "y", "z", null, "y", "w"])"),
+         ArrayFromJSON(float64(), "[1.5, 2.5, 0.5, 3.5, null, 1.5]")});
+  }
+
+  void AssertSortToIndices(const RecordBatch& batch, const std::vector<SortKey>& keys,
+                           const SortOptions& options, const std::string& expected) {
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(SortToIndices(&this->ctx_, batch, keys, options, &actual));
+    ASSERT_OK(actual->Validate());
+    AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+  }
+
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<RecordBatch> batch_;
+};
+
+TEST_F(TestSortToIndicesKernelMultiKey, SortRecordBatch) {
+  AssertSortToIndices(*batch_, {{0}, {1}}, SortOptions(), "[1, 4, 5, 0, 3, 2]");
+  AssertSortToIndices(*batch_, {{0}, {1, SortKey::DESCENDING}}, SortOptions(),
+                      "[1, 4, 0, 5, 3, 2]");
+  AssertSortToIndices(*batch_, {{0, SortKey::DESCENDING}, {1}}, SortOptions(),
+                      "[5, 0, 3, 1, 4, 2]");
+  AssertSortToIndices(*batch_, {{0}, {1}}, SortOptions(SortOptions::NULLS_FIRST),
+                      "[2, 1, 4, 3, 5, 0]");
+  AssertSortToIndices(*batch_, {{2, SortKey::DESCENDING}, {0}}, SortOptions(),
+                      "[3, 1, 0, 5, 2, 4]");
+}
+
+TEST_F(TestSortToIndicesKernelMultiKey, SortTable) {
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches({batch_->Slice(0, 2), batch_->Slice(2, 3),
+                                      batch_->Slice(5)},
+                                     &table));
+  std::shared_ptr<Array> actual;
+  ASSERT_OK(SortToIndices(&this->ctx_, *table, {{0}, {1}}, SortOptions(), &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[1, 4, 5, 0, 3, 2]"), *actual);
+}
+
+TEST_F(TestSortToIndicesKernelMultiKey, SortLargeIntegers) {
+  // Radix sorted keys must keep the order of equal values
+  auto rand = random::RandomArrayGenerator(0x5487657);
+  const int64_t length = 5000;
+  auto batch = RecordBatch::Make(
+      ::arrow::schema({field("a", int16()), field("b", int64())}), length,
+      {rand.Int16(length, -3, 3, 0.1), rand.Int64(length, -1000000, 1000000, 0)});
+
+  std::shared_ptr<Array> offsets;
+  ASSERT_OK(SortToIndices(&this->ctx_, *batch, {{0, SortKey::DESCENDING}, {1}},
+                          SortOptions(), &offsets));
+  const auto& a = checked_cast<const Int16Array&>(*batch->column(0));
+  const auto& b = checked_cast<const Int64Array&>(*batch->column(1));
+  const auto& indices = checked_cast<const UInt64Array&>(*offsets);
+  for (int64_t i = 1; i < length; i++) {
+    const auto lhs = indices.Value(i - 1);
+    const auto rhs = indices.Value(i);
+    if (a.IsNull(lhs)) {
+      ASSERT_TRUE(a.IsNull(rhs));
+    } else if (!a.IsNull(rhs)) {
+      ASSERT_GE(a.Value(lhs), a.Value(rhs));
+    }
+    const bool same_a = a.IsNull(lhs) ? a.IsNull(rhs)
+                                      : !a.IsNull(rhs) && a.Value(lhs) == a.Value(rhs);
+    if (same_a) {
+      ASSERT_LE(b.Value(lhs), b.Value(rhs));
+      if (b.Value(lhs) == b.Value(rhs)) {
+        ASSERT_LT(lhs, rhs);
+      }
+    }
+  }
+}
+
+class TestTopKKernel : public ComputeFixture, public TestBase {
+ protected:
+  void AssertTopK(const std::shared_ptr<DataType>& type, const std::string& values,
+                  const TopKOptions& options, const std::string& expected) {
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(TopK(&this->ctx_, *ArrayFromJSON(type, values), options, &actual));
+    ASSERT_OK(actual->Validate());
+    AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+  }
+};
+
+TEST_F(TestTopKKernel, Basics) {
+  const std::string values = "[null, 1, 3.3, null, 2, 5.3]";
+  AssertTopK(float64(), values, TopKOptions(0), "[]");
+  AssertTopK(float64(), values, TopKOptions(3), "[1, 4, 2]");
+  AssertTopK(float64(), values, TopKOptions(5), "[1, 4, 2, 5, 0]");
+  AssertTopK(float64(), values, TopKOptions(10), "[1, 4, 2, 5, 0, 3]");
+  AssertTopK(float64(), values, TopKOptions(2, SortKey::DESCENDING), "[5, 2]");
+  AssertTopK(float64(), "[]", TopKOptions(2), "[]");
+
+  // Equal values are in index order, as in a stable sort
+  AssertTopK(int8(), "[2, 1, 2, 1]", TopKOptions(3), "[1, 3, 0]");
+  AssertTopK(int8(), "[2, 1, 2, 1]", TopKOptions(3, SortKey::DESCENDING), "[0, 2, 1]");
+  AssertTopK(utf8(), R"(["b", null, "a", "c", "a"])", TopKOptions(2), "[2, 4]");
+
+  std::shared_ptr<Array> actual;
+  ASSERT_RAISES(Invalid, TopK(&this->ctx_, *ArrayFromJSON(int8(), "[1]"),
+                              TopKOptions(-1), &actual));
+}
+
+template <typename ArrowType>
+class TestTopKKernelRandom : public ComputeFixture, public TestBase {};
+
+TYPED_TEST_CASE(TestTopKKernelRandom, SortToIndicesableTypes);
+
+// TopK must return the first indices of a full stable sort, also when the input
+// is processed in parallel parts or in chunks
+TYPED_TEST(TestTopKKernelRandom, MatchesSort) {
+  Random<TypeParam> rand(0x5487658);
+  const int64_t length = 1 << 17;
+  auto array = rand.Generate(length, 0.1);
+  auto batch = RecordBatch::Make(::arrow::schema({field("a", array->type())}), length,
+                                 {array});
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{array->Slice(0, 1000), array->Slice(1000, 50000),
+                  array->Slice(51000)});
+
+  for (auto order : {SortKey::ASCENDING, SortKey::DESCENDING}) {
+    std::shared_ptr<Array> sorted;
+    ASSERT_OK(SortToIndices(&this->ctx_, *batch, {{0, order}}, SortOptions(), &sorted));
+    for (int64_t k : {1, 10, 1000}) {
+      std::shared_ptr<Array> actual;
+      ASSERT_OK(TopK(&this->ctx_, *array, TopKOptions(k, order), &actual));
+      AssertArraysEqual(*sorted->Slice(0, k), *actual);
+      ASSERT_OK(TopK(&this->ctx_, *chunked, TopKOptions(k, order), &actual));
+      AssertArraysEqual(*sorted->Slice(0, k), *actual);
+    }
+  }
+}
+
+TEST_F(TestSortToIndicesKernelMultiKey, Errors) {
+  std::shared_ptr<Array> offsets;
+  ASSERT_RAISES(Invalid,
+                SortToIndices(&this->ctx_, *batch_, {}, SortOptions(), &offsets));
+  ASSERT_RAISES(IndexError,
+                SortToIndices(&this->ctx_, *batch_, {{3}}, SortOptions(), &offsets));
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -18,9 +18,12 @@
 #include <limits>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "arrow/compute/kernels/take.h"
 #include "arrow/compute/kernels/take_internal.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/table.h"
 #include "arrow/util/logging.h"
 #include "arrow/visitor_inline.h"
 
@@ -34,17 +37,21 @@ class TakeKernelImpl : public TakeKernel {
       : TakeKernel(value_type) {}
 
   Status Init() {
-    return Taker<ArrayIndexSequence<IndexType>>::Make(this->type_, &taker_);
+    // Check that the value type is supported
+    std::unique_ptr<Taker<ArrayIndexSequence<IndexType>>> taker;
+    return Taker<ArrayIndexSequence<IndexType>>::Make(this->type_, &taker);
   }
 
   Status Take(FunctionContext* ctx, const Array& values, const Array& indices_array,
               std::shared_ptr<Array>* out) override {
-    RETURN_NOT_OK(taker_->SetContext(ctx));
-    RETURN_NOT_OK(taker_->Take(values, ArrayIndexSequence<IndexType>(indices_array)));
-    return taker_->Finish(out);
+    // A Taker holds builders, so each call gets its own to keep the kernel
+    // thread-safe
+    std::unique_ptr<Taker<ArrayIndexSequence<IndexType>>> taker;
+    RETURN_NOT_OK(Taker<ArrayIndexSequence<IndexType>>::Make(this->type_, &taker));
+    RETURN_NOT_OK(taker->SetContext(ctx));
+    RETURN_NOT_OK(taker->Take(values, ArrayIndexSequence<IndexType>(indices_array)));
+    return taker->Finish(out);
   }
-
-  std::unique_ptr<Taker<ArrayIndexSequence<IndexType>>> taker_;
 };
 
 struct UnpackIndices {
@@ -72,10 +79,21 @@ Status TakeKernel::Make(const std::shared_ptr<DataType>& value_type,
 
 Status TakeKernel::Call(FunctionContext* ctx, const Datum& values, const Datum& indices,
                         Datum* out) {
-  if (!values.is_array() || !indices.is_array()) {
-    return Status::Invalid("TakeKernel expects array values and indices");
+  if (!values.is_array() || !indices.is_arraylike()) {
+    return Status::Invalid("TakeKernel expects array values and array-like indices");
   }
   auto values_array = values.make_array();
+  if (indices.kind() == Datum::CHUNKED_ARRAY) {
+    const ChunkedArray& indices_chunked = *indices.chunked_array();
+    std::vector<std::shared_ptr<Array>> chunks(indices_chunked.num_chunks());
+    RETURN_NOT_OK(detail::ParallelForChunks(
+        ctx, indices_chunked.num_chunks(), indices_chunked.length(),
+        [&](FunctionContext* task_ctx, int i) {
+          return Take(task_ctx, *values_array, *indices_chunked.chunk(i), &chunks[i]);
+        }));
+    *out = std::make_shared<ChunkedArray>(chunks, type_);
+    return Status::OK();
+  }
   auto indices_array = indices.make_array();
   std::shared_ptr<Array> out_array;
   RETURN_NOT_OK(Take(ctx, *values_array, *indices_array, &out_array));
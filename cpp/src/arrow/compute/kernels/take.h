@@ -55,6 +55,10 @@ Status Take(FunctionContext* ctx, const Array& values, const Array& indices,
 
 /// \brief Take from an array of values at indices in another array
 ///
+/// values must be an Array. indices may be an Array or a ChunkedArray, in which
+/// case the output is a ChunkedArray with a chunk for each chunk of indices,
+/// taken concurrently when ctx->use_threads() is true.
+///
 /// \param[in] ctx the FunctionContext
 /// \param[in] values datum from which to take
 /// \param[in] indices which values to take
@@ -79,6 +83,9 @@ class ARROW_EXPORT TakeKernel : public BinaryKernel {
   /// \brief output type of this kernel (identical to type of values taken)
   std::shared_ptr<DataType> out_type() const override { return type_; }
 
+  /// \brief Take() implementations may be called concurrently
+  bool is_thread_safe() const override { return true; }
+
   /// \brief factory for TakeKernels
   ///
   /// \param[in] value_type constructed TakeKernel will support taking
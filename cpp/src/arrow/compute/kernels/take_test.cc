@@ -24,6 +24,7 @@
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/take.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -182,6 +183,30 @@ TYPED_TEST(TestTakeKernelWithNumeric, TakeRandomNumeric) {
   }
 }
 
+TYPED_TEST(TestTakeKernelWithNumeric, TakeChunkedIndices) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Numeric<TypeParam>(100, 0, 127, 0.1);
+  // Large enough for the chunks to be taken concurrently
+  ArrayVector index_chunks, expected_chunks;
+  for (int i = 0; i < 8; i++) {
+    index_chunks.push_back(rand.Int32(10000, 0, 99, 0.1));
+    std::shared_ptr<Array> expected;
+    ASSERT_OK(arrow::compute::Take(&this->ctx_, *values, *index_chunks[i], TakeOptions(),
+                                   &expected));
+    expected_chunks.push_back(expected);
+  }
+  auto indices = std::make_shared<ChunkedArray>(index_chunks);
+
+  for (bool use_threads : {true, false}) {
+    this->ctx_.set_use_threads(use_threads);
+    Datum out;
+    ASSERT_OK(arrow::compute::Take(&this->ctx_, values, indices, TakeOptions(), &out));
+    ASSERT_EQ(out.kind(), Datum::CHUNKED_ARRAY);
+    ASSERT_EQ(out.chunked_array()->num_chunks(), 8);
+    ASSERT_TRUE(out.chunked_array()->Equals(ChunkedArray(expected_chunks)));
+  }
+}
+
 using StringTypes =
     ::testing::Types<BinaryType, StringType, LargeBinaryType, LargeStringType>;
 
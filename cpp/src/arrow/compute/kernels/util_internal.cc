@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <future>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -29,6 +30,7 @@
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
@@ -43,6 +45,9 @@ namespace detail {
 
 namespace {
 
+// Below this total length, tasks are not worth the scheduling overhead
+constexpr int64_t kParallelMinLength = 1 << 15;
+
 inline void ZeroLastByte(Buffer* buffer) {
   *(buffer->mutable_data() + (buffer->size() - 1)) = 0;
 }
@@ -76,6 +81,38 @@ Status AllocateValueBuffer(FunctionContext* ctx, const DataType& type, int64_t l
 
 }  // namespace
 
+Status ParallelForChunks(FunctionContext* ctx, int num_tasks, int64_t length,
+                         const std::function<Status(FunctionContext*, int)>& task) {
+  // A task of the executor waiting on the executor could deadlock, so nested
+  // calls run inline
+  if (!ctx->use_threads() || num_tasks < 2 || length < kParallelMinLength ||
+      ctx->executor()->OwnsThisThread()) {
+    for (int i = 0; i < num_tasks; i++) {
+      RETURN_NOT_OK(task(ctx, i));
+      RETURN_NOT_OK(ctx->status());
+    }
+    return Status::OK();
+  }
+
+  std::vector<std::unique_ptr<FunctionContext>> contexts(num_tasks);
+  std::vector<std::future<Status>> futures;
+  auto executor = ctx->executor();
+  for (int i = 0; i < num_tasks; i++) {
+    contexts[i].reset(new FunctionContext(ctx->memory_pool()));
+    contexts[i]->set_use_threads(false);
+    FunctionContext* task_ctx = contexts[i].get();
+    futures.push_back(executor->Submit([&task, task_ctx, i]() -> Status {
+      RETURN_NOT_OK(task(task_ctx, i));
+      return task_ctx->status();
+    }));
+  }
+  Status st;
+  for (auto& future : futures) {
+    st &= future.get();
+  }
+  return st;
+}
+
 Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
                               const Datum& value, std::vector<Datum>* outputs) {
   if (value.kind() == Datum::ARRAY) {
@@ -85,12 +122,23 @@ Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
     outputs->push_back(out);
   } else if (value.kind() == Datum::CHUNKED_ARRAY) {
     const ChunkedArray& array = *value.chunked_array();
-    for (int i = 0; i < array.num_chunks(); i++) {
+    std::vector<Datum> chunk_outputs(array.num_chunks());
+    auto call_chunk = [&](FunctionContext* chunk_ctx, int i) {
       Datum out;
       out.value = ArrayData::Make(kernel->out_type(), array.chunk(i)->length());
-      RETURN_NOT_OK(kernel->Call(ctx, array.chunk(i), &out));
-      outputs->push_back(out);
+      RETURN_NOT_OK(kernel->Call(chunk_ctx, array.chunk(i), &out));
+      chunk_outputs[i] = std::move(out);
+      return Status::OK();
+    };
+    if (kernel->is_thread_safe()) {
+      RETURN_NOT_OK(
+          ParallelForChunks(ctx, array.num_chunks(), array.length(), call_chunk));
+    } else {
+      for (int i = 0; i < array.num_chunks(); i++) {
+        RETURN_NOT_OK(call_chunk(ctx, i));
+      }
     }
+    outputs->insert(outputs->end(), chunk_outputs.begin(), chunk_outputs.end());
   } else {
     return Status::Invalid("Input Datum was not array-like");
   }
@@ -133,19 +181,18 @@ Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
   int right_chunk_idx = 0;
   int64_t right_start_idx = 0;
 
+  // Slice both sides along the boundaries of the chunks of either side
+  std::vector<std::shared_ptr<Array>> left_ops, right_ops;
   int64_t elements_compared = 0;
-  do {
+  // A ChunkedArray may have no chunks at all
+  while (left_chunk_idx < static_cast<int>(left_arrays.size()) &&
+         right_chunk_idx < static_cast<int>(right_arrays.size())) {
     const std::shared_ptr<Array> left_array = left_arrays[left_chunk_idx];
     const std::shared_ptr<Array> right_array = right_arrays[right_chunk_idx];
     int64_t common_length = std::min(left_array->length() - left_start_idx,
                                      right_array->length() - right_start_idx);
-    std::shared_ptr<Array> left_op = left_array->Slice(left_start_idx, common_length);
-    std::shared_ptr<Array> right_op = right_array->Slice(right_start_idx, common_length);
-
-    Datum output;
-    output.value = ArrayData::Make(kernel->out_type(), common_length);
-    RETURN_NOT_OK(kernel->Call(ctx, left_op, right_op, &output));
-    outputs->push_back(output);
+    left_ops.push_back(left_array->Slice(left_start_idx, common_length));
+    right_ops.push_back(right_array->Slice(right_start_idx, common_length));
 
     elements_compared += common_length;
     // If we have exhausted the current chunk, proceed to the next one individually.
@@ -162,7 +209,28 @@ Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
     } else {
       right_start_idx += common_length;
     }
-  } while (elements_compared < left_length);
+    if (elements_compared == left_length) {
+      break;
+    }
+  }
+
+  const int num_slices = static_cast<int>(left_ops.size());
+  std::vector<Datum> slice_outputs(num_slices);
+  auto call_slice = [&](FunctionContext* slice_ctx, int i) {
+    Datum output;
+    output.value = ArrayData::Make(kernel->out_type(), left_ops[i]->length());
+    RETURN_NOT_OK(kernel->Call(slice_ctx, left_ops[i], right_ops[i], &output));
+    slice_outputs[i] = std::move(output);
+    return Status::OK();
+  };
+  if (kernel->is_thread_safe()) {
+    RETURN_NOT_OK(ParallelForChunks(ctx, num_slices, left_length, call_slice));
+  } else {
+    for (int i = 0; i < num_slices; i++) {
+      RETURN_NOT_OK(call_slice(ctx, i));
+    }
+  }
+  outputs->insert(outputs->end(), slice_outputs.begin(), slice_outputs.end());
   return Status::OK();
 }
 
@@ -18,6 +18,7 @@
 #ifndef ARROW_COMPUTE_KERNELS_UTIL_INTERNAL_H
 #define ARROW_COMPUTE_KERNELS_UTIL_INTERNAL_H
 
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -44,8 +45,30 @@ static inline void ZeroCopyData(const ArrayData& input, ArrayData* output) {
 
 namespace detail {
 
+/// \brief Call task(task_ctx, i) for i in [0, num_tasks), concurrently on the
+/// executor of ctx if it allows threads and the input is long enough.
+///
+/// When called from a thread of the executor, e.g. by a kernel invoked from a
+/// task of the CPU thread pool, the tasks run inline on the calling thread.
+///
+/// Concurrent tasks are each given a FunctionContext sharing the memory pool of
+/// ctx, so that statuses set by kernels don't race, and which doesn't allow
+/// threads, so that tasks don't wait on the executor they run on. The first
+/// error, returned or set on a context, is returned.
+///
+/// \param[in] ctx The function context of the caller.
+/// \param[in] num_tasks The number of tasks, typically of chunks.
+/// \param[in] length The total length of the input of the tasks.
+/// \param[in] task The task to run.
+ARROW_EXPORT
+Status ParallelForChunks(FunctionContext* ctx, int num_tasks, int64_t length,
+                         const std::function<Status(FunctionContext*, int)>& task);
+
 /// \brief Invoke the kernel on value using the ctx and store results in outputs.
 ///
+/// The chunks of a ChunkedArray are processed concurrently if the kernel is
+/// thread-safe, see ParallelForChunks. The outputs are in the order of the chunks.
+///
 /// \param[in,out] ctx The function context to use when invoking the kernel.
 /// \param[in,out] kernel The kernel to execute.
 /// \param[in] value The input value to execute the kernel with.
@@ -54,6 +77,11 @@ ARROW_EXPORT
 Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
                               const Datum& value, std::vector<Datum>* outputs);
 
+/// \brief Invoke the kernel on the aligned slices of left and right.
+///
+/// Chunks of left and right are sliced so that the slices passed to the kernel
+/// have the same length. Like InvokeUnaryArrayKernel, the slices are processed
+/// concurrently if the kernel is thread-safe.
 ARROW_EXPORT
 Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
                                const Datum& left, const Datum& right,
@@ -124,6 +152,8 @@ class ARROW_EXPORT PrimitiveAllocatingUnaryKernel : public UnaryKernel {
 
   std::shared_ptr<DataType> out_type() const override;
 
+  bool is_thread_safe() const override { return delegate_->is_thread_safe(); }
+
  private:
   UnaryKernel* delegate_;
 };
@@ -144,6 +174,8 @@ class ARROW_EXPORT PrimitiveAllocatingBinaryKernel : public BinaryKernel {
 
   std::shared_ptr<DataType> out_type() const override;
 
+  bool is_thread_safe() const override { return delegate_->is_thread_safe(); }
+
  private:
   BinaryKernel* delegate_;
 };
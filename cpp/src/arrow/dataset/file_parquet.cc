@@ -17,15 +17,26 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <memory>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/scalar.h"
 #include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/range.h"
 #include "arrow/util/stl.h"
 #include "parquet/arrow/reader.h"
+#include "parquet/bloom_filter.h"
+#include "parquet/exception.h"
 #include "parquet/file_reader.h"
+#include "parquet/metadata.h"
+#include "parquet/schema.h"
+#include "parquet/statistics.h"
 
 namespace arrow {
 namespace dataset {
@@ -77,15 +88,356 @@ class ParquetScanTask : public ScanTask {
   RecordBatchReaderPtr record_batch_reader_;
 };
 
+template <typename ArrowType, typename ParquetType>
+Status MakeMinMaxScalars(const parquet::Statistics& statistics,
+                         std::shared_ptr<Scalar>* min, std::shared_ptr<Scalar>* max) {
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+  using CType = typename ArrowType::c_type;
+  const auto& typed_statistics =
+      internal::checked_cast<const parquet::TypedStatistics<ParquetType>&>(statistics);
+  *min = std::make_shared<ScalarType>(static_cast<CType>(typed_statistics.min()));
+  *max = std::make_shared<ScalarType>(static_cast<CType>(typed_statistics.max()));
+  return Status::OK();
+}
+
+template <typename ScalarType>
+Status MakeBinaryMinMaxScalars(const parquet::Statistics& statistics,
+                               std::shared_ptr<Scalar>* min,
+                               std::shared_ptr<Scalar>* max) {
+  const auto& typed_statistics =
+      internal::checked_cast<const parquet::ByteArrayStatistics&>(statistics);
+  auto to_buffer = [](const parquet::ByteArray& value) {
+    return Buffer::FromString(
+        std::string(reinterpret_cast<const char*>(value.ptr), value.len));
+  };
+  *min = std::make_shared<ScalarType>(to_buffer(typed_statistics.min()));
+  *max = std::make_shared<ScalarType>(to_buffer(typed_statistics.max()));
+  return Status::OK();
+}
+
+// Convert the min/max of a column chunk's statistics to Scalars of the column's Arrow
+// type. Only types whose Parquet sort order agrees with Arrow's are supported.
+Status StatisticsAsScalars(const parquet::Statistics& statistics, const DataType& type,
+                           std::shared_ptr<Scalar>* min, std::shared_ptr<Scalar>* max) {
+  switch (statistics.physical_type()) {
+    case parquet::Type::BOOLEAN:
+      if (type.id() == Type::BOOL) {
+        return MakeMinMaxScalars<BooleanType, parquet::BooleanType>(statistics, min, max);
+      }
+      break;
+    case parquet::Type::INT32:
+      switch (type.id()) {
+        case Type::INT8:
+          return MakeMinMaxScalars<Int8Type, parquet::Int32Type>(statistics, min, max);
+        case Type::INT16:
+          return MakeMinMaxScalars<Int16Type, parquet::Int32Type>(statistics, min, max);
+        case Type::INT32:
+          return MakeMinMaxScalars<Int32Type, parquet::Int32Type>(statistics, min, max);
+        case Type::DATE32:
+          return MakeMinMaxScalars<Date32Type, parquet::Int32Type>(statistics, min, max);
+        default:
+          break;
+      }
+      break;
+    case parquet::Type::INT64:
+      if (type.id() == Type::INT64) {
+        return MakeMinMaxScalars<Int64Type, parquet::Int64Type>(statistics, min, max);
+      }
+      break;
+    case parquet::Type::FLOAT:
+      if (type.id() == Type::FLOAT) {
+        return MakeMinMaxScalars<FloatType, parquet::FloatType>(statistics, min, max);
+      }
+      break;
+    case parquet::Type::DOUBLE:
+      if (type.id() == Type::DOUBLE) {
+        return MakeMinMaxScalars<DoubleType, parquet::DoubleType>(statistics, min, max);
+      }
+      break;
+    case parquet::Type::BYTE_ARRAY:
+      if (type.id() == Type::STRING) {
+        return MakeBinaryMinMaxScalars<StringScalar>(statistics, min, max);
+      }
+      if (type.id() == Type::BINARY) {
+        return MakeBinaryMinMaxScalars<BinaryScalar>(statistics, min, max);
+      }
+      break;
+    default:
+      break;
+  }
+  return Status::NotImplemented("Cannot use Parquet statistics of physical type ",
+                                parquet::TypeToString(statistics.physical_type()),
+                                " for column of type ", type);
+}
+
+template <typename ScalarType, typename PhysicalCType>
+uint64_t HashNumericScalar(const parquet::BloomFilter& bloom_filter,
+                           const Scalar& scalar) {
+  const auto& typed_scalar = internal::checked_cast<const ScalarType&>(scalar);
+  return bloom_filter.Hash(static_cast<PhysicalCType>(typed_scalar.value));
+}
+
+// Hash a Scalar the way the Parquet writer hashes the values of a column of the given
+// physical type into its Bloom filter. Returns false if the Scalar's type isn't
+// stored with that physical type.
+bool HashScalarForBloomFilter(const parquet::BloomFilter& bloom_filter,
+                              parquet::Type::type physical_type, const Scalar& scalar,
+                              uint64_t* out) {
+  switch (physical_type) {
+    case parquet::Type::INT32:
+      switch (scalar.type->id()) {
+        case Type::INT8:
+          *out = HashNumericScalar<Int8Scalar, int32_t>(bloom_filter, scalar);
+          return true;
+        case Type::INT16:
+          *out = HashNumericScalar<Int16Scalar, int32_t>(bloom_filter, scalar);
+          return true;
+        case Type::INT32:
+          *out = HashNumericScalar<Int32Scalar, int32_t>(bloom_filter, scalar);
+          return true;
+        case Type::UINT8:
+          *out = HashNumericScalar<UInt8Scalar, int32_t>(bloom_filter, scalar);
+          return true;
+        case Type::UINT16:
+          *out = HashNumericScalar<UInt16Scalar, int32_t>(bloom_filter, scalar);
+          return true;
+        case Type::UINT32:
+          *out = HashNumericScalar<UInt32Scalar, int32_t>(bloom_filter, scalar);
+          return true;
+        case Type::DATE32:
+          *out = HashNumericScalar<Date32Scalar, int32_t>(bloom_filter, scalar);
+          return true;
+        default:
+          return false;
+      }
+    case parquet::Type::INT64:
+      switch (scalar.type->id()) {
+        case Type::INT64:
+          *out = HashNumericScalar<Int64Scalar, int64_t>(bloom_filter, scalar);
+          return true;
+        case Type::UINT32:
+          *out = HashNumericScalar<UInt32Scalar, int64_t>(bloom_filter, scalar);
+          return true;
+        case Type::UINT64:
+          *out = HashNumericScalar<UInt64Scalar, int64_t>(bloom_filter, scalar);
+          return true;
+        default:
+          return false;
+      }
+    case parquet::Type::FLOAT:
+      if (scalar.type->id() == Type::FLOAT) {
+        *out = HashNumericScalar<FloatScalar, float>(bloom_filter, scalar);
+        return true;
+      }
+      return false;
+    case parquet::Type::DOUBLE:
+      if (scalar.type->id() == Type::DOUBLE) {
+        *out = HashNumericScalar<DoubleScalar, double>(bloom_filter, scalar);
+        return true;
+      }
+      return false;
+    case parquet::Type::BYTE_ARRAY:
+      if (scalar.type->id() == Type::STRING || scalar.type->id() == Type::BINARY) {
+        const auto& value = *internal::checked_cast<const BinaryScalar&>(scalar).value;
+        parquet::ByteArray byte_array(static_cast<uint32_t>(value.size()), value.data());
+        *out = bloom_filter.Hash(&byte_array);
+        return true;
+      }
+      return false;
+    default:
+      return false;
+  }
+}
+
+// Decides whether a RowGroup may contain rows satisfying a filter expression. The
+// min/max statistics of the RowGroup's flat columns are turned into a guarantee
+// (field >= min and field <= max) which is used to simplify the filter; if the
+// simplified filter is never satisfiable the RowGroup can be skipped entirely.
+//
+// If a file reader is provided, equality comparisons with a column which has a Bloom
+// filter are also checked against it. A disjunction of equalities on one column, the
+// expression form of an IN predicate, is rejected if the Bloom filter excludes every
+// value.
+class ParquetRowGroupStatisticsFilter {
+ public:
+  ParquetRowGroupStatisticsFilter(std::shared_ptr<parquet::FileMetaData> metadata,
+                                  std::shared_ptr<Schema> schema,
+                                  std::shared_ptr<Expression> filter,
+                                  parquet::ParquetFileReader* reader = NULLPTR)
+      : metadata_(std::move(metadata)), filter_(std::move(filter)), reader_(reader) {
+    // Only top-level, non-repeated primitive columns can be referenced by a
+    // FieldExpression
+    const parquet::SchemaDescriptor* descr = metadata_->schema();
+    for (int i = 0; i < descr->num_columns(); ++i) {
+      const parquet::ColumnDescriptor* column = descr->Column(i);
+      if (column->max_repetition_level() > 0 ||
+          !descr->GetColumnRoot(i)->is_primitive()) {
+        continue;
+      }
+      auto field = schema->GetFieldByName(column->name());
+      if (field != nullptr) {
+        columns_.emplace_back(i, std::move(field));
+      }
+    }
+  }
+
+  /// Return false if no row of the RowGroup can satisfy the filter.
+  bool MaybeSatisfies(int row_group) const {
+    std::shared_ptr<Expression> expression = filter_;
+    auto guarantee = RowGroupGuarantee(row_group);
+    if (guarantee != nullptr) {
+      // If the filter can't be simplified, e.g. because it compares with a scalar of a
+      // different type than the column, it is used as is.
+      auto maybe_simplified = filter_->Assume(*guarantee);
+      if (maybe_simplified.ok()) {
+        expression = std::move(maybe_simplified).ValueOrDie();
+        bool trivial = true;
+        if (expression->IsNull() ||
+            (expression->IsTrivialCondition(&trivial) && !trivial)) {
+          return false;
+        }
+      }
+    }
+
+    if (reader_ == nullptr) {
+      return true;
+    }
+    BloomFilters bloom_filters;
+    return BloomFiltersMaybeSatisfy(*expression, row_group, &bloom_filters);
+  }
+
+ private:
+  // Bloom filters of a RowGroup read so far, keyed by column index. The value is null
+  // if the column chunk has no Bloom filter.
+  using BloomFilters = std::unordered_map<int, std::unique_ptr<parquet::BloomFilter>>;
+
+  // Return false if no row of the RowGroup can satisfy the expression according to
+  // the Bloom filters of its columns.
+  bool BloomFiltersMaybeSatisfy(const Expression& expr, int row_group,
+                                BloomFilters* bloom_filters) const {
+    switch (expr.type()) {
+      case ExpressionType::AND: {
+        const auto& and_expr = internal::checked_cast<const AndExpression&>(expr);
+        return BloomFiltersMaybeSatisfy(*and_expr.left_operand(), row_group,
+                                        bloom_filters) &&
+               BloomFiltersMaybeSatisfy(*and_expr.right_operand(), row_group,
+                                        bloom_filters);
+      }
+      case ExpressionType::OR: {
+        const auto& or_expr = internal::checked_cast<const OrExpression&>(expr);
+        return BloomFiltersMaybeSatisfy(*or_expr.left_operand(), row_group,
+                                        bloom_filters) ||
+               BloomFiltersMaybeSatisfy(*or_expr.right_operand(), row_group,
+                                        bloom_filters);
+      }
+      case ExpressionType::COMPARISON: {
+        const auto& comparison =
+            internal::checked_cast<const ComparisonExpression&>(expr);
+        if (comparison.op() != compute::CompareOperator::EQUAL ||
+            comparison.left_operand()->type() != ExpressionType::FIELD ||
+            comparison.right_operand()->type() != ExpressionType::SCALAR) {
+          return true;
+        }
+        const auto& name =
+            internal::checked_cast<const FieldExpression&>(*comparison.left_operand())
+                .name();
+        const auto& value =
+            internal::checked_cast<const ScalarExpression&>(*comparison.right_operand())
+                .value();
+        return BloomFilterMaybeContains(name, *value, row_group, bloom_filters);
+      }
+      default:
+        return true;
+    }
+  }
+
+  bool BloomFilterMaybeContains(const std::string& name, const Scalar& value,
+                                int row_group, BloomFilters* bloom_filters) const {
+    if (!value.is_valid) {
+      return true;
+    }
+    for (const auto& column : columns_) {
+      if (column.second->name() != name) {
+        continue;
+      }
+      if (!value.type->Equals(*column.second->type())) {
+        return true;
+      }
+      auto it = bloom_filters->find(column.first);
+      if (it == bloom_filters->end()) {
+        std::unique_ptr<parquet::BloomFilter> bloom_filter;
+        try {
+          bloom_filter = reader_->RowGroup(row_group)->GetBloomFilter(column.first);
+        } catch (const ::parquet::ParquetException&) {
+          // An unreadable Bloom filter can't exclude anything
+        }
+        it = bloom_filters->emplace(column.first, std::move(bloom_filter)).first;
+      }
+      if (it->second == nullptr) {
+        return true;
+      }
+      auto physical_type = metadata_->schema()->Column(column.first)->physical_type();
+      uint64_t hash;
+      if (!HashScalarForBloomFilter(*it->second, physical_type, value, &hash)) {
+        return true;
+      }
+      return it->second->FindHash(hash);
+    }
+    return true;
+  }
+
+  std::shared_ptr<Expression> RowGroupGuarantee(int row_group) const {
+    auto row_group_metadata = metadata_->RowGroup(row_group);
+
+    std::shared_ptr<Expression> guarantee;
+    for (const auto& column : columns_) {
+      auto chunk = row_group_metadata->ColumnChunk(column.first);
+      auto statistics = chunk->statistics();
+      // A column chunk holding only nulls has no meaningful min/max
+      if (statistics == nullptr || !statistics->HasMinMax() ||
+          statistics->null_count() == chunk->num_values()) {
+        continue;
+      }
+
+      std::shared_ptr<Scalar> min, max;
+      if (!StatisticsAsScalars(*statistics, *column.second->type(), &min, &max).ok()) {
+        continue;
+      }
+
+      auto field = field_ref(column.second->name());
+      auto range = and_(greater_equal(field, ScalarExpression::Make(std::move(min))),
+                        less_equal(field, ScalarExpression::Make(std::move(max))));
+      guarantee = guarantee == nullptr ? std::move(range)
+                                       : and_(std::move(guarantee), std::move(range));
+    }
+    return guarantee;
+  }
+
+  std::shared_ptr<parquet::FileMetaData> metadata_;
+  std::shared_ptr<Expression> filter_;
+
+  // Used to read Bloom filters, owned by the FileReader of the scan
+  parquet::ParquetFileReader* reader_;
+
+  // Column index and Arrow field of the columns statistics are gathered from
+  std::vector<std::pair<int, std::shared_ptr<Field>>> columns_;
+};
+
 constexpr int64_t kDefaultRowCountPerPartition = 1U << 16;
 
 // A class that clusters RowGroups of a Parquet file until the cluster has a specified
 // total row count. This doesn't guarantee exact row counts; it may exceed the target.
+// RowGroups which are excluded by the statistics filter are skipped.
 class ParquetRowGroupPartitioner {
  public:
-  ParquetRowGroupPartitioner(std::shared_ptr<parquet::FileMetaData> metadata,
-                             int64_t row_count = kDefaultRowCountPerPartition)
-      : metadata_(std::move(metadata)), row_count_(row_count), row_group_idx_(0) {
+  ParquetRowGroupPartitioner(
+      std::shared_ptr<parquet::FileMetaData> metadata,
+      std::unique_ptr<ParquetRowGroupStatisticsFilter> statistics_filter = nullptr,
+      int64_t row_count = kDefaultRowCountPerPartition)
+      : metadata_(std::move(metadata)),
+        statistics_filter_(std::move(statistics_filter)),
+        row_count_(row_count),
+        row_group_idx_(0) {
     num_row_groups_ = metadata_->num_row_groups();
   }
 
@@ -94,8 +446,13 @@ class ParquetRowGroupPartitioner {
     RowGroupSet partition;
 
     while (row_group_idx_ < num_row_groups_ && partition_size < row_count_) {
-      partition_size += metadata_->RowGroup(row_group_idx_)->num_rows();
-      partition.push_back(row_group_idx_++);
+      int row_group = row_group_idx_++;
+      if (statistics_filter_ != nullptr &&
+          !statistics_filter_->MaybeSatisfies(row_group)) {
+        continue;
+      }
+      partition_size += metadata_->RowGroup(row_group)->num_rows();
+      partition.push_back(row_group);
     }
 
     return partition;
@@ -103,6 +460,7 @@ class ParquetRowGroupPartitioner {
 
  private:
   std::shared_ptr<parquet::FileMetaData> metadata_;
+  std::unique_ptr<ParquetRowGroupStatisticsFilter> statistics_filter_;
   int64_t row_count_;
   int row_group_idx_;
   int num_row_groups_;
@@ -122,8 +480,13 @@ class ParquetScanTaskIterator {
     RETURN_NOT_OK(parquet::arrow::FileReader::Make(context->pool, std::move(reader),
                                                    &arrow_reader));
 
-    *out = ScanTaskIterator(
-        ParquetScanTaskIterator(columns_projection, metadata, std::move(arrow_reader)));
+    std::unique_ptr<ParquetRowGroupStatisticsFilter> statistics_filter;
+    RETURN_NOT_OK(
+        MakeStatisticsFilter(metadata, options, arrow_reader.get(), &statistics_filter));
+
+    *out = ScanTaskIterator(ParquetScanTaskIterator(columns_projection, metadata,
+                                                    std::move(statistics_filter),
+                                                    std::move(arrow_reader)));
 
     return Status::OK();
   }
@@ -153,11 +516,41 @@ class ParquetScanTaskIterator {
     return Status::OK();
   }
 
-  ParquetScanTaskIterator(std::vector<int> columns_projection,
-                          std::shared_ptr<parquet::FileMetaData> metadata,
-                          std::unique_ptr<parquet::arrow::FileReader> reader)
+  // Build a RowGroup statistics filter out of the selector's expression filters, if
+  // there are any
+  static Status MakeStatisticsFilter(
+      const std::shared_ptr<parquet::FileMetaData>& metadata,
+      const std::shared_ptr<ScanOptions>& options, parquet::arrow::FileReader* reader,
+      std::unique_ptr<ParquetRowGroupStatisticsFilter>* out) {
+    if (options == nullptr || options->selector == nullptr ||
+        options->selector->filters.empty()) {
+      return Status::OK();
+    }
+
+    for (const auto& filter : options->selector->filters) {
+      if (filter->type() != FilterType::EXPRESSION) {
+        // Generic filters can't be reasoned about
+        return Status::OK();
+      }
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto expression, SelectorAssume(options->selector, NULLPTR));
+
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(reader->GetSchema(&schema));
+
+    out->reset(new ParquetRowGroupStatisticsFilter(
+        metadata, std::move(schema), std::move(expression), reader->parquet_reader()));
+    return Status::OK();
+  }
+
+  ParquetScanTaskIterator(
+      std::vector<int> columns_projection,
+      std::shared_ptr<parquet::FileMetaData> metadata,
+      std::unique_ptr<ParquetRowGroupStatisticsFilter> statistics_filter,
+      std::unique_ptr<parquet::arrow::FileReader> reader)
       : columns_projection_(columns_projection),
-        partitioner_(std::move(metadata)),
+        partitioner_(std::move(metadata), std::move(statistics_filter)),
         reader_(std::move(reader)) {}
 
   std::vector<int> columns_projection_;
@@ -20,8 +20,11 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
 #include "arrow/dataset/test_util.h"
 #include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/testing/util.h"
 #include "parquet/arrow/writer.h"
 
@@ -172,6 +175,125 @@ TEST_F(TestParquetFileFormat, ScanRecordBatchReader) {
   ASSERT_EQ(row_count, kNumRows);
 }
 
+TEST_F(TestParquetFileFormat, PredicatePushdownRowGroups) {
+  // Each RowGroup holds a disjoint, increasing range of i64 values
+  constexpr int64_t kRowGroupSize = 1024;
+  constexpr int64_t kNumRowGroups = 8;
+
+  ASSERT_OK_AND_ASSIGN(
+      auto i64, ArrayFromBuilderVisitor(int64(), kRowGroupSize * kNumRowGroups,
+                                        [](Int64Builder* builder) {
+                                          builder->UnsafeAppend(builder->length());
+                                        }));
+  auto table = Table::Make(schema({field("i64", int64())}), {i64});
+
+  std::shared_ptr<Buffer> buffer;
+  auto sink = CreateOutputStream(default_memory_pool());
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, kRowGroupSize));
+  ASSERT_OK(sink->Finish(&buffer));
+  FileSource source(buffer);
+
+  auto CountRows = [&](std::shared_ptr<Expression> filter) {
+    opts_ = std::make_shared<ScanOptions>();
+    opts_->selector = ExpressionSelector(std::move(filter));
+    auto fragment = std::make_shared<ParquetFragment>(source, opts_);
+
+    ScanTaskIterator it;
+    ARROW_EXPECT_OK(fragment->Scan(ctx_, &it));
+    int64_t row_count = 0;
+    ARROW_EXPECT_OK(it.Visit([&row_count](std::unique_ptr<ScanTask> task) -> Status {
+      return task->Scan().Visit([&row_count](std::shared_ptr<RecordBatch> batch) {
+        row_count += batch->num_rows();
+        return Status::OK();
+      });
+    }));
+    return row_count;
+  };
+
+  // Only the RowGroups overlapping the filter are read; rows are not filtered
+  ASSERT_EQ(CountRows(("i64"_ == int64_t(5)).Copy()), kRowGroupSize);
+  ASSERT_EQ(CountRows(("i64"_ >= int64_t(kRowGroupSize * 5)).Copy()), kRowGroupSize * 3);
+  ASSERT_EQ(CountRows(("i64"_ < int64_t(0)).Copy()), 0);
+  ASSERT_EQ(CountRows(("i64"_ == int64_t(10) or "i64"_ == int64_t(kRowGroupSize * 7))
+                          .Copy()),
+            kRowGroupSize * 2);
+
+  // Filters which can't be checked against the statistics select every RowGroup
+  ASSERT_EQ(CountRows(("i64"_ == int32_t(5)).Copy()), kRowGroupSize * kNumRowGroups);
+  ASSERT_EQ(CountRows(("missing"_ == int64_t(5)).Copy()), kRowGroupSize * kNumRowGroups);
+}
+
+TEST_F(TestParquetFileFormat, PredicatePushdownBloomFilter) {
+  // Each RowGroup holds every kNumRowGroups-th id, so the ranges of all RowGroups
+  // overlap and only the Bloom filters can exclude them
+  constexpr int64_t kRowGroupSize = 1024;
+  constexpr int64_t kNumRowGroups = 8;
+
+  ASSERT_OK_AND_ASSIGN(
+      auto ids, ArrayFromBuilderVisitor(int64(), kRowGroupSize * kNumRowGroups,
+                                        [](Int64Builder* builder) {
+                                          int64_t row = builder->length();
+                                          builder->UnsafeAppend(
+                                              (row % kRowGroupSize) * kNumRowGroups +
+                                              row / kRowGroupSize);
+                                        }));
+  auto table = Table::Make(schema({field("id", int64())}), {ids});
+
+  auto Write = [&](const std::shared_ptr<WriterProperties>& properties) {
+    std::shared_ptr<Buffer> buffer;
+    auto sink = CreateOutputStream(default_memory_pool());
+    ARROW_EXPECT_OK(
+        WriteTable(*table, default_memory_pool(), sink, kRowGroupSize, properties));
+    ARROW_EXPECT_OK(sink->Finish(&buffer));
+    return buffer;
+  };
+
+  auto CountRows = [&](const std::shared_ptr<Buffer>& buffer,
+                       std::shared_ptr<Expression> filter) {
+    opts_ = std::make_shared<ScanOptions>();
+    opts_->selector = ExpressionSelector(std::move(filter));
+    auto fragment = std::make_shared<ParquetFragment>(FileSource(buffer), opts_);
+
+    ScanTaskIterator it;
+    ARROW_EXPECT_OK(fragment->Scan(ctx_, &it));
+    int64_t row_count = 0;
+    ARROW_EXPECT_OK(it.Visit([&row_count](std::unique_ptr<ScanTask> task) -> Status {
+      return task->Scan().Visit([&row_count](std::shared_ptr<RecordBatch> batch) {
+        row_count += batch->num_rows();
+        return Status::OK();
+      });
+    }));
+    return row_count;
+  };
+
+  auto without_bloom_filter = Write(default_writer_properties());
+  ASSERT_EQ(CountRows(without_bloom_filter, ("id"_ == int64_t(19)).Copy()),
+            kRowGroupSize * kNumRowGroups);
+
+  // Sized generously so that no absent id is a false positive
+  auto with_bloom_filter = Write(WriterProperties::Builder()
+                                     .enable_bloom_filter("id", kRowGroupSize * 16)
+                                     ->build());
+  ASSERT_EQ(CountRows(with_bloom_filter, ("id"_ == int64_t(19)).Copy()), kRowGroupSize);
+
+  // IN (19, 20, 28) touches the RowGroups 3 and 4
+  ASSERT_EQ(CountRows(with_bloom_filter, ("id"_ == int64_t(19) or "id"_ == int64_t(20) or
+                                          "id"_ == int64_t(28))
+                                             .Copy()),
+            kRowGroupSize * 2);
+
+  // Conjunctions are pruned if any of their equalities is
+  ASSERT_EQ(CountRows(with_bloom_filter,
+                      ("id"_ == int64_t(19) and "id"_ > int64_t(10)).Copy()),
+            kRowGroupSize);
+
+  // Other comparisons can't use the Bloom filters
+  ASSERT_EQ(CountRows(with_bloom_filter, ("id"_ != int64_t(19)).Copy()),
+            kRowGroupSize * kNumRowGroups);
+  ASSERT_EQ(CountRows(with_bloom_filter, ("id"_ == int32_t(19)).Copy()),
+            kRowGroupSize * kNumRowGroups);
+}
+
 class TestParquetFileSystemBasedDataSource
     : public FileSystemBasedDataSourceMixin<ParquetFileFormat> {
   std::vector<std::string> file_names() const override {
@@ -465,6 +465,11 @@ Result<std::shared_ptr<Expression>> ComparisonExpression::AssumeGivenComparison(
   const auto& this_rhs = checked_cast<const ScalarExpression&>(*right_operand_).value();
   const auto& given_rhs =
       checked_cast<const ScalarExpression&>(*given.right_operand_).value();
+  if (!this_rhs->type->Equals(*given_rhs->type)) {
+    // e.g. an int32 field compared with an int64 and a double scalar, which
+    // can't be ordered without casting
+    return Copy();
+  }
   ARROW_ASSIGN_OR_RAISE(auto cmp, Compare(*this_rhs, *given_rhs));
 
   if (cmp == Comparison::NULL_) {
@@ -882,7 +887,15 @@ Result<std::shared_ptr<DataType>> ComparisonExpression::Validate(
 
   ARROW_ASSIGN_OR_RAISE(auto lhs_type, left_operand_->Validate(schema));
   ARROW_ASSIGN_OR_RAISE(auto rhs_type, right_operand_->Validate(schema));
-  if (!lhs_type->Equals(rhs_type)) {
+  // Numeric columns may be compared with a scalar of another numeric type, which
+  // compute::Compare casts instead of the column
+  auto is_numeric = [](const DataType& type) {
+    return is_integer(type.id()) || type.id() == Type::FLOAT ||
+           type.id() == Type::DOUBLE;
+  };
+  const bool cast_scalar = right_operand_->type() == ExpressionType::SCALAR &&
+                           is_numeric(*lhs_type) && is_numeric(*rhs_type);
+  if (!lhs_type->Equals(rhs_type) && !cast_scalar) {
     return Status::TypeError("cannot compare expressions of differing type, ", *lhs_type,
                              " vs ", *rhs_type);
   }
@@ -105,6 +105,12 @@ TEST_F(ExpressionsTest, SimplificationAgainstCompoundCondition) {
   AssertSimplifiesTo("b"_ > 5 and "b"_ < 10, "b"_ > 6 and "b"_ < 13, "b"_ < 10);
 }
 
+TEST_F(ExpressionsTest, SimplificationWithDifferingTypes) {
+  // Scalars of differing types aren't ordered, so nothing is simplified
+  AssertSimplifiesTo("b"_ > int64_t(5), "b"_ == 3, "b"_ > int64_t(5));
+  AssertSimplifiesTo("b"_ > 5.5, "b"_ == 3, "b"_ > 5.5);
+}
+
 TEST_F(ExpressionsTest, SimplificationToNull) {
   auto null = ScalarExpression::MakeNull(boolean());
   auto null32 = ScalarExpression::MakeNull(int32());
@@ -227,6 +233,30 @@ TEST_F(FilterTest, Basics) {
   ])");
 }
 
+TEST_F(FilterTest, ScalarOfDifferingNumericType) {
+  AssertFilter("a"_ < 1.5 and "b"_ > 0, {field("a", int32()), field("b", float64())},
+               R"([
+      {"a": 0, "b": -0.1, "in": 0},
+      {"a": 0, "b":  0.3, "in": 1},
+      {"a": 1, "b":  0.2, "in": 1},
+      {"a": 2, "b":  0.1, "in": 0},
+      {"a": 1, "b": null, "in": null}
+  ])");
+
+  AssertFilter("a"_ >= int64_t(2) and "a"_ != (int64_t(1) << 40),
+               {field("a", int32()), field("b", float64())}, R"([
+      {"a": 0, "b": 0.0, "in": 0},
+      {"a": 1, "b": 0.0, "in": 0},
+      {"a": 2, "b": 0.0, "in": 1},
+      {"a": 3, "b": 0.0, "in": 1},
+      {"a": null, "b": 0.0, "in": null}
+  ])");
+
+  auto schema = ::arrow::schema({field("a", int32()), field("s", utf8())});
+  ASSERT_OK(("a"_ < 1.5).Validate(*schema).status());
+  ASSERT_RAISES(TypeError, ("s"_ < 1.5).Validate(*schema).status());
+}
+
 TEST_F(FilterTest, ConditionOnAbsentColumn) {
   AssertFilter("a"_ == 0 and "b"_ > 0.0 and "b"_ < 1.0 and "absent"_ == 0,
                {field("a", int32()), field("b", float64())}, R"([
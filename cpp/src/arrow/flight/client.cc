@@ -20,6 +20,7 @@
 // Platform-specific defines
 #include "arrow/flight/platform.h"
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -55,10 +56,15 @@ class MemoryPool;
 
 namespace flight {
 
-FlightCallOptions::FlightCallOptions() : timeout(-1) {}
+FlightCallOptions::FlightCallOptions()
+    : timeout(-1), ipc_write_options(ipc::IpcOptions::Defaults()) {}
 
 struct ClientRpc {
   grpc::ClientContext context;
+  // Options for the writes of record batches
+  grpc::WriteOptions write_options;
+  // Set once Finish() was called on the stream, nothing may be written after
+  std::atomic<bool> finished{false};
 
   explicit ClientRpc(const FlightCallOptions& options) {
     if (options.timeout.count() >= 0) {
@@ -139,29 +145,41 @@ class GrpcClientAuthReader : public ClientAuthReader {
 // additional method to get both the record batch and application
 // metadata.
 
+template <typename GrpcStream>
 class GrpcIpcMessageReader;
+
 class GrpcStreamReader : public FlightStreamReader {
  public:
   GrpcStreamReader();
 
-  static Status Open(std::unique_ptr<ClientRpc> rpc,
-                     std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream,
+  /// \brief Create a reader, the schema is read from the stream by
+  /// EnsureDataStarted
+  template <typename GrpcStream>
+  static Status Open(std::shared_ptr<ClientRpc> rpc, std::shared_ptr<GrpcStream> stream,
                      std::unique_ptr<GrpcStreamReader>* out);
+  /// \brief Read the schema if not done yet, this blocks until the server
+  /// sent it
+  Status EnsureDataStarted();
   std::shared_ptr<Schema> schema() const override;
   Status Next(FlightStreamChunk* out) override;
   void Cancel() override;
 
  private:
+  template <typename GrpcStream>
   friend class GrpcIpcMessageReader;
+  // Only set until the schema was read
+  std::unique_ptr<ipc::MessageReader> message_reader_;
   std::unique_ptr<ipc::RecordBatchReader> batch_reader_;
   std::shared_ptr<Buffer> last_app_metadata_;
   std::shared_ptr<ClientRpc> rpc_;
 };
 
+// Reads either a DoGet or a DoExchange stream
+template <typename GrpcStream>
 class GrpcIpcMessageReader : public ipc::MessageReader {
  public:
   GrpcIpcMessageReader(GrpcStreamReader* reader, std::shared_ptr<ClientRpc> rpc,
-                       std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream)
+                       std::shared_ptr<GrpcStream> stream)
       : flight_reader_(reader),
         rpc_(rpc),
         stream_(std::move(stream)),
@@ -194,6 +212,7 @@ class GrpcIpcMessageReader : public ipc::MessageReader {
  protected:
   Status OverrideWithServerError(Status&& st) {
     // Get the gRPC status if not OK, to propagate any server error message
+    rpc_->finished = true;
     RETURN_NOT_OK(internal::FromGrpcStatus(stream_->Finish()));
     return std::move(st);
   }
@@ -202,29 +221,40 @@ class GrpcIpcMessageReader : public ipc::MessageReader {
   GrpcStreamReader* flight_reader_;
   // The RPC context lifetime must be coupled to the ClientReader
   std::shared_ptr<ClientRpc> rpc_;
-  std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream_;
+  std::shared_ptr<GrpcStream> stream_;
   bool stream_finished_;
 };
 
 GrpcStreamReader::GrpcStreamReader() {}
 
-Status GrpcStreamReader::Open(std::unique_ptr<ClientRpc> rpc,
-                              std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream,
+template <typename GrpcStream>
+Status GrpcStreamReader::Open(std::shared_ptr<ClientRpc> rpc,
+                              std::shared_ptr<GrpcStream> stream,
                               std::unique_ptr<GrpcStreamReader>* out) {
   *out = std::unique_ptr<GrpcStreamReader>(new GrpcStreamReader);
   out->get()->rpc_ = std::move(rpc);
-  std::unique_ptr<GrpcIpcMessageReader> message_reader(
-      new GrpcIpcMessageReader(out->get(), out->get()->rpc_, std::move(stream)));
-  return ipc::RecordBatchStreamReader::Open(std::move(message_reader),
-                                            &(*out)->batch_reader_);
+  (*out)->message_reader_.reset(new GrpcIpcMessageReader<GrpcStream>(
+      out->get(), out->get()->rpc_, std::move(stream)));
+  return Status::OK();
+}
+
+Status GrpcStreamReader::EnsureDataStarted() {
+  if (batch_reader_) {
+    return Status::OK();
+  }
+  if (!message_reader_) {
+    return Status::Invalid("The stream failed to start");
+  }
+  return ipc::RecordBatchStreamReader::Open(std::move(message_reader_), &batch_reader_);
 }
 
 std::shared_ptr<Schema> GrpcStreamReader::schema() const {
-  return batch_reader_->schema();
+  return batch_reader_ ? batch_reader_->schema() : nullptr;
 }
 
 Status GrpcStreamReader::Next(FlightStreamChunk* out) {
   out->app_metadata = nullptr;
+  RETURN_NOT_OK(EnsureDataStarted());
   RETURN_NOT_OK(batch_reader_->ReadNext(&out->data));
   out->app_metadata = std::move(last_app_metadata_);
   return Status::OK();
@@ -234,26 +264,65 @@ void GrpcStreamReader::Cancel() { rpc_->context.TryCancel(); }
 
 // Similarly, the next two classes are intertwined. In order to get
 // application-specific metadata to the IpcPayloadWriter,
-// DoPutPayloadWriter takes a pointer to
+// GrpcPayloadWriter takes a pointer to
 // GrpcStreamWriter. GrpcStreamWriter updates a metadata field on
-// write; DoPutPayloadWriter reads that metadata field to determine
+// write; GrpcPayloadWriter reads that metadata field to determine
 // what to write.
+//
+// Both are parameterized by the type of the messages sent back by the server:
+// PutResult for DoPut, FlightData for DoExchange.
+
+template <typename ProtoReadT>
+using GrpcWriteStream = grpc::ClientReaderWriter<pb::FlightData, ProtoReadT>;
+
+// Finish a DoPut once the client is done writing: drain the read side to
+// avoid hanging, then get the status of the call
+Status FinishWriteStream(GrpcWriteStream<pb::PutResult>* stream, std::mutex* read_mutex) {
+  std::unique_lock<std::mutex> guard(*read_mutex, std::try_to_lock);
+  if (!guard.owns_lock()) {
+    return Status::IOError("Cannot close stream with pending read operation.");
+  }
+  pb::PutResult message;
+  while (stream->Read(&message)) {
+  }
+  return internal::FromGrpcStatus(stream->Finish());
+}
+
+// The data sent back during a DoExchange is left to the reader, which gets
+// the status of the call at the end of the stream
+Status FinishWriteStream(GrpcWriteStream<pb::FlightData>* stream,
+                         std::mutex* read_mutex) {
+  return Status::OK();
+}
 
-class DoPutPayloadWriter;
+template <typename ProtoReadT>
+class GrpcPayloadWriter;
+
+template <typename ProtoReadT>
 class GrpcStreamWriter : public FlightStreamWriter {
  public:
   ~GrpcStreamWriter() override = default;
 
-  explicit GrpcStreamWriter(
-      std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer)
+  explicit GrpcStreamWriter(std::shared_ptr<GrpcWriteStream<ProtoReadT>> writer)
       : app_metadata_(nullptr), batch_writer_(nullptr), writer_(writer) {}
 
-  static Status Open(
-      const FlightDescriptor& descriptor, const std::shared_ptr<Schema>& schema,
-      std::unique_ptr<ClientRpc> rpc, std::unique_ptr<pb::PutResult> response,
-      std::shared_ptr<std::mutex> read_mutex,
-      std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer,
-      std::unique_ptr<FlightStreamWriter>* out);
+  static Status Open(const FlightDescriptor& descriptor,
+                     const std::shared_ptr<Schema>& schema,
+                     const ipc::IpcOptions& ipc_options, std::shared_ptr<ClientRpc> rpc,
+                     std::unique_ptr<pb::PutResult> response,
+                     std::shared_ptr<std::mutex> read_mutex,
+                     std::shared_ptr<GrpcWriteStream<ProtoReadT>> writer,
+                     std::unique_ptr<GrpcStreamWriter>* out);
+
+  /// \brief Send the descriptor and the schema now rather than with the
+  /// first batch
+  Status Begin(const std::shared_ptr<Schema>& schema, const ipc::IpcOptions& options) {
+    ipc::DictionaryMemo dictionary_memo;
+    ipc::internal::IpcPayload payload;
+    RETURN_NOT_OK(
+        ipc::internal::GetSchemaPayload(*schema, options, &dictionary_memo, &payload));
+    return payload_writer_->WritePayload(payload);
+  }
 
   Status WriteRecordBatch(const RecordBatch& batch) override {
     return WriteWithMetadata(batch, nullptr);
@@ -268,7 +337,7 @@ class GrpcStreamWriter : public FlightStreamWriter {
       return Status::OK();
     }
     done_writing_ = true;
-    if (!writer_->WritesDone()) {
+    if (!payload_writer_->WritesDone()) {
       return Status::IOError("Could not flush pending record batches.");
     }
     return Status::OK();
@@ -279,21 +348,24 @@ class GrpcStreamWriter : public FlightStreamWriter {
   Status Close() override { return batch_writer_->Close(); }
 
  private:
-  friend class DoPutPayloadWriter;
+  friend class GrpcPayloadWriter<ProtoReadT>;
   std::shared_ptr<Buffer> app_metadata_;
   std::unique_ptr<ipc::RecordBatchWriter> batch_writer_;
-  std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer_;
+  // Owned by batch_writer_
+  GrpcPayloadWriter<ProtoReadT>* payload_writer_ = nullptr;
+  std::shared_ptr<GrpcWriteStream<ProtoReadT>> writer_;
   bool done_writing_ = false;
 };
 
-/// A IpcPayloadWriter implementation that writes to a DoPut stream
-class DoPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
+/// A IpcPayloadWriter implementation that writes to a DoPut or DoExchange stream
+template <typename ProtoReadT>
+class GrpcPayloadWriter : public ipc::internal::IpcPayloadWriter {
  public:
-  DoPutPayloadWriter(
-      const FlightDescriptor& descriptor, std::unique_ptr<ClientRpc> rpc,
-      std::unique_ptr<pb::PutResult> response, std::shared_ptr<std::mutex> read_mutex,
-      std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer,
-      GrpcStreamWriter* stream_writer)
+  GrpcPayloadWriter(const FlightDescriptor& descriptor, std::shared_ptr<ClientRpc> rpc,
+                    std::unique_ptr<pb::PutResult> response,
+                    std::shared_ptr<std::mutex> read_mutex,
+                    std::shared_ptr<GrpcWriteStream<ProtoReadT>> writer,
+                    GrpcStreamWriter<ProtoReadT>* stream_writer)
       : descriptor_(descriptor),
         rpc_(std::move(rpc)),
         response_(std::move(response)),
@@ -302,7 +374,7 @@ class DoPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
         first_payload_(true),
         stream_writer_(stream_writer) {}
 
-  ~DoPutPayloadWriter() override = default;
+  ~GrpcPayloadWriter() override = default;
 
   Status Start() override { return Status::OK(); }
 
@@ -310,6 +382,10 @@ class DoPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
     FlightPayload payload;
     payload.ipc_message = ipc_payload;
 
+    if (ipc_payload.type == ipc::Message::SCHEMA && !first_payload_) {
+      // Already sent by GrpcStreamWriter::Begin
+      return Status::OK();
+    }
     if (first_payload_) {
       // First Flight message needs to encore the Flight descriptor
       if (ipc_payload.type != ipc::Message::SCHEMA) {
@@ -330,23 +406,19 @@ class DoPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
       payload.app_metadata = std::move(stream_writer_->app_metadata_);
     }
 
-    if (!internal::WritePayload(payload, writer_.get())) {
+    if (!internal::WritePayload(payload, writer_.get(), rpc_->write_options)) {
       return rpc_->IOError("Could not write record batch to stream: ");
     }
     return Status::OK();
   }
 
+  /// \brief Tell the server we're done writing, unless the reader already
+  /// finished the call
+  bool WritesDone() { return rpc_->finished || writer_->WritesDone(); }
+
   Status Close() override {
-    bool finished_writes = stream_writer_->done_writing_ ? true : writer_->WritesDone();
-    // Drain the read side to avoid hanging
-    std::unique_lock<std::mutex> guard(*read_mutex_, std::try_to_lock);
-    if (!guard.owns_lock()) {
-      return Status::IOError("Cannot close stream with pending read operation.");
-    }
-    pb::PutResult message;
-    while (writer_->Read(&message)) {
-    }
-    RETURN_NOT_OK(internal::FromGrpcStatus(writer_->Finish()));
+    bool finished_writes = stream_writer_->done_writing_ ? true : WritesDone();
+    RETURN_NOT_OK(FinishWriteStream(writer_.get(), read_mutex_.get()));
     if (!finished_writes) {
       return Status::UnknownError(
           "Could not finish writing record batches before closing");
@@ -357,25 +429,29 @@ class DoPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
  protected:
   // TODO: there isn't a way to access this as a user.
   const FlightDescriptor descriptor_;
-  std::unique_ptr<ClientRpc> rpc_;
+  std::shared_ptr<ClientRpc> rpc_;
   std::unique_ptr<pb::PutResult> response_;
   std::shared_ptr<std::mutex> read_mutex_;
-  std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer_;
+  std::shared_ptr<GrpcWriteStream<ProtoReadT>> writer_;
   bool first_payload_;
-  GrpcStreamWriter* stream_writer_;
+  GrpcStreamWriter<ProtoReadT>* stream_writer_;
 };
 
-Status GrpcStreamWriter::Open(
+template <typename ProtoReadT>
+Status GrpcStreamWriter<ProtoReadT>::Open(
     const FlightDescriptor& descriptor, const std::shared_ptr<Schema>& schema,
-    std::unique_ptr<ClientRpc> rpc, std::unique_ptr<pb::PutResult> response,
-    std::shared_ptr<std::mutex> read_mutex,
-    std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer,
-    std::unique_ptr<FlightStreamWriter>* out) {
+    const ipc::IpcOptions& ipc_options, std::shared_ptr<ClientRpc> rpc,
+    std::unique_ptr<pb::PutResult> response, std::shared_ptr<std::mutex> read_mutex,
+    std::shared_ptr<GrpcWriteStream<ProtoReadT>> writer,
+    std::unique_ptr<GrpcStreamWriter>* out) {
   std::unique_ptr<GrpcStreamWriter> result(new GrpcStreamWriter(writer));
-  std::unique_ptr<ipc::internal::IpcPayloadWriter> payload_writer(new DoPutPayloadWriter(
-      descriptor, std::move(rpc), std::move(response), read_mutex, writer, result.get()));
-  RETURN_NOT_OK(ipc::internal::OpenRecordBatchWriter(std::move(payload_writer), schema,
-                                                     &result->batch_writer_));
+  result->payload_writer_ = new GrpcPayloadWriter<ProtoReadT>(
+      descriptor, std::move(rpc), std::move(response), read_mutex, writer, result.get());
+  std::unique_ptr<ipc::internal::IpcPayloadWriter> payload_writer(
+      result->payload_writer_);
+  ARROW_ASSIGN_OR_RAISE(result->batch_writer_,
+                        ipc::internal::OpenRecordBatchWriter(std::move(payload_writer),
+                                                             schema, ipc_options));
   *out = std::move(result);
   return Status::OK();
 }
@@ -435,8 +511,11 @@ class FlightClient::FlightClientImpl {
     grpc::ChannelArguments args;
     // Try to reconnect quickly at first, in case the server is still starting up
     args.SetInt(GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS, 100);
-    // Receive messages of any size
-    args.SetMaxReceiveMessageSize(-1);
+    args.SetMaxReceiveMessageSize(options.max_receive_message_size);
+    if (options.write_buffer_size > 0) {
+      args.SetInt(GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE, options.write_buffer_size);
+      write_options_.set_buffer_hint();
+    }
 
     if (options.override_hostname != "") {
       args.SetSslTargetNameOverride(options.override_hostname);
@@ -573,13 +652,15 @@ class FlightClient::FlightClientImpl {
     pb::Ticket pb_ticket;
     internal::ToProto(ticket, &pb_ticket);
 
-    std::unique_ptr<ClientRpc> rpc(new ClientRpc(options));
+    std::shared_ptr<ClientRpc> rpc(new ClientRpc(options));
     RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
-    std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream(
+    std::shared_ptr<grpc::ClientReader<pb::FlightData>> stream(
         stub_->DoGet(&rpc->context, pb_ticket));
 
     std::unique_ptr<GrpcStreamReader> reader;
     RETURN_NOT_OK(GrpcStreamReader::Open(std::move(rpc), std::move(stream), &reader));
+    // The server sends the schema first, read it now to report errors early
+    RETURN_NOT_OK(reader->EnsureDataStarted());
     *out = std::move(reader);
     return Status::OK();
   }
@@ -588,21 +669,52 @@ class FlightClient::FlightClientImpl {
                const std::shared_ptr<Schema>& schema,
                std::unique_ptr<FlightStreamWriter>* out,
                std::unique_ptr<FlightMetadataReader>* reader) {
-    std::unique_ptr<ClientRpc> rpc(new ClientRpc(options));
+    std::shared_ptr<ClientRpc> rpc(new ClientRpc(options));
     RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
+    rpc->write_options = write_options_;
     std::unique_ptr<pb::PutResult> response(new pb::PutResult);
-    std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer(
-        stub_->DoPut(&rpc->context));
+    std::shared_ptr<GrpcWriteStream<pb::PutResult>> writer(stub_->DoPut(&rpc->context));
 
     std::shared_ptr<std::mutex> read_mutex = std::make_shared<std::mutex>();
     *reader =
         std::unique_ptr<FlightMetadataReader>(new GrpcMetadataReader(writer, read_mutex));
-    return GrpcStreamWriter::Open(descriptor, schema, std::move(rpc), std::move(response),
-                                  read_mutex, writer, out);
+    std::unique_ptr<GrpcStreamWriter<pb::PutResult>> stream_writer;
+    RETURN_NOT_OK(GrpcStreamWriter<pb::PutResult>::Open(
+        descriptor, schema, options.ipc_write_options, std::move(rpc),
+        std::move(response), read_mutex, writer, &stream_writer));
+    *out = std::move(stream_writer);
+    return Status::OK();
+  }
+
+  Status DoExchange(const FlightCallOptions& options, const FlightDescriptor& descriptor,
+                    const std::shared_ptr<Schema>& schema,
+                    std::unique_ptr<FlightStreamWriter>* writer,
+                    std::unique_ptr<FlightStreamReader>* reader) {
+    std::shared_ptr<ClientRpc> rpc(new ClientRpc(options));
+    RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
+    rpc->write_options = write_options_;
+    std::shared_ptr<GrpcWriteStream<pb::FlightData>> stream(
+        stub_->DoExchange(&rpc->context));
+
+    // The server may only send its schema after reading some of our data, so
+    // the reader doesn't wait for it here
+    std::unique_ptr<GrpcStreamReader> stream_reader;
+    RETURN_NOT_OK(GrpcStreamReader::Open(rpc, stream, &stream_reader));
+    std::unique_ptr<GrpcStreamWriter<pb::FlightData>> stream_writer;
+    RETURN_NOT_OK(GrpcStreamWriter<pb::FlightData>::Open(
+        descriptor, schema, options.ipc_write_options, std::move(rpc), nullptr, nullptr,
+        stream, &stream_writer));
+    // The server waits for the descriptor before handing the call to the
+    // application
+    RETURN_NOT_OK(stream_writer->Begin(schema, options.ipc_write_options));
+    *writer = std::move(stream_writer);
+    *reader = std::move(stream_reader);
+    return Status::OK();
   }
 
  private:
   std::unique_ptr<pb::FlightService::Stub> stub_;
+  grpc::WriteOptions write_options_;
   std::shared_ptr<ClientAuthHandler> auth_handler_;
 };
 
@@ -671,5 +783,13 @@ Status FlightClient::DoPut(const FlightCallOptions& options,
   return impl_->DoPut(options, descriptor, schema, stream, reader);
 }
 
+Status FlightClient::DoExchange(const FlightCallOptions& options,
+                                const FlightDescriptor& descriptor,
+                                const std::shared_ptr<Schema>& schema,
+                                std::unique_ptr<FlightStreamWriter>* writer,
+                                std::unique_ptr<FlightStreamReader>* reader) {
+  return impl_->DoExchange(options, descriptor, schema, writer, reader);
+}
+
 }  // namespace flight
 }  // namespace arrow
@@ -25,6 +25,7 @@
 #include <string>
 #include <vector>
 
+#include "arrow/ipc/options.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/status.h"
@@ -55,6 +56,11 @@ class ARROW_FLIGHT_EXPORT FlightCallOptions {
   /// mean an implementation-defined default behavior will be used
   /// instead. This is the default value.
   TimeoutDuration timeout;
+
+  /// \brief IPC options for the record batches written by DoPut and
+  /// DoExchange, e.g. to compress their bodies. The server detects the
+  /// codec of each message, there is nothing to configure on its side.
+  ipc::IpcOptions ipc_write_options;
 };
 
 class ARROW_FLIGHT_EXPORT FlightClientOptions {
@@ -64,6 +70,17 @@ class ARROW_FLIGHT_EXPORT FlightClientOptions {
   std::string tls_root_certs;
   /// \brief Override the hostname checked by TLS. Use with caution.
   std::string override_hostname;
+  /// \brief The largest message the client accepts, in bytes, or -1 for
+  /// no limit (the default).
+  int max_receive_message_size = -1;
+  /// \brief If positive, record batches are written with the gRPC buffer
+  /// hint, so that up to this many bytes per stream may be coalesced into
+  /// fewer network writes.
+  ///
+  /// A batch may then only be sent with the next ones or at the end of the
+  /// stream, so this is meant for bulk uploads rather than exchanges where
+  /// the server answers each batch.
+  int write_buffer_size = 0;
 };
 
 /// \brief A RecordBatchReader exposing Flight metadata and cancel
@@ -236,6 +253,32 @@ class ARROW_FLIGHT_EXPORT FlightClient {
     return DoPut({}, descriptor, schema, stream, reader);
   }
 
+  /// \brief Exchange record batches with the server in a single call, e.g.
+  /// to have the server transform them
+  ///
+  /// The descriptor and schema are sent right away. The server's batches can
+  /// be read while writing, from another thread; the reader's schema is only
+  /// known after the first call to Next(), which waits for the server to send
+  /// it. Closing the writer only ends the write side, read the reader to
+  /// the end to get the status of the call.
+  ///
+  /// \param[in] options Per-RPC options
+  /// \param[in] descriptor the descriptor of the exchange
+  /// \param[in] schema the schema of the data sent to the server
+  /// \param[out] writer a writer to send record batches to the server
+  /// \param[out] reader a reader for the record batches sent by the server
+  /// \return Status
+  Status DoExchange(const FlightCallOptions& options, const FlightDescriptor& descriptor,
+                    const std::shared_ptr<Schema>& schema,
+                    std::unique_ptr<FlightStreamWriter>* writer,
+                    std::unique_ptr<FlightStreamReader>* reader);
+  Status DoExchange(const FlightDescriptor& descriptor,
+                    const std::shared_ptr<Schema>& schema,
+                    std::unique_ptr<FlightStreamWriter>* writer,
+                    std::unique_ptr<FlightStreamReader>* reader) {
+    return DoExchange({}, descriptor, schema, writer, reader);
+  }
+
  private:
   FlightClient();
   class FlightClientImpl;
@@ -15,7 +15,10 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <cctype>
 #include <cstdint>
+#include <ctime>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -28,6 +31,7 @@
 #include "arrow/ipc/api.h"
 #include "arrow/record_batch.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/stopwatch.h"
 #include "arrow/util/thread_pool.h"
 
@@ -45,6 +49,12 @@ DEFINE_int32(num_threads, 4, "Number of concurrent gets");
 DEFINE_int32(records_per_stream, 10000000, "Total records per stream");
 DEFINE_int32(records_per_batch, 4096, "Total records per batch within stream");
 DEFINE_bool(test_put, false, "Test DoPut instead of DoGet");
+DEFINE_string(compression, "uncompressed",
+              "Comma-separated IPC body codecs to test one after the other, among "
+              "uncompressed, lz4 and zstd");
+DEFINE_int32(write_buffer_size, 0,
+             "Let gRPC coalesce the writes of record batches up to this many bytes "
+             "per stream (0 to write each batch right away)");
 
 namespace perf = arrow::flight::perf;
 
@@ -133,7 +143,11 @@ arrow::Result<PerformanceResult> RunDoPutTest(FlightClient* client,
   std::shared_ptr<Schema> schema =
       arrow::schema({field("a", int64()), field("b", int64()), field("c", int64()),
                      field("d", int64())});
-  RETURN_NOT_OK(client->DoPut(FlightDescriptor{}, schema, &writer, &reader));
+  FlightCallOptions call_options;
+  call_options.ipc_write_options.compression =
+      static_cast<Compression::type>(token.definition().compression());
+  RETURN_NOT_OK(
+      client->DoPut(call_options, FlightDescriptor{}, schema, &writer, &reader));
 
   // This is hard-coded for right now, 4 columns each with int64
   const int bytes_per_record = 32;
@@ -178,7 +192,19 @@ arrow::Result<PerformanceResult> RunDoPutTest(FlightClient* client,
   return PerformanceResult{num_records, num_bytes};
 }
 
-Status RunPerformanceTest(FlightClient* client, bool test_put) {
+Status ParseCompression(std::string name, Compression::type* out) {
+  std::transform(name.begin(), name.end(), name.begin(), ::toupper);
+  for (auto type : {Compression::UNCOMPRESSED, Compression::LZ4, Compression::ZSTD}) {
+    if (name == util::Codec::GetCodecAsString(type)) {
+      *out = type;
+      return Status::OK();
+    }
+  }
+  return Status::Invalid("Unsupported compression: ", name);
+}
+
+Status RunPerformanceTest(FlightClient* client, bool test_put,
+                          Compression::type compression) {
   // TODO(wesm): Multiple servers
   // std::vector<std::unique_ptr<TestServer>> servers;
 
@@ -187,6 +213,9 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
   perf.set_stream_count(FLAGS_num_streams);
   perf.set_records_per_stream(FLAGS_records_per_stream);
   perf.set_records_per_batch(FLAGS_records_per_batch);
+  // The server compresses the DoGet streams, the DoPut streams are compressed
+  // here
+  perf.set_compression(compression);
 
   // Plan the query
   FlightDescriptor descriptor;
@@ -206,7 +235,10 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
   auto ConsumeStream = [&stats, &test_loop](const FlightEndpoint& endpoint) {
     // TODO(wesm): Use location from endpoint, same host/port for now
     std::unique_ptr<FlightClient> client;
-    RETURN_NOT_OK(FlightClient::Connect(endpoint.locations.front(), &client));
+    FlightClientOptions client_options;
+    client_options.write_buffer_size = FLAGS_write_buffer_size;
+    RETURN_NOT_OK(
+        FlightClient::Connect(endpoint.locations.front(), client_options, &client));
 
     perf::Token token;
     token.ParseFromString(endpoint.ticket.ticket);
@@ -221,6 +253,8 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
 
   StopWatch timer;
   timer.Start();
+  // CPU time of this process, so it doesn't include a spawned server
+  const std::clock_t cpu_start = std::clock();
 
   // XXX(wesm): Serial version for debugging
   // for (const auto& endpoint : plan->endpoints()) {
@@ -243,6 +277,8 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
   uint64_t elapsed_nanos = timer.Stop();
   double time_elapsed =
       static_cast<double>(elapsed_nanos) / static_cast<double>(1000000000);
+  const double cpu_elapsed =
+      static_cast<double>(std::clock() - cpu_start) / static_cast<double>(CLOCKS_PER_SEC);
 
   constexpr double kMegabyte = static_cast<double>(1 << 20);
 
@@ -251,11 +287,20 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
     return Status::Invalid("Did not consume expected number of records");
   }
 
+  std::cout << "Compression: " << util::Codec::GetCodecAsString(compression)
+            << std::endl;
   std::cout << "Bytes read: " << stats.total_bytes << std::endl;
   std::cout << "Nanos: " << elapsed_nanos << std::endl;
   std::cout << "Speed: "
             << (static_cast<double>(stats.total_bytes) / kMegabyte / time_elapsed)
             << " MB/s" << std::endl;
+  // Bytes are the uncompressed size of the batches, whatever the codec
+  // The server compresses the DoGet streams in its own process, the figure is
+  // then only the decompression cost
+  std::cout << (test_put ? "Client CPU (compression): " : "Client CPU (decompression): ")
+            << cpu_elapsed << " s, "
+            << (cpu_elapsed * 1e9 / static_cast<double>(stats.total_bytes))
+            << " ns/byte" << std::endl;
   return Status::OK();
 }
 
@@ -269,8 +314,9 @@ int main(int argc, char** argv) {
   std::string hostname = "localhost";
   if (FLAGS_server_host == "") {
     std::cout << "Using remote server: false" << std::endl;
-    server.reset(
-        new arrow::flight::TestServer("arrow-flight-perf-server", FLAGS_server_port));
+    server.reset(new arrow::flight::TestServer(
+        "arrow-flight-perf-server", FLAGS_server_port,
+        {"-write_buffer_size", std::to_string(FLAGS_write_buffer_size)}));
     server->Start();
   } else {
     std::cout << "Using remote server: true" << std::endl;
@@ -295,7 +341,16 @@ int main(int argc, char** argv) {
   ABORT_NOT_OK(arrow::flight::FlightClient::Connect(location, &client));
   ABORT_NOT_OK(arrow::flight::WaitForReady(client.get()));
 
-  arrow::Status s = arrow::flight::RunPerformanceTest(client.get(), FLAGS_test_put);
+  arrow::Status s;
+  std::stringstream codecs(FLAGS_compression);
+  std::string codec;
+  while (s.ok() && std::getline(codecs, codec, ',')) {
+    arrow::Compression::type compression;
+    s = arrow::flight::ParseCompression(codec, &compression);
+    if (s.ok()) {
+      s = arrow::flight::RunPerformanceTest(client.get(), FLAGS_test_put, compression);
+    }
+  }
 
   if (server) {
     server->Stop();
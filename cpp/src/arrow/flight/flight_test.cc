@@ -31,6 +31,7 @@
 
 #include "arrow/ipc/test_common.h"
 #include "arrow/status.h"
+#include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 
@@ -381,6 +382,64 @@ class DoPutTestServer : public FlightServerBase {
   friend class TestDoPut;
 };
 
+class DoExchangeTestServer : public FlightServerBase {
+ public:
+  // Echo the batches back, numbering them in the application metadata
+  Status DoExchange(const ServerCallContext& context,
+                    std::unique_ptr<FlightMessageReader> reader,
+                    std::unique_ptr<FlightMessageWriter> writer) override {
+    if (reader->descriptor().type == FlightDescriptor::CMD) {
+      return Status::Invalid("Unsupported command: ", reader->descriptor().cmd);
+    }
+    RETURN_NOT_OK(writer->Begin(reader->schema()));
+    FlightStreamChunk chunk;
+    int counter = 0;
+    while (true) {
+      RETURN_NOT_OK(reader->Next(&chunk));
+      if (chunk.data == nullptr) break;
+      auto metadata = Buffer::FromString(std::to_string(counter));
+      RETURN_NOT_OK(writer->WriteWithMetadata(*chunk.data, metadata));
+      counter++;
+    }
+    return Status::OK();
+  }
+};
+
+// A batch of 1 MiB which compresses very well
+std::shared_ptr<RecordBatch> LargeCompressibleBatch() {
+  const int64_t length = 1 << 17;
+  return RecordBatch::Make(arrow::schema({field("a", int64())}), length,
+                           {ConstantArrayGenerator::Int64(length)});
+}
+
+class LargeBatchTestServer : public FlightServerBase {
+ public:
+  explicit LargeBatchTestServer(const ipc::IpcOptions& options) : options_(options) {}
+
+  // Send a large batch, written with the IPC options of the server
+  Status DoGet(const ServerCallContext& context, const Ticket& request,
+               std::unique_ptr<FlightDataStream>* data_stream) override {
+    auto batch = LargeCompressibleBatch();
+    std::shared_ptr<RecordBatchReader> batch_reader =
+        std::make_shared<BatchIterator>(batch->schema(), BatchVector{batch});
+    *data_stream = std::unique_ptr<FlightDataStream>(
+        new RecordBatchStream(batch_reader, default_memory_pool(), options_));
+    return Status::OK();
+  }
+
+  Status DoPut(const ServerCallContext& context,
+               std::unique_ptr<FlightMessageReader> reader,
+               std::unique_ptr<FlightMetadataWriter> writer) override {
+    return reader->ReadAll(&batches_);
+  }
+
+  const BatchVector& batches() const { return batches_; }
+
+ private:
+  ipc::IpcOptions options_;
+  BatchVector batches_;
+};
+
 class MetadataTestServer : public FlightServerBase {
   Status DoGet(const ServerCallContext& context, const Ticket& request,
                std::unique_ptr<FlightDataStream>* data_stream) override {
@@ -526,10 +585,11 @@ class TestDoPut : public ::testing::Test {
   }
 
   void CheckDoPut(FlightDescriptor descr, const std::shared_ptr<Schema>& schema,
-                  const BatchVector& batches) {
+                  const BatchVector& batches,
+                  const FlightCallOptions& options = FlightCallOptions()) {
     std::unique_ptr<FlightStreamWriter> stream;
     std::unique_ptr<FlightMetadataReader> reader;
-    ASSERT_OK(client_->DoPut(descr, schema, &stream, &reader));
+    ASSERT_OK(client_->DoPut(options, descr, schema, &stream, &reader));
     for (const auto& batch : batches) {
       ASSERT_OK(stream->WriteRecordBatch(*batch));
     }
@@ -545,6 +605,97 @@ class TestDoPut : public ::testing::Test {
   DoPutTestServer* do_put_server_;
 };
 
+class TestDoExchange : public ::testing::Test {
+ public:
+  void SetUp() { StartServer(); }
+
+  void StartServer(int write_buffer_size = 0) {
+    Location location;
+    ASSERT_OK(Location::ForGrpcTcp("localhost", ::arrow::GetListenPort(), &location));
+
+    std::unique_ptr<FlightServerBase> server(new DoExchangeTestServer);
+    FlightServerOptions options(location);
+    options.write_buffer_size = write_buffer_size;
+    ASSERT_OK(server->Init(options));
+    server_.reset(new InProcessTestServer(std::move(server), location));
+    ASSERT_OK(server_->Start());
+    ASSERT_OK(FlightClient::Connect(server_->location(), &client_));
+  }
+
+  void TearDown() { server_->Stop(); }
+
+  void CheckChunk(FlightStreamReader* reader, const RecordBatch& expected, int i) {
+    FlightStreamChunk chunk;
+    ASSERT_OK(reader->Next(&chunk));
+    ASSERT_NE(nullptr, chunk.data);
+    ASSERT_BATCHES_EQUAL(expected, *chunk.data);
+    ASSERT_NE(nullptr, chunk.app_metadata);
+    ASSERT_EQ(std::to_string(i), chunk.app_metadata->ToString());
+  }
+
+ protected:
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<InProcessTestServer> server_;
+};
+
+// Both sides only accept messages far smaller than LargeCompressibleBatch
+class TestMessageSize : public ::testing::Test {
+ public:
+  static constexpr int kMaxMessageSize = 1 << 16;
+
+  void StartServer(Compression::type compression) {
+    Location location;
+    ASSERT_OK(Location::ForGrpcTcp("localhost", ::arrow::GetListenPort(), &location));
+
+    auto ipc_options = ipc::IpcOptions::Defaults();
+    ipc_options.compression = compression;
+    large_batch_server_ = new LargeBatchTestServer(ipc_options);
+    server_.reset(new InProcessTestServer(
+        std::unique_ptr<FlightServerBase>(large_batch_server_), location));
+    FlightServerOptions options(location);
+    options.max_receive_message_size = kMaxMessageSize;
+    ASSERT_OK(large_batch_server_->Init(options));
+    ASSERT_OK(server_->Start());
+
+    FlightClientOptions client_options;
+    client_options.max_receive_message_size = kMaxMessageSize;
+    ASSERT_OK(FlightClient::Connect(server_->location(), client_options, &client_));
+  }
+
+  void TearDown() {
+    if (server_) {
+      server_->Stop();
+    }
+  }
+
+  Status DoGet(std::shared_ptr<RecordBatch>* out) {
+    std::unique_ptr<FlightStreamReader> stream;
+    RETURN_NOT_OK(client_->DoGet(Ticket{"large"}, &stream));
+    FlightStreamChunk chunk;
+    RETURN_NOT_OK(stream->Next(&chunk));
+    *out = chunk.data;
+    return Status::OK();
+  }
+
+  Status DoPut(const FlightCallOptions& options, const RecordBatch& batch) {
+    std::unique_ptr<FlightStreamWriter> writer;
+    std::unique_ptr<FlightMetadataReader> reader;
+    RETURN_NOT_OK(client_->DoPut(options, FlightDescriptor::Path({"large"}),
+                                 batch.schema(), &writer, &reader));
+    // When the server cancels the call, the write may or may not fail
+    // already, the status of the call is only known on close
+    ARROW_UNUSED(writer->WriteRecordBatch(batch));
+    return writer->Close();
+  }
+
+ protected:
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<InProcessTestServer> server_;
+  LargeBatchTestServer* large_batch_server_;
+};
+
+constexpr int TestMessageSize::kMaxMessageSize;
+
 class TestTls : public ::testing::Test {
  public:
   void SetUp() {
@@ -780,6 +931,153 @@ TEST_F(TestDoPut, DoPutDicts) {
   CheckDoPut(descr, schema, batches);
 }
 
+#ifdef ARROW_WITH_LZ4
+TEST_F(TestDoPut, DoPutCompressed) {
+  auto descr = FlightDescriptor::Path({"dicts"});
+  BatchVector batches;
+  ASSERT_OK(ExampleDictBatches(&batches));
+  FlightCallOptions options;
+  options.ipc_write_options.compression = Compression::LZ4;
+
+  CheckDoPut(descr, batches[0]->schema(), batches, options);
+}
+#endif
+
+TEST_F(TestDoPut, DoPutBufferedWrites) {
+  FlightClientOptions client_options;
+  client_options.write_buffer_size = 1 << 20;
+  ASSERT_OK(FlightClient::Connect(server_->location(), client_options, &client_));
+
+  auto descr = FlightDescriptor::Path({"ints"});
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+
+  CheckDoPut(descr, ExampleIntSchema(), batches);
+}
+
+TEST_F(TestDoExchange, WriteAllThenRead) {
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client_->DoExchange(FlightDescriptor::Path({"echo"}), ExampleIntSchema(),
+                                &writer, &reader));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->DoneWriting());
+
+  for (int i = 0; i < static_cast<int>(batches.size()); ++i) {
+    CheckChunk(reader.get(), *batches[i], i);
+  }
+  AssertSchemaEqual(*ExampleIntSchema(), *reader->schema());
+  FlightStreamChunk chunk;
+  ASSERT_OK(reader->Next(&chunk));
+  ASSERT_EQ(nullptr, chunk.data);
+  ASSERT_OK(writer->Close());
+}
+
+TEST_F(TestDoExchange, Interleaved) {
+  // Each batch is read back before sending the next one
+  BatchVector batches;
+  ASSERT_OK(ExampleDictBatches(&batches));
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client_->DoExchange(FlightDescriptor::Path({"echo"}), batches[0]->schema(),
+                                &writer, &reader));
+  ASSERT_EQ(nullptr, reader->schema());
+  for (int i = 0; i < static_cast<int>(batches.size()); ++i) {
+    ASSERT_OK(writer->WriteRecordBatch(*batches[i]));
+    CheckChunk(reader.get(), *batches[i], i);
+  }
+  ASSERT_OK(writer->Close());
+  FlightStreamChunk chunk;
+  ASSERT_OK(reader->Next(&chunk));
+  ASSERT_EQ(nullptr, chunk.data);
+}
+
+TEST_F(TestDoExchange, NoBatches) {
+  // The server begins its stream but writes no batches
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client_->DoExchange(FlightDescriptor::Path({"echo"}), ExampleIntSchema(),
+                                &writer, &reader));
+  ASSERT_OK(writer->DoneWriting());
+  FlightStreamChunk chunk;
+  ASSERT_OK(reader->Next(&chunk));
+  ASSERT_EQ(nullptr, chunk.data);
+  AssertSchemaEqual(*ExampleIntSchema(), *reader->schema());
+  ASSERT_OK(writer->Close());
+}
+
+TEST_F(TestDoExchange, ServerError) {
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client_->DoExchange(FlightDescriptor::Command("unknown"), ExampleIntSchema(),
+                                &writer, &reader));
+  FlightStreamChunk chunk;
+  ASSERT_RAISES(Invalid, reader->Next(&chunk));
+  ASSERT_OK(writer->Close());
+}
+
+TEST_F(TestDoExchange, ServerBufferedWrites) {
+  server_->Stop();
+  ASSERT_NO_FATAL_FAILURE(StartServer(/*write_buffer_size=*/1 << 20));
+
+  // The batches may only be sent once the server returns
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client_->DoExchange(FlightDescriptor::Path({"echo"}), ExampleIntSchema(),
+                                &writer, &reader));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->DoneWriting());
+
+  for (int i = 0; i < static_cast<int>(batches.size()); ++i) {
+    CheckChunk(reader.get(), *batches[i], i);
+  }
+  FlightStreamChunk chunk;
+  ASSERT_OK(reader->Next(&chunk));
+  ASSERT_EQ(nullptr, chunk.data);
+  ASSERT_OK(writer->Close());
+}
+
+TEST_F(TestMessageSize, DoGetTooLarge) {
+  ASSERT_NO_FATAL_FAILURE(StartServer(Compression::UNCOMPRESSED));
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_RAISES(Invalid, DoGet(&batch));
+}
+
+TEST_F(TestMessageSize, DoPutTooLarge) {
+  ASSERT_NO_FATAL_FAILURE(StartServer(Compression::UNCOMPRESSED));
+  ASSERT_RAISES(Invalid, DoPut(FlightCallOptions(), *LargeCompressibleBatch()));
+}
+
+#ifdef ARROW_WITH_LZ4
+// The batch only fits in the limits once compressed
+
+TEST_F(TestMessageSize, DoGetCompressed) {
+  ASSERT_NO_FATAL_FAILURE(StartServer(Compression::LZ4));
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(DoGet(&batch));
+  ASSERT_NE(nullptr, batch);
+  ASSERT_BATCHES_EQUAL(*LargeCompressibleBatch(), *batch);
+}
+
+TEST_F(TestMessageSize, DoPutCompressed) {
+  ASSERT_NO_FATAL_FAILURE(StartServer(Compression::UNCOMPRESSED));
+  FlightCallOptions options;
+  options.ipc_write_options.compression = Compression::LZ4;
+  auto batch = LargeCompressibleBatch();
+  ASSERT_OK(DoPut(options, *batch));
+  ASSERT_EQ(1, large_batch_server_->batches().size());
+  ASSERT_BATCHES_EQUAL(*batch, *large_batch_server_->batches()[0]);
+}
+#endif
+
 TEST_F(TestAuthHandler, PassAuthenticatedCalls) {
   ASSERT_OK(client_->Authenticate(
       {},
@@ -31,6 +31,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
 
 #include "arrow/flight/api.h"
@@ -39,6 +40,9 @@
 #include "arrow/flight/test_util.h"
 
 DEFINE_int32(port, 31337, "Server port to listen on");
+DEFINE_int32(write_buffer_size, 0,
+             "Let gRPC coalesce the writes of record batches up to this many bytes "
+             "per stream (0 to write each batch right away)");
 
 namespace perf = arrow::flight::perf;
 namespace proto = arrow::flight::protocol;
@@ -60,15 +64,18 @@ using ArrayVector = std::vector<std::shared_ptr<Array>>;
 class PerfDataStream : public FlightDataStream {
  public:
   PerfDataStream(bool verify, const int64_t start, const int64_t total_records,
-                 const std::shared_ptr<Schema>& schema, const ArrayVector& arrays)
+                 const std::shared_ptr<Schema>& schema, const ArrayVector& arrays,
+                 Compression::type compression)
       : start_(start),
         verify_(verify),
         batch_length_(arrays[0]->length()),
         total_records_(total_records),
         records_sent_(0),
         schema_(schema),
+        ipc_options_(ipc::IpcOptions::Defaults()),
         arrays_(arrays) {
     batch_ = RecordBatch::Make(schema, batch_length_, arrays_);
+    ipc_options_.compression = compression;
   }
 
   std::shared_ptr<Schema> schema() override { return schema_; }
@@ -134,9 +141,9 @@ Status GetPerfBatches(const perf::Token& token, const std::shared_ptr<Schema>& s
     RETURN_NOT_OK(arrays.back()->Validate());
   }
 
-  *data_stream = std::unique_ptr<FlightDataStream>(
-      new PerfDataStream(use_verifier, token.start(),
-                         token.definition().records_per_stream(), schema, arrays));
+  *data_stream = std::unique_ptr<FlightDataStream>(new PerfDataStream(
+      use_verifier, token.start(), token.definition().records_per_stream(), schema,
+      arrays, static_cast<Compression::type>(token.definition().compression())));
   return Status::OK();
 }
 
@@ -233,6 +240,7 @@ int main(int argc, char** argv) {
   arrow::flight::Location location;
   ARROW_CHECK_OK(arrow::flight::Location::ForGrpcTcp("0.0.0.0", FLAGS_port, &location));
   arrow::flight::FlightServerOptions options(location);
+  options.write_buffer_size = FLAGS_write_buffer_size;
 
   ARROW_CHECK_OK(g_server->Init(options));
   // Exit with a clean error code (0) on SIGTERM
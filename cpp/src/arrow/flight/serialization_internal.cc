@@ -251,7 +251,9 @@ grpc::Status FlightDataSerialize(const FlightPayload& msg, ByteBuffer* out,
       const auto remainder = static_cast<int>(
           BitUtil::RoundUpToMultipleOf8(buffer->size()) - buffer->size());
       if (remainder) {
-        slices.push_back(grpc::Slice(kPaddingBytes, remainder));
+        // Static slice, so the padding isn't copied either
+        slices.push_back(
+            grpc::Slice(kPaddingBytes, remainder, grpc::Slice::STATIC_SLICE));
       }
     }
   }
@@ -354,29 +356,64 @@ Status FlightData::OpenMessage(std::unique_ptr<ipc::Message>* message) {
 // pointer argument whichever way we want, including cast it back to the original type.
 // (see customize_protobuf.h).
 
-bool WritePayload(const FlightPayload& payload,
-                  grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>* writer) {
+namespace {
+
+template <typename GrpcWriter>
+bool WritePayloadImpl(const FlightPayload& payload, GrpcWriter* writer,
+                      const grpc::WriteOptions& options) {
   // Pretend to be pb::FlightData and intercept in SerializationTraits
-  return writer->Write(*reinterpret_cast<const pb::FlightData*>(&payload),
-                       grpc::WriteOptions());
+  return writer->Write(*reinterpret_cast<const pb::FlightData*>(&payload), options);
 }
 
-bool WritePayload(const FlightPayload& payload,
-                  grpc::ServerWriter<pb::FlightData>* writer) {
+template <typename GrpcReader>
+bool ReadPayloadImpl(GrpcReader* reader, FlightData* data) {
   // Pretend to be pb::FlightData and intercept in SerializationTraits
-  return writer->Write(*reinterpret_cast<const pb::FlightData*>(&payload),
-                       grpc::WriteOptions());
+  return reader->Read(reinterpret_cast<pb::FlightData*>(data));
+}
+
+}  // namespace
+
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>* writer,
+                  const grpc::WriteOptions& options) {
+  return WritePayloadImpl(payload, writer, options);
+}
+
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>* writer,
+                  const grpc::WriteOptions& options) {
+  return WritePayloadImpl(payload, writer, options);
+}
+
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ServerWriter<pb::FlightData>* writer,
+                  const grpc::WriteOptions& options) {
+  return WritePayloadImpl(payload, writer, options);
+}
+
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* writer,
+                  const grpc::WriteOptions& options) {
+  return WritePayloadImpl(payload, writer, options);
 }
 
 bool ReadPayload(grpc::ClientReader<pb::FlightData>* reader, FlightData* data) {
-  // Pretend to be pb::FlightData and intercept in SerializationTraits
-  return reader->Read(reinterpret_cast<pb::FlightData*>(data));
+  return ReadPayloadImpl(reader, data);
+}
+
+bool ReadPayload(grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>* reader,
+                 FlightData* data) {
+  return ReadPayloadImpl(reader, data);
 }
 
 bool ReadPayload(grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader,
                  FlightData* data) {
-  // Pretend to be pb::FlightData and intercept in SerializationTraits
-  return reader->Read(reinterpret_cast<pb::FlightData*>(data));
+  return ReadPayloadImpl(reader, data);
+}
+
+bool ReadPayload(grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* reader,
+                 FlightData* data) {
+  return ReadPayloadImpl(reader, data);
 }
 
 #ifndef _WIN32
@@ -55,16 +55,29 @@ struct FlightData {
 
 /// Write Flight message on gRPC stream with zero-copy optimizations.
 /// True is returned on success, false if some error occurred (connection closed?).
+/// The options may set the buffer hint to let gRPC coalesce messages.
 bool WritePayload(const FlightPayload& payload,
-                  grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>* writer);
+                  grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>* writer,
+                  const grpc::WriteOptions& options = grpc::WriteOptions());
 bool WritePayload(const FlightPayload& payload,
-                  grpc::ServerWriter<pb::FlightData>* writer);
+                  grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>* writer,
+                  const grpc::WriteOptions& options = grpc::WriteOptions());
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ServerWriter<pb::FlightData>* writer,
+                  const grpc::WriteOptions& options = grpc::WriteOptions());
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* writer,
+                  const grpc::WriteOptions& options = grpc::WriteOptions());
 
 /// Read Flight message from gRPC stream with zero-copy optimizations.
 /// True is returned on success, false if stream ended.
 bool ReadPayload(grpc::ClientReader<pb::FlightData>* reader, FlightData* data);
+bool ReadPayload(grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>* reader,
+                 FlightData* data);
 bool ReadPayload(grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader,
                  FlightData* data);
+bool ReadPayload(grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* reader,
+                 FlightData* data);
 
 }  // namespace internal
 }  // namespace flight
@@ -70,12 +70,13 @@ namespace flight {
 
 namespace {
 
-// A MessageReader implementation that reads from a gRPC ServerReader
+// A MessageReader implementation that reads from a gRPC ServerReader, either
+// a DoPut or a DoExchange stream
+template <typename GrpcStream>
 class FlightIpcMessageReader : public ipc::MessageReader {
  public:
-  explicit FlightIpcMessageReader(
-      grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader,
-      std::shared_ptr<Buffer>* last_metadata)
+  explicit FlightIpcMessageReader(GrpcStream* reader,
+                                  std::shared_ptr<Buffer>* last_metadata)
       : reader_(reader), app_metadata_(last_metadata) {}
 
   Status ReadNextMessage(std::unique_ptr<ipc::Message>* out) override {
@@ -99,7 +100,7 @@ class FlightIpcMessageReader : public ipc::MessageReader {
 
     if (first_message_) {
       if (!data.descriptor) {
-        return Status::Invalid("DoPut must start with non-null descriptor");
+        return Status::Invalid("Stream must start with non-null descriptor");
       }
       descriptor_ = *data.descriptor;
       first_message_ = false;
@@ -113,21 +114,20 @@ class FlightIpcMessageReader : public ipc::MessageReader {
   const FlightDescriptor& descriptor() const { return descriptor_; }
 
  protected:
-  grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader_;
+  GrpcStream* reader_;
   bool stream_finished_ = false;
   bool first_message_ = true;
   FlightDescriptor descriptor_;
   std::shared_ptr<Buffer>* app_metadata_;
 };
 
+template <typename GrpcStream>
 class FlightMessageReaderImpl : public FlightMessageReader {
  public:
-  explicit FlightMessageReaderImpl(
-      grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader)
-      : reader_(reader) {}
+  explicit FlightMessageReaderImpl(GrpcStream* reader) : reader_(reader) {}
 
   Status Init() {
-    message_reader_ = new FlightIpcMessageReader(reader_, &last_metadata_);
+    message_reader_ = new FlightIpcMessageReader<GrpcStream>(reader_, &last_metadata_);
     return ipc::RecordBatchStreamReader::Open(
         std::unique_ptr<ipc::MessageReader>(message_reader_), &batch_reader_);
   }
@@ -148,8 +148,8 @@ class FlightMessageReaderImpl : public FlightMessageReader {
  private:
   std::shared_ptr<Schema> schema_;
   std::unique_ptr<ipc::DictionaryMemo> dictionary_memo_;
-  grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader_;
-  FlightIpcMessageReader* message_reader_;
+  GrpcStream* reader_;
+  FlightIpcMessageReader<GrpcStream>* message_reader_;
   std::shared_ptr<Buffer> last_metadata_;
   std::shared_ptr<RecordBatchReader> batch_reader_;
 };
@@ -173,6 +173,104 @@ class GrpcMetadataWriter : public FlightMetadataWriter {
   grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* writer_;
 };
 
+using DoPutStream = grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>;
+using DoExchangeStream = grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>;
+
+class DoExchangeMessageWriter;
+
+// An IpcPayloadWriter sending the batches of a DoExchange back to the client
+class DoExchangePayloadWriter : public ipc::internal::IpcPayloadWriter {
+ public:
+  DoExchangePayloadWriter(DoExchangeStream* stream, DoExchangeMessageWriter* writer,
+                          const grpc::WriteOptions& write_options)
+      : stream_(stream),
+        message_writer_(writer),
+        write_options_(write_options),
+        schema_sent_(false) {}
+
+  Status WritePayload(const ipc::internal::IpcPayload& ipc_payload) override;
+
+  Status Close() override {
+    // The stream is finished by returning from the RPC handler
+    return Status::OK();
+  }
+
+ private:
+  DoExchangeStream* stream_;
+  DoExchangeMessageWriter* message_writer_;
+  grpc::WriteOptions write_options_;
+  bool schema_sent_;
+};
+
+class DoExchangeMessageWriter : public FlightMessageWriter {
+ public:
+  DoExchangeMessageWriter(DoExchangeStream* stream,
+                          const grpc::WriteOptions& write_options)
+      : stream_(stream), write_options_(write_options) {}
+
+  using FlightMessageWriter::Begin;
+
+  Status Begin(const std::shared_ptr<Schema>& schema,
+               const ipc::IpcOptions& options) override {
+    if (batch_writer_) {
+      return Status::Invalid("This writer has already been started.");
+    }
+    auto payload_writer = new DoExchangePayloadWriter(stream_, this, write_options_);
+    ARROW_ASSIGN_OR_RAISE(
+        batch_writer_,
+        ipc::internal::OpenRecordBatchWriter(
+            std::unique_ptr<ipc::internal::IpcPayloadWriter>(payload_writer), schema,
+            options));
+    // Send the schema now, so that the client can read it even if the
+    // handler writes no batches
+    ipc::DictionaryMemo dictionary_memo;
+    ipc::internal::IpcPayload payload;
+    RETURN_NOT_OK(
+        ipc::internal::GetSchemaPayload(*schema, options, &dictionary_memo, &payload));
+    return payload_writer->WritePayload(payload);
+  }
+
+  Status WriteRecordBatch(const RecordBatch& batch) override {
+    return WriteWithMetadata(batch, nullptr);
+  }
+
+  Status WriteWithMetadata(const RecordBatch& batch,
+                           std::shared_ptr<Buffer> app_metadata) override {
+    if (!batch_writer_) {
+      return Status::Invalid("Must call Begin() before writing record batches.");
+    }
+    app_metadata_ = std::move(app_metadata);
+    return batch_writer_->WriteRecordBatch(batch);
+  }
+
+ private:
+  friend class DoExchangePayloadWriter;
+  DoExchangeStream* stream_;
+  grpc::WriteOptions write_options_;
+  std::unique_ptr<ipc::RecordBatchWriter> batch_writer_;
+  std::shared_ptr<Buffer> app_metadata_;
+};
+
+Status DoExchangePayloadWriter::WritePayload(
+    const ipc::internal::IpcPayload& ipc_payload) {
+  if (ipc_payload.type == ipc::Message::SCHEMA) {
+    if (schema_sent_) {
+      // Already sent by DoExchangeMessageWriter::Begin
+      return Status::OK();
+    }
+    schema_sent_ = true;
+  }
+  FlightPayload payload;
+  payload.ipc_message = ipc_payload;
+  if (ipc_payload.type == ipc::Message::RECORD_BATCH && message_writer_->app_metadata_) {
+    payload.app_metadata = std::move(message_writer_->app_metadata_);
+  }
+  if (!internal::WritePayload(payload, stream_, write_options_)) {
+    return Status::IOError("Could not write record batch to stream");
+  }
+  return Status::OK();
+}
+
 class GrpcServerAuthReader : public ServerAuthReader {
  public:
   explicit GrpcServerAuthReader(
@@ -225,9 +323,9 @@ class GrpcServerCallContext : public ServerCallContext {
 // gRPC service definition, so the latter is not exposed in the public API
 class FlightServiceImpl : public FlightService::Service {
  public:
-  explicit FlightServiceImpl(std::shared_ptr<ServerAuthHandler> auth_handler,
-                             FlightServerBase* server)
-      : auth_handler_(auth_handler), server_(server) {}
+  FlightServiceImpl(std::shared_ptr<ServerAuthHandler> auth_handler,
+                    FlightServerBase* server, const grpc::WriteOptions& write_options)
+      : auth_handler_(auth_handler), server_(server), write_options_(write_options) {}
 
   template <typename UserType, typename Iterator, typename ProtoType>
   grpc::Status WriteStream(Iterator* iterator, ServerWriter<ProtoType>* writer) {
@@ -394,7 +492,7 @@ class FlightServiceImpl : public FlightService::Service {
       FlightPayload payload;
       GRPC_RETURN_NOT_OK(data_stream->Next(&payload));
       if (payload.ipc_message.metadata == nullptr ||
-          !internal::WritePayload(payload, writer))
+          !internal::WritePayload(payload, writer, write_options_))
         // No more messages to write, or connection terminated for some other
         // reason
         break;
@@ -407,8 +505,8 @@ class FlightServiceImpl : public FlightService::Service {
     GrpcServerCallContext flight_context;
     GRPC_RETURN_NOT_GRPC_OK(CheckAuth(context, flight_context));
 
-    auto message_reader =
-        std::unique_ptr<FlightMessageReaderImpl>(new FlightMessageReaderImpl(reader));
+    auto message_reader = std::unique_ptr<FlightMessageReaderImpl<DoPutStream>>(
+        new FlightMessageReaderImpl<DoPutStream>(reader));
     GRPC_RETURN_NOT_OK(message_reader->Init());
     auto metadata_writer =
         std::unique_ptr<FlightMetadataWriter>(new GrpcMetadataWriter(reader));
@@ -416,6 +514,21 @@ class FlightServiceImpl : public FlightService::Service {
         flight_context, std::move(message_reader), std::move(metadata_writer)));
   }
 
+  grpc::Status DoExchange(ServerContext* context, DoExchangeStream* stream) {
+    GrpcServerCallContext flight_context;
+    GRPC_RETURN_NOT_GRPC_OK(CheckAuth(context, flight_context));
+
+    // The client sends its descriptor and schema first, so this doesn't wait
+    // on the client's data
+    auto message_reader = std::unique_ptr<FlightMessageReaderImpl<DoExchangeStream>>(
+        new FlightMessageReaderImpl<DoExchangeStream>(stream));
+    GRPC_RETURN_NOT_OK(message_reader->Init());
+    auto message_writer = std::unique_ptr<FlightMessageWriter>(
+        new DoExchangeMessageWriter(stream, write_options_));
+    return internal::ToGrpcStatus(server_->DoExchange(
+        flight_context, std::move(message_reader), std::move(message_writer)));
+  }
+
   grpc::Status ListActions(ServerContext* context, const pb::Empty* request,
                            ServerWriter<pb::ActionType>* writer) {
     GrpcServerCallContext flight_context;
@@ -461,10 +574,14 @@ class FlightServiceImpl : public FlightService::Service {
  private:
   std::shared_ptr<ServerAuthHandler> auth_handler_;
   FlightServerBase* server_;
+  // Options for the writes of record batches
+  grpc::WriteOptions write_options_;
 };
 
 }  // namespace
 
+FlightMessageWriter::~FlightMessageWriter() = default;
+
 FlightMetadataWriter::~FlightMetadataWriter() = default;
 
 //
@@ -518,7 +635,12 @@ thread_local std::atomic<FlightServerBase::Impl*>
 #endif
 
 FlightServerOptions::FlightServerOptions(const Location& location_)
-    : location(location_), auth_handler(nullptr), tls_certificates(), builder_hook() {}
+    : location(location_),
+      max_receive_message_size(-1),
+      write_buffer_size(0),
+      auth_handler(nullptr),
+      tls_certificates(),
+      builder_hook() {}
 
 FlightServerBase::FlightServerBase() { impl_.reset(new Impl); }
 
@@ -526,11 +648,18 @@ FlightServerBase::~FlightServerBase() {}
 
 Status FlightServerBase::Init(FlightServerOptions& options) {
   std::shared_ptr<ServerAuthHandler> handler = std::move(options.auth_handler);
-  impl_->service_.reset(new FlightServiceImpl(handler, this));
+  grpc::WriteOptions write_options;
+  if (options.write_buffer_size > 0) {
+    write_options.set_buffer_hint();
+  }
+  impl_->service_.reset(new FlightServiceImpl(handler, this, write_options));
 
   grpc::ServerBuilder builder;
-  // Allow uploading messages of any length
-  builder.SetMaxReceiveMessageSize(-1);
+  builder.SetMaxReceiveMessageSize(options.max_receive_message_size);
+  if (options.write_buffer_size > 0) {
+    builder.AddChannelArgument(GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE,
+                               options.write_buffer_size);
+  }
 
   const Location& location = options.location;
   const std::string scheme = location.scheme();
@@ -651,6 +780,12 @@ Status FlightServerBase::DoPut(const ServerCallContext& context,
   return Status::NotImplemented("NYI");
 }
 
+Status FlightServerBase::DoExchange(const ServerCallContext& context,
+                                    std::unique_ptr<FlightMessageReader> reader,
+                                    std::unique_ptr<FlightMessageWriter> writer) {
+  return Status::NotImplemented("NYI");
+}
+
 Status FlightServerBase::DoAction(const ServerCallContext& context, const Action& action,
                                   std::unique_ptr<ResultStream>* result) {
   return Status::NotImplemented("NYI");
@@ -680,8 +815,8 @@ class RecordBatchStream::RecordBatchStreamImpl {
   };
 
   RecordBatchStreamImpl(const std::shared_ptr<RecordBatchReader>& reader,
-                        MemoryPool* pool)
-      : pool_(pool), reader_(reader), ipc_options_(ipc::IpcOptions::Defaults()) {}
+                        MemoryPool* pool, const ipc::IpcOptions& options)
+      : pool_(pool), reader_(reader), ipc_options_(options) {}
 
   std::shared_ptr<Schema> schema() { return reader_->schema(); }
 
@@ -755,8 +890,8 @@ class RecordBatchStream::RecordBatchStreamImpl {
 FlightDataStream::~FlightDataStream() {}
 
 RecordBatchStream::RecordBatchStream(const std::shared_ptr<RecordBatchReader>& reader,
-                                     MemoryPool* pool) {
-  impl_.reset(new RecordBatchStreamImpl(reader, pool));
+                                     MemoryPool* pool, const ipc::IpcOptions& options) {
+  impl_.reset(new RecordBatchStreamImpl(reader, pool, options));
 }
 
 RecordBatchStream::~RecordBatchStream() {}
@@ -29,6 +29,7 @@
 #include "arrow/flight/types.h"       // IWYU pragma: keep
 #include "arrow/flight/visibility.h"  // IWYU pragma: keep
 #include "arrow/ipc/dictionary.h"
+#include "arrow/ipc/options.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 
@@ -62,8 +63,11 @@ class ARROW_FLIGHT_EXPORT RecordBatchStream : public FlightDataStream {
  public:
   /// \param[in] reader produces a sequence of record batches
   /// \param[in,out] pool a MemoryPool to use for allocations
-  explicit RecordBatchStream(const std::shared_ptr<RecordBatchReader>& reader,
-                             MemoryPool* pool = default_memory_pool());
+  /// \param[in] options IPC options, e.g. to compress the record batch bodies
+  explicit RecordBatchStream(
+      const std::shared_ptr<RecordBatchReader>& reader,
+      MemoryPool* pool = default_memory_pool(),
+      const ipc::IpcOptions& options = ipc::IpcOptions::Defaults());
   ~RecordBatchStream() override;
 
   std::shared_ptr<Schema> schema() override;
@@ -83,6 +87,29 @@ class ARROW_FLIGHT_EXPORT FlightMessageReader : public MetadataRecordBatchReader
   virtual const FlightDescriptor& descriptor() const = 0;
 };
 
+/// \brief A writer for the IPC payloads sent back to a client during an
+/// exchange. Also allows sending application-defined metadata via the Flight
+/// protocol.
+class ARROW_FLIGHT_EXPORT FlightMessageWriter {
+ public:
+  virtual ~FlightMessageWriter();
+
+  /// \brief Start sending data with the given schema. Must be called once
+  /// before writing batches.
+  virtual Status Begin(const std::shared_ptr<Schema>& schema,
+                       const ipc::IpcOptions& options) = 0;
+  Status Begin(const std::shared_ptr<Schema>& schema) {
+    return Begin(schema, ipc::IpcOptions::Defaults());
+  }
+
+  /// \brief Send a record batch to the client.
+  virtual Status WriteRecordBatch(const RecordBatch& batch) = 0;
+
+  /// \brief Send a record batch to the client, with application metadata.
+  virtual Status WriteWithMetadata(const RecordBatch& batch,
+                                   std::shared_ptr<Buffer> app_metadata) = 0;
+};
+
 /// \brief A writer for application-specific metadata sent back to the
 /// client during an upload.
 class ARROW_FLIGHT_EXPORT FlightMetadataWriter {
@@ -107,6 +134,15 @@ class ARROW_FLIGHT_EXPORT FlightServerOptions {
   /// \brief The host & port (or domain socket path) to listen on.
   /// Use port 0 to bind to an available port.
   Location location;
+  /// \brief The largest message the server accepts, in bytes, or -1 for
+  /// no limit (the default).
+  int max_receive_message_size;
+  /// \brief If positive, the record batches of DoGet and DoExchange are
+  /// written with the gRPC buffer hint, so that up to this many bytes per
+  /// stream may be coalesced into fewer network writes. A batch may then be
+  /// delayed until the next ones are written, see
+  /// FlightClientOptions::write_buffer_size.
+  int write_buffer_size;
   /// \brief The authentication handler to use.
   std::unique_ptr<ServerAuthHandler> auth_handler;
   /// \brief A list of TLS certificate+key pairs to use.
@@ -213,6 +249,21 @@ class ARROW_FLIGHT_EXPORT FlightServerBase {
                        std::unique_ptr<FlightMessageReader> reader,
                        std::unique_ptr<FlightMetadataWriter> writer);
 
+  /// \brief Process a bidirectional stream of IPC payloads
+  ///
+  /// Batches can be written back to the client while the client's batches are
+  /// being read, e.g. to filter or transform them as they arrive. Writes
+  /// block when the client doesn't keep up.
+  ///
+  /// \param[in] context The call context.
+  /// \param[in] reader a sequence of record batches sent by the client, its
+  /// descriptor identifies the exchange
+  /// \param[in] writer send record batches and metadata back to the client
+  /// \return Status
+  virtual Status DoExchange(const ServerCallContext& context,
+                            std::unique_ptr<FlightMessageReader> reader,
+                            std::unique_ptr<FlightMessageWriter> writer);
+
   /// \brief Execute an action, return stream of zero or more results
   /// \param[in] context The call context.
   /// \param[in] action the action to execute, with type and body
@@ -99,7 +99,8 @@ void TestServer::Start() {
 
   try {
     server_process_ = std::make_shared<bp::child>(
-        bp::search_path(executable_name_, search_path), "-port", str_port);
+        bp::search_path(executable_name_, search_path), "-port", str_port,
+        bp::args(extra_args_));
   } catch (...) {
     std::stringstream ss;
     ss << "Failed to launch test server '" << executable_name_ << "', looked in ";
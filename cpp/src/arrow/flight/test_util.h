@@ -51,6 +51,12 @@ class ARROW_FLIGHT_EXPORT TestServer {
       : executable_name_(executable_name), port_(::arrow::GetListenPort()) {}
   explicit TestServer(const std::string& executable_name, int port)
       : executable_name_(executable_name), port_(port) {}
+  /// \brief Pass extra_args to the server executable after its -port flag
+  TestServer(const std::string& executable_name, int port,
+             std::vector<std::string> extra_args)
+      : executable_name_(executable_name),
+        port_(port),
+        extra_args_(std::move(extra_args)) {}
 
   void Start();
 
@@ -63,6 +69,7 @@ class ARROW_FLIGHT_EXPORT TestServer {
  private:
   std::string executable_name_;
   int port_;
+  std::vector<std::string> extra_args_;
   std::shared_ptr<::boost::process::child> server_process_;
 };
 
@@ -0,0 +1,172 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/caching.h"
+
+#include <algorithm>
+#include <future>
+#include <mutex>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace io {
+
+constexpr int64_t CacheOptions::kDefaultHoleSizeLimit;
+constexpr int64_t CacheOptions::kDefaultRangeSizeLimit;
+
+namespace internal {
+
+// Reads are latency-bound rather than CPU-bound, so use more threads than a
+// CPU pool would have on small machines
+static constexpr int kDefaultIOThreads = 8;
+
+::arrow::internal::ThreadPool* GetIOThreadPool() {
+  static std::shared_ptr<::arrow::internal::ThreadPool> pool = [] {
+    std::shared_ptr<::arrow::internal::ThreadPool> pool;
+    ARROW_CHECK_OK(::arrow::internal::ThreadPool::Make(kDefaultIOThreads, &pool));
+    return pool;
+  }();
+  return pool.get();
+}
+
+std::vector<ReadRange> CoalesceReadRanges(std::vector<ReadRange> ranges,
+                                          int64_t hole_size_limit,
+                                          int64_t range_size_limit) {
+  ranges.erase(std::remove_if(ranges.begin(), ranges.end(),
+                              [](const ReadRange& range) { return range.length <= 0; }),
+               ranges.end());
+  std::sort(ranges.begin(), ranges.end(), [](const ReadRange& a, const ReadRange& b) {
+    return a.offset < b.offset;
+  });
+
+  std::vector<ReadRange> coalesced;
+  for (const auto& range : ranges) {
+    if (!coalesced.empty()) {
+      ReadRange& last = coalesced.back();
+      const int64_t last_end = last.offset + last.length;
+      const int64_t end = std::max(last_end, range.offset + range.length);
+      if (range.offset - last_end <= hole_size_limit &&
+          end - last.offset <= range_size_limit) {
+        last.length = end - last.offset;
+        continue;
+      }
+    }
+    coalesced.push_back(range);
+  }
+  return coalesced;
+}
+
+namespace {
+
+struct ReadResult {
+  Status status;
+  std::shared_ptr<Buffer> buffer;
+};
+
+}  // namespace
+
+struct ReadRangeCache::Impl {
+  struct Entry {
+    ReadRange range;
+    std::shared_future<ReadResult> result;
+  };
+
+  std::shared_ptr<RandomAccessFile> file;
+  CacheOptions options;
+
+  std::mutex mutex;
+  // Cached ranges, sorted by offset
+  std::vector<Entry> entries;
+
+  // Find the cached range containing the given range, if any
+  bool Find(const ReadRange& range, Entry* out) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = std::upper_bound(
+        entries.begin(), entries.end(), range.offset,
+        [](int64_t offset, const Entry& entry) { return offset < entry.range.offset; });
+    if (it == entries.begin()) {
+      return false;
+    }
+    --it;
+    if (range.offset + range.length > it->range.offset + it->range.length) {
+      return false;
+    }
+    *out = *it;
+    return true;
+  }
+};
+
+ReadRangeCache::ReadRangeCache(std::shared_ptr<RandomAccessFile> file,
+                               CacheOptions options)
+    : impl_(new Impl()) {
+  impl_->file = std::move(file);
+  impl_->options = options;
+}
+
+// Pending reads hold their own reference to the file and can complete after
+// the cache is destroyed
+ReadRangeCache::~ReadRangeCache() = default;
+
+Status ReadRangeCache::Cache(std::vector<ReadRange> ranges) {
+  ranges = CoalesceReadRanges(std::move(ranges), impl_->options.hole_size_limit,
+                              impl_->options.range_size_limit);
+  auto pool = GetIOThreadPool();
+  std::vector<Impl::Entry> new_entries;
+  for (const auto& range : ranges) {
+    std::shared_ptr<RandomAccessFile> file = impl_->file;
+    auto result = pool->Submit([file, range]() {
+      ReadResult result;
+      result.status = file->ReadAt(range.offset, range.length, &result.buffer);
+      return result;
+    });
+    new_entries.push_back({range, result.share()});
+  }
+
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  impl_->entries.insert(impl_->entries.end(), new_entries.begin(), new_entries.end());
+  std::stable_sort(impl_->entries.begin(), impl_->entries.end(),
+                   [](const Impl::Entry& a, const Impl::Entry& b) {
+                     return a.range.offset < b.range.offset;
+                   });
+  return Status::OK();
+}
+
+Status ReadRangeCache::Read(ReadRange range, std::shared_ptr<Buffer>* out) {
+  Impl::Entry entry;
+  if (range.length <= 0 || !impl_->Find(range, &entry)) {
+    return impl_->file->ReadAt(range.offset, range.length, out);
+  }
+
+  const ReadResult& result = entry.result.get();
+  RETURN_NOT_OK(result.status);
+  // The cached read is short if the range extends past the end of the file
+  const int64_t position = range.offset - entry.range.offset;
+  const int64_t available = std::max<int64_t>(result.buffer->size() - position, 0);
+  *out = SliceBuffer(result.buffer, std::min(position, result.buffer->size()),
+                     std::min(range.length, available));
+  return Status::OK();
+}
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class Status;
+
+namespace internal {
+
+class ThreadPool;
+
+}  // namespace internal
+
+namespace io {
+
+class RandomAccessFile;
+
+/// \brief A byte range [offset, offset + length) of a file
+struct ARROW_EXPORT ReadRange {
+  int64_t offset;
+  int64_t length;
+
+  friend bool operator==(const ReadRange& left, const ReadRange& right) {
+    return left.offset == right.offset && left.length == right.length;
+  }
+};
+
+/// \brief Parameters controlling how ReadRangeCache combines small reads
+struct ARROW_EXPORT CacheOptions {
+  static constexpr int64_t kDefaultHoleSizeLimit = 8192;
+  static constexpr int64_t kDefaultRangeSizeLimit = 32 * 1024 * 1024;
+
+  /// Maximum distance in bytes between two consecutive ranges; beyond this
+  /// value, ranges are not combined
+  int64_t hole_size_limit = kDefaultHoleSizeLimit;
+  /// Maximum size in bytes of a combined range; if combining two consecutive
+  /// ranges would produce a range larger than this, they are not combined
+  int64_t range_size_limit = kDefaultRangeSizeLimit;
+
+  static CacheOptions Defaults() { return CacheOptions(); }
+};
+
+namespace internal {
+
+/// \brief Return a shared thread pool for blocking I/O calls
+ARROW_EXPORT ::arrow::internal::ThreadPool* GetIOThreadPool();
+
+/// \brief Sort ranges by offset and merge the ranges separated by at most
+/// hole_size_limit bytes, as long as the merged range does not exceed
+/// range_size_limit bytes. Empty ranges are dropped.
+ARROW_EXPORT
+std::vector<ReadRange> CoalesceReadRanges(std::vector<ReadRange> ranges,
+                                          int64_t hole_size_limit,
+                                          int64_t range_size_limit);
+
+/// \brief EXPERIMENTAL: A read cache for high-latency filesystems.
+///
+/// The ranges passed to Cache() are coalesced according to the CacheOptions
+/// and read concurrently in the background on the I/O thread pool. Read()
+/// then serves any range contained in a cached range from memory, waiting
+/// for the background read if it hasn't completed yet.
+///
+/// This class is thread-safe.
+class ARROW_EXPORT ReadRangeCache {
+ public:
+  ReadRangeCache(std::shared_ptr<RandomAccessFile> file, CacheOptions options);
+  ~ReadRangeCache();
+
+  /// \brief Start reading the given ranges in the background
+  Status Cache(std::vector<ReadRange> ranges);
+
+  /// \brief Read a range. Ranges which aren't contained in a cached range are
+  /// read from the file directly.
+  Status Read(ReadRange range, std::shared_ptr<Buffer>* out);
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
@@ -15,16 +15,19 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "arrow/buffer.h"
+#include "arrow/io/caching.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
 #include "arrow/io/slow.h"
@@ -349,5 +352,80 @@ TEST(TestSlowInputStream, Basics) { TestSlowInputStream<SlowInputStream>(); }
 
 TEST(TestSlowRandomAccessFile, Basics) { TestSlowInputStream<SlowRandomAccessFile>(); }
 
+TEST(CoalesceReadRanges, Basics) {
+  auto check = [](std::vector<ReadRange> ranges, std::vector<ReadRange> expected) {
+    ASSERT_EQ(internal::CoalesceReadRanges(std::move(ranges), /*hole_size_limit=*/10,
+                                           /*range_size_limit=*/100),
+              expected);
+  };
+
+  check({}, {});
+  // Zero-sized range is dropped
+  check({{110, 0}}, {});
+  check({{110, 10}}, {{110, 10}});
+  // Adjacent, overlapping and nearby ranges are merged, in any order
+  check({{120, 10}, {110, 10}}, {{110, 20}});
+  check({{110, 20}, {120, 5}}, {{110, 20}});
+  check({{100, 10}, {115, 10}}, {{100, 25}});
+  // Hole too large
+  check({{100, 10}, {121, 10}}, {{100, 10}, {121, 10}});
+  // Combined range too large
+  check({{100, 50}, {155, 50}}, {{100, 50}, {155, 50}});
+  check({{100, 200}, {305, 10}}, {{100, 200}, {305, 10}});
+  check({{100, 10}, {115, 10}, {130, 10}, {200, 10}}, {{100, 40}, {200, 10}});
+}
+
+class CountingBufferReader : public BufferReader {
+ public:
+  using BufferReader::BufferReader;
+
+  int read_count() const { return read_count_; }
+
+ protected:
+  Status DoReadAt(int64_t position, int64_t nbytes,
+                  std::shared_ptr<Buffer>* out) override {
+    ++read_count_;
+    return BufferReader::DoReadAt(position, nbytes, out);
+  }
+
+ private:
+  std::atomic<int> read_count_{0};
+};
+
+TEST(ReadRangeCache, Basics) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+  auto file = std::make_shared<CountingBufferReader>(Buffer::FromString(data));
+  CacheOptions options;
+  options.hole_size_limit = 3;
+  options.range_size_limit = 10;
+  internal::ReadRangeCache cache(file, options);
+
+  ASSERT_OK(cache.Cache({{1, 2}, {3, 2}, {8, 2}, {20, 2}, {25, 3}}));
+  // Coalesced into [1, 10) and [20, 28)
+  std::shared_ptr<Buffer> out;
+  ASSERT_OK(cache.Read({20, 2}, &out));
+  AssertBufferEqual(*out, "uv");
+  ASSERT_OK(cache.Read({1, 2}, &out));
+  AssertBufferEqual(*out, "bc");
+  ASSERT_OK(cache.Read({3, 2}, &out));
+  AssertBufferEqual(*out, "de");
+  ASSERT_OK(cache.Read({8, 2}, &out));
+  AssertBufferEqual(*out, "ij");
+  // Subranges of a cached range are served from memory too
+  ASSERT_OK(cache.Read({4, 5}, &out));
+  AssertBufferEqual(*out, "efghi");
+  // The last range extends past the end of the file
+  ASSERT_OK(cache.Read({25, 3}, &out));
+  AssertBufferEqual(*out, "z");
+  ASSERT_EQ(2, file->read_count());
+
+  // Uncached ranges are read from the file
+  ASSERT_OK(cache.Read({10, 3}, &out));
+  AssertBufferEqual(*out, "klm");
+  ASSERT_OK(cache.Read({19, 2}, &out));
+  AssertBufferEqual(*out, "tu");
+  ASSERT_EQ(4, file->read_count());
+}
+
 }  // namespace io
 }  // namespace arrow
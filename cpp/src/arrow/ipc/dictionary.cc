@@ -24,6 +24,7 @@
 #include <utility>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
@@ -134,6 +135,38 @@ Status DictionaryMemo::AddDictionary(int64_t id,
   return Status::OK();
 }
 
+Status DictionaryMemo::AddDictionaryDelta(int64_t id, const std::shared_ptr<Array>& delta,
+                                          MemoryPool* pool) {
+  auto it = id_to_dictionary_.find(id);
+  if (it == id_to_dictionary_.end()) {
+    return Status::KeyError("No dictionary with id ", id, " to append a delta to");
+  }
+  if (!it->second->type()->Equals(*delta->type())) {
+    return Status::TypeError("Dictionary delta with id ", id, " has type ",
+                             delta->type()->ToString(), " but dictionary has type ",
+                             it->second->type()->ToString());
+  }
+  if (delta->length() == 0) {
+    return Status::OK();
+  }
+  // Batches already read keep a reference to the previous dictionary, so it
+  // can't be appended to in place
+  std::shared_ptr<Array> combined;
+  RETURN_NOT_OK(Concatenate({it->second, delta}, pool, &combined));
+  it->second = std::move(combined);
+  return Status::OK();
+}
+
+Status DictionaryMemo::UpdateDictionary(int64_t id,
+                                        const std::shared_ptr<Array>& dictionary) {
+  auto it = id_to_dictionary_.find(id);
+  if (it == id_to_dictionary_.end()) {
+    return Status::KeyError("Dictionary with id ", id, " not found");
+  }
+  it->second = dictionary;
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // CollectDictionaries implementation
 
@@ -180,5 +213,74 @@ Status CollectDictionaries(const RecordBatch& batch, DictionaryMemo* memo) {
   return collector.Collect(batch);
 }
 
+// ----------------------------------------------------------------------
+// CollectDictionaryDeltas implementation
+
+struct DictionaryDeltaCollector {
+  DictionaryMemo* dictionary_memo_;
+  DictionaryVector* deltas_;
+
+  Status WalkChildren(const DataType& type, const Array& array) {
+    for (int i = 0; i < type.num_children(); ++i) {
+      auto boxed_child = MakeArray(array.data()->child_data[i]);
+      RETURN_NOT_OK(Visit(*type.child(i), *boxed_child));
+    }
+    return Status::OK();
+  }
+
+  Status VisitDictionary(const Field& field, const DictionaryArray& array) {
+    int64_t id = -1;
+    RETURN_NOT_OK(dictionary_memo_->GetId(field, &id));
+    std::shared_ptr<Array> previous;
+    RETURN_NOT_OK(dictionary_memo_->GetDictionary(id, &previous));
+
+    const auto& dictionary = array.dictionary();
+    if (dictionary.get() == previous.get()) {
+      // Fast path: batches built with the same dictionary
+      return Status::OK();
+    }
+    const int64_t previous_length = previous->length();
+    if (dictionary->length() < previous_length ||
+        !dictionary->RangeEquals(0, previous_length, 0, previous)) {
+      // Dictionaries nested in the values are compared here as well, so they
+      // can't change either
+      return Status::Invalid("Dictionary with id ", id,
+                             " was changed and not only appended to, dictionary "
+                             "replacement is not supported in IPC");
+    }
+    if (dictionary->length() > previous_length) {
+      deltas_->emplace_back(id, dictionary->Slice(previous_length));
+    }
+    // Remember the new dictionary so that the next batches sharing it take the
+    // fast path
+    return dictionary_memo_->UpdateDictionary(id, dictionary);
+  }
+
+  Status Visit(const Field& field, const Array& array) {
+    if (field.type()->id() == Type::DICTIONARY) {
+      return VisitDictionary(field, static_cast<const DictionaryArray&>(array));
+    }
+    return WalkChildren(*field.type(), array);
+  }
+
+  Status Collect(const Schema& schema, const RecordBatch& batch) {
+    for (int i = 0; i < schema.num_fields(); ++i) {
+      RETURN_NOT_OK(Visit(*schema.field(i), *batch.column(i)));
+    }
+    return Status::OK();
+  }
+};
+
+Status CollectDictionaryDeltas(const Schema& schema, const RecordBatch& batch,
+                               DictionaryMemo* memo, DictionaryVector* deltas) {
+  if (schema.num_fields() != batch.num_columns()) {
+    return Status::Invalid("Schema has ", schema.num_fields(), " fields but batch has ",
+                           batch.num_columns(), " columns");
+  }
+  deltas->clear();
+  DictionaryDeltaCollector collector{memo, deltas};
+  return collector.Collect(schema, batch);
+}
+
 }  // namespace ipc
 }  // namespace arrow
@@ -23,6 +23,8 @@
 #include <cstdint>
 #include <memory>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "arrow/status.h"
 #include "arrow/util/macros.h"
@@ -33,11 +35,14 @@ namespace arrow {
 class Array;
 class DataType;
 class Field;
+class MemoryPool;
 class RecordBatch;
+class Schema;
 
 namespace ipc {
 
 using DictionaryMap = std::unordered_map<int64_t, std::shared_ptr<Array>>;
+using DictionaryVector = std::vector<std::pair<int64_t, std::shared_ptr<Array>>>;
 
 /// \brief Memoization data structure for assigning id numbers to
 /// dictionaries and tracking their current state through possible
@@ -77,6 +82,15 @@ class ARROW_EXPORT DictionaryMemo {
   /// KeyError if that dictionary already exists
   Status AddDictionary(int64_t id, const std::shared_ptr<Array>& dictionary);
 
+  /// \brief Append the values of a delta to the dictionary with a particular
+  /// id. Returns KeyError if there is no such dictionary
+  Status AddDictionaryDelta(int64_t id, const std::shared_ptr<Array>& delta,
+                            MemoryPool* pool);
+
+  /// \brief Replace the dictionary with a particular id. Returns KeyError if
+  /// there is no such dictionary
+  Status UpdateDictionary(int64_t id, const std::shared_ptr<Array>& dictionary);
+
   const DictionaryMap& id_to_dictionary() const { return id_to_dictionary_; }
 
   /// \brief The number of fields tracked in the memo
@@ -100,6 +114,22 @@ class ARROW_EXPORT DictionaryMemo {
 ARROW_EXPORT
 Status CollectDictionaries(const RecordBatch& batch, DictionaryMemo* memo);
 
+/// \brief Find the dictionaries of a batch which grew since they were added
+/// to the memo
+///
+/// A dictionary which starts with the values of the memo's dictionary replaces
+/// it in the memo, and its new values are returned as a delta. Any other
+/// change to a dictionary is an error, since IPC readers can only append to
+/// their dictionaries.
+///
+/// \param[in] schema the schema with which the dictionary ids were assigned
+/// \param[in] batch a batch with the same schema
+/// \param[in,out] memo the dictionaries previously written
+/// \param[out] deltas the ids and values of the deltas to write
+ARROW_EXPORT
+Status CollectDictionaryDeltas(const Schema& schema, const RecordBatch& batch,
+                               DictionaryMemo* memo, DictionaryVector* deltas);
+
 }  // namespace ipc
 }  // namespace arrow
 
@@ -240,8 +240,8 @@ std::string FormatMessageType(Message::Type type) {
   return "unknown";
 }
 
-Status ReadMessage(int64_t offset, int32_t metadata_length, io::RandomAccessFile* file,
-                   std::unique_ptr<Message>* message) {
+Status ReadMessageMetadata(int64_t offset, int32_t metadata_length,
+                           io::RandomAccessFile* file, std::shared_ptr<Buffer>* metadata) {
   ARROW_CHECK_GT(static_cast<size_t>(metadata_length), sizeof(int32_t))
       << "metadata_length should be at least 4";
 
@@ -278,7 +278,7 @@ Status ReadMessage(int64_t offset, int32_t metadata_length, io::RandomAccessFile
 
   if (flatbuffer_length == 0) {
     // EOS
-    *message = nullptr;
+    *metadata = nullptr;
     return Status::OK();
   }
 
@@ -288,8 +288,18 @@ Status ReadMessage(int64_t offset, int32_t metadata_length, io::RandomAccessFile
                            ", metadata length: ", metadata_length);
   }
 
-  std::shared_ptr<Buffer> metadata =
-      SliceBuffer(buffer, prefix_size, buffer->size() - prefix_size);
+  *metadata = SliceBuffer(buffer, prefix_size, buffer->size() - prefix_size);
+  return MaybeAlignMetadata(metadata);
+}
+
+Status ReadMessage(int64_t offset, int32_t metadata_length, io::RandomAccessFile* file,
+                   std::unique_ptr<Message>* message) {
+  std::shared_ptr<Buffer> metadata;
+  RETURN_NOT_OK(ReadMessageMetadata(offset, metadata_length, file, &metadata));
+  if (metadata == nullptr) {
+    *message = nullptr;
+    return Status::OK();
+  }
   return Message::ReadFrom(offset + metadata_length, metadata, file, message);
 }
 
@@ -197,6 +197,20 @@ ARROW_EXPORT
 Status ReadMessage(const int64_t offset, const int32_t metadata_length,
                    io::RandomAccessFile* file, std::unique_ptr<Message>* message);
 
+/// \brief Read only the metadata of an encapsulated Message, see ReadMessage.
+/// The body follows the metadata_length bytes, and can be read afterwards with
+/// Message::ReadFrom
+///
+/// \param[in] offset the position in the file where the message starts
+/// \param[in] metadata_length the total number of bytes to read from file
+/// \param[in] file the seekable file interface to read from
+/// \param[out] metadata the Flatbuffer metadata, without the length prefix and
+/// aligned to 8 bytes. Null for the end-of-stream marker
+/// \return Status success or failure
+ARROW_EXPORT
+Status ReadMessageMetadata(const int64_t offset, const int32_t metadata_length,
+                           io::RandomAccessFile* file, std::shared_ptr<Buffer>* metadata);
+
 /// \brief Advance stream to an 8-byte offset if its position is not a multiple
 /// of 8 already
 /// \param[in] stream an input stream
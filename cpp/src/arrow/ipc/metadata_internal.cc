@@ -845,11 +845,22 @@ Status SchemaToFlatbuffer(FBB& fbb, const Schema& schema, DictionaryMemo* dictio
   return Status::OK();
 }
 
+// Until the format has a field for it, body compression is signalled in the
+// custom metadata of the message
+constexpr const char* kCompressionKey = "ARROW:experimental_compression";
+
 Status WriteFBMessage(FBB& fbb, flatbuf::MessageHeader header_type,
                       flatbuffers::Offset<void> header, int64_t body_length,
-                      std::shared_ptr<Buffer>* out) {
+                      std::shared_ptr<Buffer>* out,
+                      Compression::type compression = Compression::UNCOMPRESSED) {
+  flatbuffers::Offset<KVVector> fb_custom_metadata;
+  if (compression != Compression::UNCOMPRESSED) {
+    std::vector<KeyValueOffset> key_values = {AppendKeyValue(
+        fbb, kCompressionKey, util::Codec::GetCodecAsString(compression))};
+    fb_custom_metadata = fbb.CreateVector(key_values);
+  }
   auto message = flatbuf::CreateMessage(fbb, kCurrentMetadataVersion, header_type, header,
-                                        body_length);
+                                        body_length, fb_custom_metadata);
   fbb.Finish(message);
   return WriteFlatbufferBuilder(fbb, out);
 }
@@ -906,22 +917,24 @@ static Status MakeRecordBatch(FBB& fbb, int64_t length, int64_t body_length,
 }  // namespace
 
 Status WriteSchemaMessage(const Schema& schema, DictionaryMemo* dictionary_memo,
-                          std::shared_ptr<Buffer>* out) {
+                          Compression::type compression, std::shared_ptr<Buffer>* out) {
   FBB fbb;
   flatbuffers::Offset<flatbuf::Schema> fb_schema;
   RETURN_NOT_OK(SchemaToFlatbuffer(fbb, schema, dictionary_memo, &fb_schema));
-  return WriteFBMessage(fbb, flatbuf::MessageHeader_Schema, fb_schema.Union(), 0, out);
+  return WriteFBMessage(fbb, flatbuf::MessageHeader_Schema, fb_schema.Union(), 0, out,
+                        compression);
 }
 
 Status WriteRecordBatchMessage(int64_t length, int64_t body_length,
                                const std::vector<FieldMetadata>& nodes,
                                const std::vector<BufferMetadata>& buffers,
+                               Compression::type compression,
                                std::shared_ptr<Buffer>* out) {
   FBB fbb;
   RecordBatchOffset record_batch;
   RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
   return WriteFBMessage(fbb, flatbuf::MessageHeader_RecordBatch, record_batch.Union(),
-                        body_length, out);
+                        body_length, out, compression);
 }
 
 Status WriteTensorMessage(const Tensor& tensor, int64_t buffer_start_offset,
@@ -1090,16 +1103,41 @@ Status WriteSparseTensorMessage(const SparseTensor& sparse_tensor, int64_t body_
                         fb_sparse_tensor.Union(), body_length, out);
 }
 
-Status WriteDictionaryMessage(int64_t id, int64_t length, int64_t body_length,
+Status WriteDictionaryMessage(int64_t id, bool is_delta, int64_t length,
+                              int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
+                              Compression::type compression,
                               std::shared_ptr<Buffer>* out) {
   FBB fbb;
   RecordBatchOffset record_batch;
   RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
-  auto dictionary_batch = flatbuf::CreateDictionaryBatch(fbb, id, record_batch).Union();
+  auto dictionary_batch =
+      flatbuf::CreateDictionaryBatch(fbb, id, record_batch, is_delta).Union();
   return WriteFBMessage(fbb, flatbuf::MessageHeader_DictionaryBatch, dictionary_batch,
-                        body_length, out);
+                        body_length, out, compression);
+}
+
+Status GetCompression(const flatbuf::Message* message, Compression::type* out) {
+  *out = Compression::UNCOMPRESSED;
+  auto fb_metadata = message->custom_metadata();
+  if (fb_metadata == nullptr) {
+    return Status::OK();
+  }
+  std::shared_ptr<KeyValueMetadata> metadata;
+  RETURN_NOT_OK(KeyValueMetadataFromFlatbuffer(fb_metadata, &metadata));
+  const int index = metadata->FindKey(kCompressionKey);
+  if (index == -1) {
+    return Status::OK();
+  }
+  const std::string& name = metadata->value(index);
+  for (auto compression : {Compression::LZ4, Compression::ZSTD}) {
+    if (name == util::Codec::GetCodecAsString(compression)) {
+      *out = compression;
+      return Status::OK();
+    }
+  }
+  return Status::Invalid("Unsupported IPC body compression: ", name);
 }
 
 static flatbuffers::Offset<flatbuffers::Vector<const flatbuf::Block*>>
@@ -36,6 +36,7 @@
 #include "arrow/memory_pool.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
+#include "arrow/util/compression.h"
 
 namespace arrow {
 
@@ -121,6 +122,10 @@ Status GetSparseTensorMetadata(const Buffer& metadata, std::shared_ptr<DataType>
                                std::vector<std::string>* dim_names, int64_t* length,
                                SparseTensorFormat::type* sparse_tensor_format_id);
 
+// EXPERIMENTAL: Get the codec which compressed the body buffers of a record
+// batch or dictionary message, UNCOMPRESSED if they aren't compressed
+Status GetCompression(const flatbuf::Message* message, Compression::type* out);
+
 static inline Status VerifyMessage(const uint8_t* data, int64_t size,
                                    const flatbuf::Message** out) {
   flatbuffers::Verifier verifier(data, size, /*max_depth=*/128);
@@ -136,14 +141,17 @@ static inline Status VerifyMessage(const uint8_t* data, int64_t size,
 // \param[in] schema a Schema instance
 // \param[in,out] dictionary_memo class for tracking dictionaries and assigning
 // dictionary ids
+// \param[in] compression the codec of the batches which follow, announced in
+// the custom metadata of the message
 // \param[out] out the serialized arrow::Buffer
 // \return Status outcome
 Status WriteSchemaMessage(const Schema& schema, DictionaryMemo* dictionary_memo,
-                          std::shared_ptr<Buffer>* out);
+                          Compression::type compression, std::shared_ptr<Buffer>* out);
 
 Status WriteRecordBatchMessage(const int64_t length, const int64_t body_length,
                                const std::vector<FieldMetadata>& nodes,
                                const std::vector<BufferMetadata>& buffers,
+                               Compression::type compression,
                                std::shared_ptr<Buffer>* out);
 
 Status WriteTensorMessage(const Tensor& tensor, const int64_t buffer_start_offset,
@@ -157,10 +165,11 @@ Status WriteFileFooter(const Schema& schema, const std::vector<FileBlock>& dicti
                        const std::vector<FileBlock>& record_batches,
                        io::OutputStream* out);
 
-Status WriteDictionaryMessage(const int64_t id, const int64_t length,
-                              const int64_t body_length,
+Status WriteDictionaryMessage(const int64_t id, const bool is_delta,
+                              const int64_t length, const int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
+                              Compression::type compression,
                               std::shared_ptr<Buffer>* out);
 
 static inline Status WriteFlatbufferBuilder(flatbuffers::FlatBufferBuilder& fbb,
@@ -18,7 +18,9 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -44,6 +46,32 @@ struct ARROW_EXPORT IpcOptions {
   /// consisting of a 4-byte prefix instead of 8 byte
   bool write_legacy_ipc_format = false;
 
+  /// \brief EXPERIMENTAL: Codec for the body buffers of record batches and
+  /// dictionaries, either LZ4 or ZSTD
+  ///
+  /// Each buffer is prefixed with its uncompressed length as an int64, or with
+  /// -1 when it is stored uncompressed because compression didn't shrink it.
+  /// The codec is written in the custom metadata of the schema message and of
+  /// each compressed message. Stream readers fail when opening the stream if
+  /// they lack the codec.
+  ///
+  /// WARNING: readers which predate this option, including other Arrow
+  /// implementations and older Flight peers, ignore that metadata. They read
+  /// the compressed bytes as plain buffers, which yields wrong data or reads
+  /// out of bounds instead of an error. Only enable compression when every
+  /// reader of the data is known to support it.
+  Compression::type compression = Compression::UNCOMPRESSED;
+
+  /// \brief Compress the body buffers of a message in parallel, on the CPU
+  /// thread pool. Ignored when writing from a thread of that pool.
+  bool use_threads = true;
+
+  /// \brief Indices of the top-level fields to read, all fields if empty
+  ///
+  /// The batches read only have the included fields, in schema order. The
+  /// buffers of the other fields are neither read nor decompressed.
+  std::vector<int> included_fields;
+
   static IpcOptions Defaults();
 };
 
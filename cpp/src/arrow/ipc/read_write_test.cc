@@ -21,6 +21,8 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <flatbuffers/flatbuffers.h>
 #include <gtest/gtest.h>
@@ -49,6 +51,7 @@
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/key_value_metadata.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -712,10 +715,12 @@ struct FileWriterHelper {
     return sink_->Tell(&footer_offset_);
   }
 
-  Status ReadBatches(BatchVector* out_batches) {
+  Status ReadBatches(BatchVector* out_batches,
+                     const IpcOptions& options = IpcOptions::Defaults()) {
     auto buf_reader = std::make_shared<io::BufferReader>(buffer_);
     std::shared_ptr<RecordBatchFileReader> reader;
-    RETURN_NOT_OK(RecordBatchFileReader::Open(buf_reader.get(), footer_offset_, &reader));
+    RETURN_NOT_OK(
+        RecordBatchFileReader::Open(buf_reader.get(), footer_offset_, options, &reader));
 
     EXPECT_EQ(num_batches_written_, reader->num_record_batches());
     for (int i = 0; i < num_batches_written_; ++i) {
@@ -792,13 +797,14 @@ class ReaderWriterMixin {
     }
   }
 
-  void TestDictionaryRoundtrip() {
+  void TestDictionaryRoundtrip(const IpcOptions& options = IpcOptions::Defaults()) {
     std::shared_ptr<RecordBatch> batch;
     ASSERT_OK(MakeDictionary(&batch));
 
     BatchVector out_batches;
-    ASSERT_OK(RoundTripHelper({batch}, IpcOptions::Defaults(), &out_batches));
+    ASSERT_OK(RoundTripHelper({batch}, options, &out_batches));
     ASSERT_EQ(out_batches.size(), 1);
+    CompareBatch(*batch, *out_batches[0]);
 
     // TODO(wesm): This was broken in ARROW-3144. I'm not sure how to
     // restore the deduplication logic yet because dictionaries are
@@ -836,7 +842,68 @@ class ReaderWriterMixin {
     ASSERT_TRUE(out_batches[0]->schema()->Equals(*schema));
   }
 
+  void TestDictionaryDeltas() {
+    auto schema = ::arrow::schema({field("f0", dictionary(int8(), utf8()))});
+    auto dict1 = ArrayFromJSON(utf8(), R"(["a", "b"])");
+    auto dict2 = ArrayFromJSON(utf8(), R"(["a", "b", "c", "d"])");
+    std::shared_ptr<RecordBatch> batch1, batch2, batch3;
+    ASSERT_OK(MakeDictionaryBatch(schema, dict1, "[0, 1, null, 0]", &batch1));
+    ASSERT_OK(MakeDictionaryBatch(schema, dict2, "[3, 2, 1]", &batch2));
+    ASSERT_OK(MakeDictionaryBatch(schema, dict2, "[2]", &batch3));
+
+    BatchVector in_batches = {batch1, batch2, batch3};
+    BatchVector out_batches;
+    ASSERT_OK(RoundTripHelper(in_batches, IpcOptions::Defaults(), &out_batches));
+    ASSERT_EQ(out_batches.size(), in_batches.size());
+
+    for (size_t i = 0; i < in_batches.size(); ++i) {
+      const auto& in = checked_cast<const DictionaryArray&>(*in_batches[i]->column(0));
+      const auto& out = checked_cast<const DictionaryArray&>(*out_batches[i]->column(0));
+      AssertArraysEqual(*in.indices(), *out.indices());
+      // The file reader applies all the deltas before reading any batch
+      const int64_t length = in.dictionary()->length();
+      ASSERT_GE(out.dictionary()->length(), length);
+      ASSERT_TRUE(out.dictionary()->RangeEquals(0, length, 0, in.dictionary()));
+    }
+  }
+
+  void TestDictionaryReplacement() {
+    auto schema = ::arrow::schema({field("f0", dictionary(int8(), utf8()))});
+    std::shared_ptr<RecordBatch> batch1, batch2;
+    ASSERT_OK(MakeDictionaryBatch(schema, ArrayFromJSON(utf8(), R"(["a", "b"])"), "[0]",
+                                  &batch1));
+    ASSERT_OK(MakeDictionaryBatch(schema, ArrayFromJSON(utf8(), R"(["b", "a", "c"])"),
+                                  "[0]", &batch2));
+
+    WriterHelper writer_helper;
+    ASSERT_OK(writer_helper.Init(schema, IpcOptions::Defaults()));
+    ASSERT_OK(writer_helper.WriteBatch(batch1));
+    ASSERT_RAISES(Invalid, writer_helper.WriteBatch(batch2));
+  }
+
+  void TestUnsupportedCompression() {
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(MakeIntRecordBatch(&batch));
+
+    IpcOptions options;
+    options.compression = Compression::GZIP;
+    BatchVector out_batches;
+    ASSERT_RAISES(Invalid, RoundTripHelper({batch}, options, &out_batches));
+  }
+
  private:
+  static Status MakeDictionaryBatch(const std::shared_ptr<Schema>& schema,
+                                    const std::shared_ptr<Array>& dictionary,
+                                    const std::string& indices,
+                                    std::shared_ptr<RecordBatch>* out) {
+    std::shared_ptr<Array> array;
+    RETURN_NOT_OK(DictionaryArray::FromArrays(schema->field(0)->type(),
+                                              ArrayFromJSON(int8(), indices), dictionary,
+                                              &array));
+    *out = RecordBatch::Make(schema, array->length(), {array});
+    return Status::OK();
+  }
+
   Status RoundTripHelper(const BatchVector& in_batches, const IpcOptions& options,
                          BatchVector* out_batches) {
     WriterHelper writer_helper;
@@ -886,6 +953,189 @@ TEST_P(TestStreamFormat, RoundTrip) {
   TestRoundTrip(*GetParam(), options);
 }
 
+#ifdef ARROW_WITH_LZ4
+TEST_P(TestFileFormat, RoundTripLz4) {
+  IpcOptions options;
+  options.compression = Compression::LZ4;
+  TestRoundTrip(*GetParam(), options);
+}
+
+TEST_P(TestStreamFormat, RoundTripLz4) {
+  IpcOptions options;
+  options.compression = Compression::LZ4;
+  TestRoundTrip(*GetParam(), options);
+}
+#endif
+
+#ifdef ARROW_WITH_ZSTD
+TEST_P(TestFileFormat, RoundTripZstd) {
+  IpcOptions options;
+  options.compression = Compression::ZSTD;
+  TestRoundTrip(*GetParam(), options);
+
+  options.use_threads = false;
+  TestRoundTrip(*GetParam(), options);
+}
+
+TEST_P(TestStreamFormat, RoundTripZstd) {
+  IpcOptions options;
+  options.compression = Compression::ZSTD;
+  TestRoundTrip(*GetParam(), options);
+
+  options.use_threads = false;
+  TestRoundTrip(*GetParam(), options);
+}
+
+TEST_P(TestStreamFormat, RoundTripZstdOnPoolThread) {
+  // Waiting on compression tasks from the only worker of the pool would
+  // deadlock, the buffers must be compressed on the calling thread
+  auto pool = ::arrow::internal::GetCpuThreadPool();
+  const int capacity = pool->GetCapacity();
+  ASSERT_OK(pool->SetCapacity(1));
+  IpcOptions options;
+  options.compression = Compression::ZSTD;
+  pool->Submit([&] { TestRoundTrip(*GetParam(), options); }).get();
+  ASSERT_OK(pool->SetCapacity(capacity));
+}
+#endif
+
+TEST_P(TestFileFormat, IncludedFields) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK((*GetParam())(&batch));  // NOLINT clang-tidy gtest issue
+
+  FileWriterHelper writer_helper;
+  ASSERT_OK(writer_helper.Init(batch->schema(), IpcOptions::Defaults()));
+  ASSERT_OK(writer_helper.WriteBatch(batch));
+  ASSERT_OK(writer_helper.Finish());
+
+  // Every other field, starting with the last one so that skipped fields
+  // precede the included ones
+  IpcOptions options;
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Array>> columns;
+  for (int i = batch->num_columns() - 1; i >= 0; i -= 2) {
+    options.included_fields.push_back(i);
+    fields.insert(fields.begin(), batch->schema()->field(i));
+    columns.insert(columns.begin(), batch->column(i));
+  }
+  auto expected =
+      RecordBatch::Make(::arrow::schema(fields, batch->schema()->metadata()),
+                        batch->num_rows(), columns);
+
+  BatchVector out_batches;
+  ASSERT_OK(writer_helper.ReadBatches(&out_batches, options));
+  ASSERT_EQ(out_batches.size(), 1);
+  CompareBatch(*expected, *out_batches[0]);
+
+  options.included_fields = {batch->num_columns()};
+  out_batches.clear();
+  ASSERT_RAISES(Invalid, writer_helper.ReadBatches(&out_batches, options));
+}
+
+TEST_F(TestFileFormat, IncludedFieldsZeroCopy) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+  FileWriterHelper writer_helper;
+  ASSERT_OK(writer_helper.Init(batch->schema(), IpcOptions::Defaults()));
+  ASSERT_OK(writer_helper.WriteBatch(batch));
+  ASSERT_OK(writer_helper.WriteBatch(batch));
+  ASSERT_OK(writer_helper.Finish());
+
+  io::BufferReader buffer_reader(writer_helper.buffer_);
+  IpcOptions options;
+  options.included_fields = {1};
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(RecordBatchFileReader::Open(&buffer_reader, writer_helper.footer_offset_,
+                                        options, &reader));
+  ASSERT_EQ(reader->schema()->num_fields(), 1);
+  ASSERT_TRUE(reader->schema()->field(0)->Equals(batch->schema()->field(1)));
+
+  const uint8_t* file_start = writer_helper.buffer_->data();
+  const uint8_t* file_end = file_start + writer_helper.buffer_->size();
+  // Batch 0 is read again with the metadata cached by the reader
+  for (int i : {0, 1, 0}) {
+    std::shared_ptr<RecordBatch> out;
+    ASSERT_OK(reader->ReadRecordBatch(i, &out));
+    ASSERT_TRUE(out->schema()->Equals(*reader->schema()));
+    AssertArraysEqual(*batch->column(1), *out->column(0));
+    for (const auto& buffer : out->column(0)->data()->buffers) {
+      if (buffer != nullptr && buffer->size() > 0) {
+        ASSERT_GE(buffer->data(), file_start);
+        ASSERT_LE(buffer->data() + buffer->size(), file_end);
+      }
+    }
+  }
+}
+
+// A BufferReader recording the ranges of bytes read from it
+class TrackedBufferReader : public io::BufferReader {
+ public:
+  explicit TrackedBufferReader(const std::shared_ptr<Buffer>& buffer)
+      : io::BufferReader(buffer) {}
+
+  // Whether the first occurrence of value in the buffer was read
+  bool WasRead(const std::string& value) const {
+    const uint8_t* begin = data_;
+    const uint8_t* end = data_ + size_;
+    const uint8_t* found = std::search(begin, end, value.begin(), value.end());
+    EXPECT_NE(found, end) << value;
+    const int64_t position = found - begin;
+    for (const auto& read : reads_) {
+      if (read.first < position + static_cast<int64_t>(value.size()) &&
+          position < read.first + read.second) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+ protected:
+  Status DoReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                  void* out) override {
+    reads_.emplace_back(position, nbytes);
+    return io::BufferReader::DoReadAt(position, nbytes, bytes_read, out);
+  }
+
+  Status DoReadAt(int64_t position, int64_t nbytes,
+                  std::shared_ptr<Buffer>* out) override {
+    reads_.emplace_back(position, nbytes);
+    return io::BufferReader::DoReadAt(position, nbytes, out);
+  }
+
+  std::vector<std::pair<int64_t, int64_t>> reads_;
+};
+
+TEST_F(TestFileFormat, IncludedFieldsSkipDictionaries) {
+  auto type = dictionary(int8(), utf8());
+  auto schema = ::arrow::schema({field("kept", type), field("skipped", type)});
+  std::shared_ptr<Array> kept, skipped;
+  ASSERT_OK(DictionaryArray::FromArrays(type, ArrayFromJSON(int8(), "[0, 1, 0]"),
+                                        ArrayFromJSON(utf8(), R"(["kept-a", "kept-b"])"),
+                                        &kept));
+  ASSERT_OK(DictionaryArray::FromArrays(
+      type, ArrayFromJSON(int8(), "[1, 0, 1]"),
+      ArrayFromJSON(utf8(), R"(["skipped-a", "skipped-b"])"), &skipped));
+  FileWriterHelper writer_helper;
+  ASSERT_OK(writer_helper.Init(schema, IpcOptions::Defaults()));
+  ASSERT_OK(writer_helper.WriteBatch(RecordBatch::Make(schema, 3, {kept, skipped})));
+  ASSERT_OK(writer_helper.Finish());
+
+  TrackedBufferReader buffer_reader(writer_helper.buffer_);
+  IpcOptions options;
+  options.included_fields = {0};
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(RecordBatchFileReader::Open(&buffer_reader, writer_helper.footer_offset_,
+                                        options, &reader));
+  std::shared_ptr<RecordBatch> out;
+  ASSERT_OK(reader->ReadRecordBatch(0, &out));
+  ASSERT_EQ(out->num_columns(), 1);
+  AssertArraysEqual(*kept, *out->column(0));
+
+  // The dictionary of the skipped field is never read
+  ASSERT_TRUE(buffer_reader.WasRead("kept-a"));
+  ASSERT_FALSE(buffer_reader.WasRead("skipped-a"));
+}
+
 INSTANTIATE_TEST_CASE_P(GenericIpcRoundTripTests, TestIpcRoundTrip, BATCH_CASES());
 INSTANTIATE_TEST_CASE_P(FileRoundTripTests, TestFileFormat, BATCH_CASES());
 INSTANTIATE_TEST_CASE_P(StreamRoundTripTests, TestStreamFormat, BATCH_CASES());
@@ -927,6 +1177,26 @@ TEST_F(TestStreamFormat, DictionaryRoundTrip) { TestDictionaryRoundtrip(); }
 
 TEST_F(TestFileFormat, DictionaryRoundTrip) { TestDictionaryRoundtrip(); }
 
+#ifdef ARROW_WITH_ZSTD
+TEST_F(TestStreamFormat, CompressedDictionaryRoundTrip) {
+  IpcOptions options;
+  options.compression = Compression::ZSTD;
+  TestDictionaryRoundtrip(options);
+}
+#endif
+
+TEST_F(TestStreamFormat, DictionaryDeltas) { TestDictionaryDeltas(); }
+
+TEST_F(TestFileFormat, DictionaryDeltas) { TestDictionaryDeltas(); }
+
+TEST_F(TestStreamFormat, DictionaryReplacement) { TestDictionaryReplacement(); }
+
+TEST_F(TestFileFormat, DictionaryReplacement) { TestDictionaryReplacement(); }
+
+TEST_F(TestStreamFormat, UnsupportedCompression) { TestUnsupportedCompression(); }
+
+TEST_F(TestFileFormat, UnsupportedCompression) { TestUnsupportedCompression(); }
+
 TEST_F(TestStreamFormat, DifferentSchema) { TestWriteDifferentSchema(); }
 
 TEST_F(TestFileFormat, DifferentSchema) { TestWriteDifferentSchema(); }
@@ -954,6 +1224,60 @@ TEST(TestRecordBatchStreamReader, EmptyStreamWithDictionaries) {
   ASSERT_EQ(nullptr, batch);
 }
 
+TEST(TestRecordBatchStreamWriter, DictionaryDeltaMessages) {
+  auto type = arrow::dictionary(arrow::int8(), arrow::utf8());
+  auto schema = arrow::schema({arrow::field("f0", type)});
+  auto indices = ArrayFromJSON(int8(), "[0, 1]");
+  auto dict1 = ArrayFromJSON(utf8(), R"(["a", "b"])");
+  auto dict2 = ArrayFromJSON(utf8(), R"(["a", "b", "c"])");
+
+  std::shared_ptr<io::BufferOutputStream> out;
+  ASSERT_OK(io::BufferOutputStream::Create(0, default_memory_pool(), &out));
+  std::shared_ptr<RecordBatchWriter> writer;
+  ASSERT_OK(RecordBatchStreamWriter::Open(out.get(), schema, &writer));
+  for (const auto& dictionary : {dict1, dict1, dict2, dict2->Slice(0)}) {
+    std::shared_ptr<Array> array;
+    ASSERT_OK(DictionaryArray::FromArrays(type, indices, dictionary, &array));
+    ASSERT_OK(writer->WriteRecordBatch(*RecordBatch::Make(schema, 2, {array})));
+  }
+  ASSERT_OK(writer->Close());
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(out->Finish(&buffer));
+
+  // The initial dictionary, then a single delta with the new value
+  io::BufferReader buffer_reader(buffer);
+  std::unique_ptr<MessageReader> message_reader = MessageReader::Open(&buffer_reader);
+  std::vector<Message::Type> types;
+  std::unique_ptr<Message> message;
+  while (true) {
+    ASSERT_OK(message_reader->ReadNextMessage(&message));
+    if (!message) {
+      break;
+    }
+    types.push_back(message->type());
+  }
+  std::vector<Message::Type> expected_types = {
+      Message::SCHEMA,       Message::DICTIONARY_BATCH, Message::RECORD_BATCH,
+      Message::RECORD_BATCH, Message::DICTIONARY_BATCH, Message::RECORD_BATCH,
+      Message::RECORD_BATCH};
+  ASSERT_EQ(expected_types, types);
+
+  // Each batch is read with the dictionary it was written with
+  io::BufferReader batch_reader(buffer);
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(RecordBatchStreamReader::Open(&batch_reader, &reader));
+  BatchVector batches;
+  ASSERT_OK(reader->ReadAll(&batches));
+  ASSERT_EQ(batches.size(), 4);
+  std::vector<std::shared_ptr<Array>> expected_dictionaries = {dict1, dict1, dict2,
+                                                                dict2};
+  for (size_t i = 0; i < batches.size(); ++i) {
+    const auto& array = checked_cast<const DictionaryArray&>(*batches[i]->column(0));
+    AssertArraysEqual(*indices, *array.indices());
+    AssertArraysEqual(*expected_dictionaries[i], *array.dictionary());
+  }
+}
+
 // Delimit IPC stream messages and reassemble with the indicated messages
 // included. This way we can remove messages from an IPC stream to test
 // different failure modes or other difficult-to-test behaviors
@@ -994,6 +1318,29 @@ void SpliceMessages(std::shared_ptr<Buffer> stream,
   ASSERT_OK(out->Finish(spliced_stream));
 }
 
+TEST(TestRecordBatchStreamReader, UnsupportedCompressionInSchema) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+
+  // Only the schema message, the reader must reject the stream before any batch
+  IpcOptions options;
+  options.compression = Compression::GZIP;
+  DictionaryMemo memo;
+  internal::IpcPayload payload;
+  ASSERT_OK(internal::GetSchemaPayload(*batch->schema(), options, &memo, &payload));
+
+  std::shared_ptr<io::BufferOutputStream> out;
+  ASSERT_OK(io::BufferOutputStream::Create(0, default_memory_pool(), &out));
+  int32_t metadata_length = -1;
+  ASSERT_OK(internal::WriteIpcPayload(payload, options, out.get(), &metadata_length));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(out->Finish(&buffer));
+
+  io::BufferReader buffer_reader(buffer);
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_RAISES(Invalid, RecordBatchStreamReader::Open(&buffer_reader, &reader));
+}
+
 TEST(TestRecordBatchStreamReader, NotEnoughDictionaries) {
   // ARROW-6126
   std::shared_ptr<RecordBatch> batch;
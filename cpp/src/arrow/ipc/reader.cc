@@ -22,6 +22,7 @@
 #include <sstream>
 #include <string>
 #include <type_traits>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -37,13 +38,17 @@
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/metadata_internal.h"
+#include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
 #include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/ubsan.h"
 #include "arrow/visitor_inline.h"
 
 using arrow::internal::checked_pointer_cast;
@@ -95,8 +100,9 @@ Status InvalidMessageType(Message::Type expected, Message::Type actual) {
 /// Accessor class for flatbuffers metadata
 class IpcComponentSource {
  public:
-  IpcComponentSource(const flatbuf::RecordBatch* metadata, io::RandomAccessFile* file)
-      : metadata_(metadata), file_(file) {}
+  IpcComponentSource(const flatbuf::RecordBatch* metadata, io::RandomAccessFile* file,
+                     util::Codec* codec = nullptr)
+      : metadata_(metadata), file_(file), codec_(codec) {}
 
   Status GetBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
     auto buffers = metadata_->buffers();
@@ -118,10 +124,44 @@ class IpcComponentSource {
             "Buffer ", buffer_index,
             " did not start on 8-byte aligned offset: ", buffer->offset());
       }
-      return file_->ReadAt(buffer->offset(), buffer->length(), out);
+      RETURN_NOT_OK(file_->ReadAt(buffer->offset(), buffer->length(), out));
+      return codec_ == nullptr ? Status::OK() : DecompressBuffer(out);
     }
   }
 
+  // See IpcOptions::compression for the layout of compressed buffers
+  Status DecompressBuffer(std::shared_ptr<Buffer>* buffer) {
+    const int64_t prefix_length = sizeof(int64_t);
+    if ((*buffer)->size() < prefix_length) {
+      return Status::IOError("Compressed buffer of ", (*buffer)->size(),
+                             " bytes is too short");
+    }
+    const uint8_t* data = (*buffer)->data();
+    const int64_t uncompressed_length =
+        BitUtil::FromLittleEndian(util::SafeLoadAs<int64_t>(data));
+    if (uncompressed_length == -1) {
+      // Stored uncompressed
+      *buffer = SliceBuffer(*buffer, prefix_length);
+      return Status::OK();
+    }
+    if (uncompressed_length < 0) {
+      return Status::IOError("Invalid uncompressed buffer length: ", uncompressed_length);
+    }
+
+    std::shared_ptr<Buffer> result;
+    RETURN_NOT_OK(AllocateBuffer(uncompressed_length, &result));
+    int64_t actual_length = 0;
+    RETURN_NOT_OK(codec_->Decompress((*buffer)->size() - prefix_length,
+                                     data + prefix_length, uncompressed_length,
+                                     result->mutable_data(), &actual_length));
+    if (actual_length != uncompressed_length) {
+      return Status::IOError("Buffer decompressed to ", actual_length,
+                             " bytes, expected ", uncompressed_length);
+    }
+    *buffer = std::move(result);
+    return Status::OK();
+  }
+
   Status GetFieldMetadata(int field_index, ArrayData* out) {
     auto nodes = metadata_->nodes();
     if (nodes == nullptr) {
@@ -142,6 +182,7 @@ class IpcComponentSource {
  private:
   const flatbuf::RecordBatch* metadata_;
   io::RandomAccessFile* file_;
+  util::Codec* codec_;
 };
 
 /// Bookkeeping struct for loading array objects from their constituent pieces of raw data
@@ -155,6 +196,8 @@ struct ArrayLoaderContext {
   int buffer_index;
   int field_index;
   int max_recursion_depth;
+  // Only advance the indices past a field which isn't read
+  bool skip_buffers;
 };
 
 static Status LoadArray(const Field& field, ArrayLoaderContext* context, ArrayData* out);
@@ -175,6 +218,10 @@ class ArrayLoader {
   }
 
   Status GetBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
+    if (context_->skip_buffers) {
+      *out = nullptr;
+      return Status::OK();
+    }
     return context_->source->GetBuffer(buffer_index, out);
   }
 
@@ -323,6 +370,9 @@ class ArrayLoader {
   Status Visit(const DictionaryType& type) {
     RETURN_NOT_OK(
         LoadArray(*::arrow::field("indices", type.index_type()), context_, out_));
+    if (context_->skip_buffers) {
+      return Status::OK();
+    }
 
     // Look up dictionary
     int64_t id = -1;
@@ -370,38 +420,93 @@ Status ReadRecordBatch(const Message& message, const std::shared_ptr<Schema>& sc
 // ----------------------------------------------------------------------
 // Array loading
 
+// Compute which fields of the schema are read, and the schema of the batches
+// read. An empty mask means all fields are read.
+static Status GetInclusionMask(const std::shared_ptr<Schema>& schema,
+                               const std::vector<int>& included_fields,
+                               std::vector<bool>* mask,
+                               std::shared_ptr<Schema>* out_schema) {
+  mask->clear();
+  if (included_fields.empty()) {
+    *out_schema = schema;
+    return Status::OK();
+  }
+  mask->resize(schema->num_fields(), false);
+  for (int i : included_fields) {
+    if (i < 0 || i >= schema->num_fields()) {
+      return Status::Invalid("Out of bounds field index: ", i, " for schema with ",
+                             schema->num_fields(), " fields");
+    }
+    (*mask)[i] = true;
+  }
+  std::vector<std::shared_ptr<Field>> fields;
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    if ((*mask)[i]) {
+      fields.push_back(schema->field(i));
+    }
+  }
+  *out_schema = ::arrow::schema(std::move(fields), schema->metadata());
+  return Status::OK();
+}
+
 static Status LoadRecordBatchFromSource(const std::shared_ptr<Schema>& schema,
-                                        int64_t num_rows, int max_recursion_depth,
+                                        int64_t num_rows, const IpcOptions& options,
                                         IpcComponentSource* source,
                                         const DictionaryMemo* dictionary_memo,
                                         std::shared_ptr<RecordBatch>* out) {
-  ArrayLoaderContext context{source, dictionary_memo, /*field_index=*/0,
-                             /*buffer_index=*/0, max_recursion_depth};
+  ArrayLoaderContext context{source,
+                             dictionary_memo,
+                             /*buffer_index=*/0,
+                             /*field_index=*/0,
+                             options.max_recursion_depth,
+                             /*skip_buffers=*/false};
+
+  std::vector<bool> inclusion_mask;
+  std::shared_ptr<Schema> out_schema;
+  RETURN_NOT_OK(
+      GetInclusionMask(schema, options.included_fields, &inclusion_mask, &out_schema));
 
-  std::vector<std::shared_ptr<ArrayData>> arrays(schema->num_fields());
+  std::vector<std::shared_ptr<ArrayData>> arrays;
+  arrays.reserve(out_schema->num_fields());
   for (int i = 0; i < schema->num_fields(); ++i) {
     auto arr = std::make_shared<ArrayData>();
+    // The metadata of a skipped field still has to be walked, to find where
+    // the buffers of the next fields are
+    context.skip_buffers = !inclusion_mask.empty() && !inclusion_mask[i];
     RETURN_NOT_OK(LoadArray(*schema->field(i), &context, arr.get()));
     if (num_rows != arr->length) {
       return Status::IOError("Array length did not match record batch length");
     }
-    arrays[i] = std::move(arr);
+    if (!context.skip_buffers) {
+      arrays.push_back(std::move(arr));
+    }
   }
 
-  *out = RecordBatch::Make(schema, num_rows, std::move(arrays));
+  *out = RecordBatch::Make(std::move(out_schema), num_rows, std::move(arrays));
   return Status::OK();
 }
 
+// The codec of the body buffers of a message, null if they aren't compressed
+static Status GetCodec(const flatbuf::Message* message,
+                       std::unique_ptr<util::Codec>* out) {
+  Compression::type compression;
+  RETURN_NOT_OK(internal::GetCompression(message, &compression));
+  out->reset();
+  if (compression == Compression::UNCOMPRESSED) {
+    return Status::OK();
+  }
+  return util::Codec::Create(compression, out);
+}
+
 static inline Status ReadRecordBatch(const flatbuf::RecordBatch* metadata,
                                      const std::shared_ptr<Schema>& schema,
                                      const DictionaryMemo* dictionary_memo,
-                                     const IpcOptions& options,
+                                     const IpcOptions& options, util::Codec* codec,
                                      io::RandomAccessFile* file,
                                      std::shared_ptr<RecordBatch>* out) {
-  IpcComponentSource source(metadata, file);
-  return LoadRecordBatchFromSource(schema, metadata->length(),
-                                   options.max_recursion_depth, &source, dictionary_memo,
-                                   out);
+  IpcComponentSource source(metadata, file, codec);
+  return LoadRecordBatchFromSource(schema, metadata->length(), options, &source,
+                                   dictionary_memo, out);
 }
 
 Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
@@ -414,7 +519,10 @@ Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& sc
     return Status::IOError(
         "Header-type of flatbuffer-encoded Message is not RecordBatch.");
   }
-  return ReadRecordBatch(batch, schema, dictionary_memo, options, file, out);
+  std::unique_ptr<util::Codec> codec;
+  RETURN_NOT_OK(GetCodec(message, &codec));
+  return ReadRecordBatch(batch, schema, dictionary_memo, options, codec.get(), file,
+                         out);
 }
 
 Status ReadDictionary(const Buffer& metadata, DictionaryMemo* dictionary_memo,
@@ -441,12 +549,17 @@ Status ReadDictionary(const Buffer& metadata, DictionaryMemo* dictionary_memo,
   // The dictionary is embedded in a record batch with a single column
   std::shared_ptr<RecordBatch> batch;
   auto batch_meta = dictionary_batch->data();
+  std::unique_ptr<util::Codec> codec;
+  RETURN_NOT_OK(GetCodec(message, &codec));
   RETURN_NOT_OK(ReadRecordBatch(batch_meta, ::arrow::schema({value_field}),
-                                dictionary_memo, options, file, &batch));
+                                dictionary_memo, options, codec.get(), file, &batch));
   if (batch->num_columns() != 1) {
     return Status::Invalid("Dictionary record batch must only contain one field");
   }
   auto dictionary = batch->column(0);
+  if (dictionary_batch->isDelta()) {
+    return dictionary_memo->AddDictionaryDelta(id, dictionary, default_memory_pool());
+  }
   return dictionary_memo->AddDictionary(id, dictionary);
 }
 
@@ -478,6 +591,10 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
     if (message->header() == nullptr) {
       return Status::IOError("Header-pointer of flatbuffer-encoded Message is null.");
     }
+    // The schema message announces the codec of the batches, fail now rather
+    // than on the first batch if it isn't available
+    std::unique_ptr<util::Codec> codec;
+    RETURN_NOT_OK(GetCodec(flatbuf::GetMessage(message->metadata()->data()), &codec));
     return internal::GetSchema(message->header(), &dictionary_memo_, &schema_);
   }
 
@@ -540,22 +657,25 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
     }
 
     std::unique_ptr<Message> message;
-    RETURN_NOT_OK(message_reader_->ReadNextMessage(&message));
-    if (message == nullptr) {
-      // End of stream
-      *batch = nullptr;
-      return Status::OK();
+    while (true) {
+      RETURN_NOT_OK(message_reader_->ReadNextMessage(&message));
+      if (message == nullptr) {
+        // End of stream
+        *batch = nullptr;
+        return Status::OK();
+      }
+      if (message->type() != Message::DICTIONARY_BATCH) {
+        break;
+      }
+      // A dictionary delta, which applies to the following batches. Replacing
+      // a dictionary isn't supported, AddDictionary fails in that case
+      RETURN_NOT_OK(ParseDictionary(*message));
     }
 
-    if (message->type() == Message::DICTIONARY_BATCH) {
-      // TODO(wesm): implement delta dictionaries
-      return Status::NotImplemented("Delta dictionaries not yet implemented");
-    } else {
-      CHECK_HAS_BODY(*message);
-      io::BufferReader reader(message->body());
-      return ReadRecordBatch(*message->metadata(), schema_, &dictionary_memo_, &reader,
-                             batch);
-    }
+    CHECK_HAS_BODY(*message);
+    io::BufferReader reader(message->body());
+    return ReadRecordBatch(*message->metadata(), schema_, &dictionary_memo_, &reader,
+                           batch);
   }
 
   std::shared_ptr<Schema> schema() const { return schema_; }
@@ -691,17 +811,80 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
   }
 
   Status ReadDictionaries() {
-    // Read all the dictionaries
+    // Read all the dictionaries of the included fields. The body of the others
+    // isn't read from the file
     for (int i = 0; i < num_dictionaries(); ++i) {
-      std::unique_ptr<Message> message;
-      RETURN_NOT_OK(ReadMessageFromBlock(GetDictionaryBlock(i), &message));
+      const FileBlock block = GetDictionaryBlock(i);
+      std::shared_ptr<Buffer> metadata;
+      RETURN_NOT_OK(
+          ReadMessageMetadata(block.offset, block.metadata_length, file_, &metadata));
+      if (metadata == nullptr) {
+        return Status::IOError("Dictionary ", i, " is missing from the file");
+      }
+      if (skip_dictionaries_) {
+        const flatbuf::Message* fb_message;
+        RETURN_NOT_OK(
+            internal::VerifyMessage(metadata->data(), metadata->size(), &fb_message));
+        auto dictionary_batch = fb_message->header_as_DictionaryBatch();
+        if (dictionary_batch == nullptr) {
+          return Status::IOError(
+              "Header-type of flatbuffer-encoded Message is not DictionaryBatch.");
+        }
+        if (included_dictionaries_.count(dictionary_batch->id()) == 0) {
+          continue;
+        }
+      }
 
+      std::unique_ptr<Message> message;
+      RETURN_NOT_OK(Message::ReadFrom(block.offset + block.metadata_length, metadata,
+                                      file_, &message));
       io::BufferReader reader(message->body());
       RETURN_NOT_OK(ReadDictionary(*message->metadata(), &dictionary_memo_, &reader));
     }
     return Status::OK();
   }
 
+  // Record the ids of the dictionaries of a field and its children
+  Status CollectDictionaryIds(const Field& field) {
+    if (field.type()->id() == Type::DICTIONARY) {
+      int64_t id = -1;
+      RETURN_NOT_OK(dictionary_memo_.GetId(field, &id));
+      included_dictionaries_.insert(id);
+    }
+    for (const auto& child : field.type()->children()) {
+      RETURN_NOT_OK(CollectDictionaryIds(*child));
+    }
+    return Status::OK();
+  }
+
+  // A record batch message with its verified metadata
+  struct RecordBatchMessage {
+    std::unique_ptr<Message> message;
+    const flatbuf::RecordBatch* metadata;
+    std::unique_ptr<util::Codec> codec;
+  };
+
+  Status ReadRecordBatchMessage(int i, std::unique_ptr<RecordBatchMessage>* out) {
+    std::unique_ptr<RecordBatchMessage> result(new RecordBatchMessage);
+    RETURN_NOT_OK(ReadMessageFromBlock(GetRecordBatchBlock(i), &result->message));
+    if (result->message == nullptr) {
+      return Status::IOError("Record batch ", i, " is missing from the file");
+    }
+    CHECK_MESSAGE_TYPE(Message::RECORD_BATCH, result->message->type());
+    CHECK_HAS_BODY(*result->message);
+
+    // The Message constructor verified the flatbuffer already
+    auto fb_message = flatbuf::GetMessage(result->message->metadata()->data());
+    result->metadata = fb_message->header_as_RecordBatch();
+    if (result->metadata == nullptr) {
+      return Status::IOError(
+          "Header-type of flatbuffer-encoded Message is not RecordBatch.");
+    }
+    RETURN_NOT_OK(GetCodec(fb_message, &result->codec));
+    *out = std::move(result);
+    return Status::OK();
+  }
+
   Status ReadRecordBatch(int i, std::shared_ptr<RecordBatch>* batch) {
     DCHECK_GE(i, 0);
     DCHECK_LT(i, num_record_batches());
@@ -711,32 +894,58 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
       read_dictionaries_ = true;
     }
 
-    std::unique_ptr<Message> message;
-    RETURN_NOT_OK(ReadMessageFromBlock(GetRecordBatchBlock(i), &message));
+    std::unique_ptr<RecordBatchMessage> uncached;
+    const RecordBatchMessage* message;
+    if (file_->supports_zero_copy()) {
+      // The messages only reference the file, so keeping them is cheap and
+      // the metadata is only read and verified once per batch
+      auto& cached = cached_messages_[i];
+      if (cached == nullptr) {
+        RETURN_NOT_OK(ReadRecordBatchMessage(i, &cached));
+      }
+      message = cached.get();
+    } else {
+      RETURN_NOT_OK(ReadRecordBatchMessage(i, &uncached));
+      message = uncached.get();
+    }
 
-    io::BufferReader reader(message->body());
-    return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, &dictionary_memo_,
-                                         &reader, batch);
+    // With zero-copy, the buffers of the included fields are slices of the
+    // file and the other fields aren't touched
+    io::BufferReader reader(message->message->body());
+    return ::arrow::ipc::ReadRecordBatch(message->metadata, schema_, &dictionary_memo_,
+                                         options_, message->codec.get(), &reader, batch);
   }
 
   Status ReadSchema() {
     // Get the schema and record any observed dictionaries
-    return internal::GetSchema(footer_->schema(), &dictionary_memo_, &schema_);
+    RETURN_NOT_OK(internal::GetSchema(footer_->schema(), &dictionary_memo_, &schema_));
+    std::vector<bool> inclusion_mask;
+    RETURN_NOT_OK(GetInclusionMask(schema_, options_.included_fields, &inclusion_mask,
+                                   &out_schema_));
+    skip_dictionaries_ = !inclusion_mask.empty();
+    for (const auto& field : out_schema_->fields()) {
+      RETURN_NOT_OK(CollectDictionaryIds(*field));
+    }
+    return Status::OK();
   }
 
-  Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset) {
+  Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset,
+              const IpcOptions& options) {
     owned_file_ = file;
-    return Open(file.get(), footer_offset);
+    return Open(file.get(), footer_offset, options);
   }
 
-  Status Open(io::RandomAccessFile* file, int64_t footer_offset) {
+  Status Open(io::RandomAccessFile* file, int64_t footer_offset,
+              const IpcOptions& options) {
     file_ = file;
     footer_offset_ = footer_offset;
+    options_ = options;
     RETURN_NOT_OK(ReadFooter());
+    cached_messages_.resize(num_record_batches());
     return ReadSchema();
   }
 
-  std::shared_ptr<Schema> schema() const { return schema_; }
+  std::shared_ptr<Schema> schema() const { return out_schema_; }
 
  private:
   io::RandomAccessFile* file_;
@@ -751,11 +960,21 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
   std::shared_ptr<Buffer> footer_buffer_;
   const flatbuf::Footer* footer_;
 
+  IpcOptions options_;
+
   bool read_dictionaries_ = false;
   DictionaryMemo dictionary_memo_;
+  // Whether the dictionaries of the fields which aren't included are skipped
+  bool skip_dictionaries_ = false;
+  std::unordered_set<int64_t> included_dictionaries_;
 
   // Reconstructed schema, including any read dictionaries
   std::shared_ptr<Schema> schema_;
+  // Schema of the batches read, with only the included fields
+  std::shared_ptr<Schema> out_schema_;
+
+  // Record batch messages already read from a zero-copy file
+  std::vector<std::unique_ptr<RecordBatchMessage>> cached_messages_;
 };
 
 RecordBatchFileReader::RecordBatchFileReader() {
@@ -773,8 +992,14 @@ Status RecordBatchFileReader::Open(io::RandomAccessFile* file,
 
 Status RecordBatchFileReader::Open(io::RandomAccessFile* file, int64_t footer_offset,
                                    std::shared_ptr<RecordBatchFileReader>* reader) {
+  return Open(file, footer_offset, IpcOptions::Defaults(), reader);
+}
+
+Status RecordBatchFileReader::Open(io::RandomAccessFile* file, int64_t footer_offset,
+                                   const IpcOptions& options,
+                                   std::shared_ptr<RecordBatchFileReader>* reader) {
   *reader = std::shared_ptr<RecordBatchFileReader>(new RecordBatchFileReader());
-  return (*reader)->impl_->Open(file, footer_offset);
+  return (*reader)->impl_->Open(file, footer_offset, options);
 }
 
 Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>& file,
@@ -787,8 +1012,14 @@ Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>&
 Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>& file,
                                    int64_t footer_offset,
                                    std::shared_ptr<RecordBatchFileReader>* reader) {
+  return Open(file, footer_offset, IpcOptions::Defaults(), reader);
+}
+
+Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>& file,
+                                   int64_t footer_offset, const IpcOptions& options,
+                                   std::shared_ptr<RecordBatchFileReader>* reader) {
   *reader = std::shared_ptr<RecordBatchFileReader>(new RecordBatchFileReader());
-  return (*reader)->impl_->Open(file, footer_offset);
+  return (*reader)->impl_->Open(file, footer_offset, options);
 }
 
 std::shared_ptr<Schema> RecordBatchFileReader::schema() const { return impl_->schema(); }
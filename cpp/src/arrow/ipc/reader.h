@@ -142,7 +142,35 @@ class ARROW_EXPORT RecordBatchFileReader {
                      int64_t footer_offset,
                      std::shared_ptr<RecordBatchFileReader>* reader);
 
-  /// \brief The schema read from the file
+  /// \brief Open a RecordBatchFileReader with options
+  ///
+  /// With IpcOptions::included_fields, only the buffers of the included fields
+  /// are read. On a file supporting zero-copy reads, such as a
+  /// io::MemoryMappedFile, reading those is only slicing the mapping, and the
+  /// metadata of each record batch is parsed once and kept by the reader.
+  ///
+  /// \param[in] file the data source
+  /// \param[in] footer_offset the position of the end of the Arrow file
+  /// \param[in] options options for reading, e.g. the fields to read
+  /// \param[out] reader the returned reader
+  /// \return Status
+  static Status Open(io::RandomAccessFile* file, int64_t footer_offset,
+                     const IpcOptions& options,
+                     std::shared_ptr<RecordBatchFileReader>* reader);
+
+  /// \brief Version of Open with options that retains ownership of file
+  ///
+  /// \param[in] file the data source
+  /// \param[in] footer_offset the position of the end of the Arrow file
+  /// \param[in] options options for reading, e.g. the fields to read
+  /// \param[out] reader the returned reader
+  /// \return Status
+  static Status Open(const std::shared_ptr<io::RandomAccessFile>& file,
+                     int64_t footer_offset, const IpcOptions& options,
+                     std::shared_ptr<RecordBatchFileReader>* reader);
+
+  /// \brief The schema of the batches read, only with the included fields if
+  /// IpcOptions::included_fields was given
   std::shared_ptr<Schema> schema() const;
 
   /// \brief Returns the number of record batches in the file
@@ -44,8 +44,11 @@
 #include "arrow/type.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/stl.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor.h"
 
 namespace arrow {
@@ -156,7 +159,66 @@ class RecordBatchSerializer : public ArrayVisitor {
   // Override this for writing dictionary metadata
   virtual Status SerializeMetadata(int64_t num_rows) {
     return WriteRecordBatchMessage(num_rows, out_->body_length, field_nodes_,
-                                   buffer_meta_, &out_->metadata);
+                                   buffer_meta_, options_.compression, &out_->metadata);
+  }
+
+  // Replace a body buffer by its uncompressed length as a little-endian int64,
+  // followed by the compressed bytes. A buffer which doesn't shrink is kept
+  // uncompressed, after a length of -1.
+  Status CompressBuffer(util::Codec* codec, std::shared_ptr<Buffer>* buffer) {
+    if (*buffer == nullptr || (*buffer)->size() == 0) {
+      // Absent buffers stay empty
+      return Status::OK();
+    }
+    const Buffer& input = **buffer;
+    const int64_t prefix_length = sizeof(int64_t);
+    const int64_t max_length = codec->MaxCompressedLen(input.size(), input.data());
+
+    std::shared_ptr<ResizableBuffer> result;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, prefix_length + max_length, &result));
+    int64_t compressed_length = 0;
+    RETURN_NOT_OK(codec->Compress(input.size(), input.data(), max_length,
+                                  result->mutable_data() + prefix_length,
+                                  &compressed_length));
+
+    int64_t uncompressed_length = input.size();
+    if (compressed_length >= input.size()) {
+      uncompressed_length = -1;
+      compressed_length = input.size();
+      std::memcpy(result->mutable_data() + prefix_length, input.data(), input.size());
+    }
+    uncompressed_length = BitUtil::ToLittleEndian(uncompressed_length);
+    std::memcpy(result->mutable_data(), &uncompressed_length, prefix_length);
+    RETURN_NOT_OK(result->Resize(prefix_length + compressed_length, false));
+    *buffer = std::move(result);
+    return Status::OK();
+  }
+
+  Status CompressBodyBuffers() {
+    if (options_.compression != Compression::LZ4 &&
+        options_.compression != Compression::ZSTD) {
+      return Status::Invalid("Unsupported IPC body compression: ",
+                             util::Codec::GetCodecAsString(options_.compression));
+    }
+    std::unique_ptr<util::Codec> codec;
+    RETURN_NOT_OK(util::Codec::Create(options_.compression, &codec));
+
+    auto compress_buffer = [&](int i) {
+      return CompressBuffer(codec.get(), &out_->body_buffers[i]);
+    };
+    const int num_buffers = static_cast<int>(out_->body_buffers.size());
+    // Waiting on pool tasks from a pool thread could deadlock, if all the
+    // workers are waiting
+    if (options_.use_threads && num_buffers > 1 &&
+        !::arrow::internal::GetCpuThreadPool()->OwnsThisThread()) {
+      // The one-shot codec functions don't keep state, so one codec can be
+      // shared by the tasks
+      return ::arrow::internal::ParallelFor(num_buffers, compress_buffer);
+    }
+    for (int i = 0; i < num_buffers; ++i) {
+      RETURN_NOT_OK(compress_buffer(i));
+    }
+    return Status::OK();
   }
 
   Status Assemble(const RecordBatch& batch) {
@@ -171,6 +233,11 @@ class RecordBatchSerializer : public ArrayVisitor {
       RETURN_NOT_OK(VisitArray(*batch.column(i)));
     }
 
+    const bool compressed = options_.compression != Compression::UNCOMPRESSED;
+    if (compressed) {
+      RETURN_NOT_OK(CompressBodyBuffers());
+    }
+
     // The position for the start of a buffer relative to the passed frame of
     // reference. May be 0 or some other position in an address space
     int64_t offset = buffer_start_offset_;
@@ -189,7 +256,8 @@ class RecordBatchSerializer : public ArrayVisitor {
         padding = BitUtil::RoundUpToMultipleOf8(size) - size;
       }
 
-      buffer_meta_.push_back({offset, size + padding});
+      // Compressed buffers must be read without their padding
+      buffer_meta_.push_back({offset, compressed ? size : size + padding});
       offset += size + padding;
     }
 
@@ -510,14 +578,17 @@ class RecordBatchSerializer : public ArrayVisitor {
 
 class DictionaryWriter : public RecordBatchSerializer {
  public:
-  DictionaryWriter(int64_t dictionary_id, MemoryPool* pool, int64_t buffer_start_offset,
-                   const IpcOptions& options, IpcPayload* out)
+  DictionaryWriter(int64_t dictionary_id, bool is_delta, MemoryPool* pool,
+                   int64_t buffer_start_offset, const IpcOptions& options,
+                   IpcPayload* out)
       : RecordBatchSerializer(pool, buffer_start_offset, options, out),
-        dictionary_id_(dictionary_id) {}
+        dictionary_id_(dictionary_id),
+        is_delta_(is_delta) {}
 
   Status SerializeMetadata(int64_t num_rows) override {
-    return WriteDictionaryMessage(dictionary_id_, num_rows, out_->body_length,
-                                  field_nodes_, buffer_meta_, &out_->metadata);
+    return WriteDictionaryMessage(dictionary_id_, is_delta_, num_rows, out_->body_length,
+                                  field_nodes_, buffer_meta_, options_.compression,
+                                  &out_->metadata);
   }
 
   Status Assemble(const std::shared_ptr<Array>& dictionary) {
@@ -529,6 +600,7 @@ class DictionaryWriter : public RecordBatchSerializer {
 
  private:
   int64_t dictionary_id_;
+  bool is_delta_;
 };
 
 Status WriteIpcPayload(const IpcPayload& payload, const IpcOptions& options,
@@ -570,15 +642,23 @@ Status WriteIpcPayload(const IpcPayload& payload, const IpcOptions& options,
 Status GetSchemaPayload(const Schema& schema, const IpcOptions& options,
                         DictionaryMemo* dictionary_memo, IpcPayload* out) {
   out->type = Message::SCHEMA;
-  return WriteSchemaMessage(schema, dictionary_memo, &out->metadata);
+  return WriteSchemaMessage(schema, dictionary_memo, options.compression,
+                            &out->metadata);
 }
 
 Status GetDictionaryPayload(int64_t id, const std::shared_ptr<Array>& dictionary,
                             const IpcOptions& options, MemoryPool* pool,
                             IpcPayload* out) {
+  return GetDictionaryPayload(id, /*is_delta=*/false, dictionary, options, pool, out);
+}
+
+Status GetDictionaryPayload(int64_t id, bool is_delta,
+                            const std::shared_ptr<Array>& dictionary,
+                            const IpcOptions& options, MemoryPool* pool,
+                            IpcPayload* out) {
   out->type = Message::DICTIONARY_BATCH;
   // Frame of reference is 0, see ARROW-384
-  DictionaryWriter writer(id, pool, /*buffer_start_offset=*/0, options, out);
+  DictionaryWriter writer(id, is_delta, pool, /*buffer_start_offset=*/0, options, out);
   return writer.Assemble(dictionary);
 }
 
@@ -920,11 +1000,10 @@ class RecordBatchPayloadWriter : public RecordBatchWriter {
     if (!wrote_dictionaries_) {
       RETURN_NOT_OK(WriteDictionaries(batch));
       wrote_dictionaries_ = true;
+    } else if (dictionary_memo_->num_dictionaries() > 0) {
+      RETURN_NOT_OK(WriteDictionaryDeltas(batch));
     }
 
-    // TODO(wesm): Check for delta dictionaries. Can we scan for
-    // deltas while computing the RecordBatch payload to save time?
-
     internal::IpcPayload payload;
     RETURN_NOT_OK(GetRecordBatchPayload(batch, options_, pool_, &payload));
     return payload_writer_->WritePayload(payload);
@@ -969,6 +1048,21 @@ class RecordBatchPayloadWriter : public RecordBatchWriter {
     return Status::OK();
   }
 
+  // Dictionaries which grew since the previous batch are sent as deltas with
+  // only their new values
+  Status WriteDictionaryDeltas(const RecordBatch& batch) {
+    DictionaryVector deltas;
+    RETURN_NOT_OK(CollectDictionaryDeltas(schema_, batch, dictionary_memo_, &deltas));
+
+    for (const auto& delta : deltas) {
+      internal::IpcPayload payload;
+      RETURN_NOT_OK(GetDictionaryPayload(delta.first, /*is_delta=*/true, delta.second,
+                                         options_, pool_, &payload));
+      RETURN_NOT_OK(payload_writer_->WritePayload(payload));
+    }
+    return Status::OK();
+  }
+
  protected:
   std::unique_ptr<internal::IpcPayloadWriter> payload_writer_;
   std::shared_ptr<Schema> shared_schema_;
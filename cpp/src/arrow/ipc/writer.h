@@ -362,6 +362,7 @@ Status GetSchemaPayload(const Schema& schema, const IpcOptions& options,
 /// \param[in] id the dictionary id
 /// \param[in] dictionary the dictionary values
 /// \param[in] options options for serialization
+/// \param[in] pool a MemoryPool to allocate memory from
 /// \param[out] payload the output IpcPayload
 /// \return Status
 ARROW_EXPORT
@@ -369,6 +370,20 @@ Status GetDictionaryPayload(int64_t id, const std::shared_ptr<Array>& dictionary
                             const IpcOptions& options, MemoryPool* pool,
                             IpcPayload* payload);
 
+/// \brief Compute IpcPayload for a dictionary or a dictionary delta
+/// \param[in] id the dictionary id
+/// \param[in] is_delta whether the values are appended to the dictionary
+/// \param[in] dictionary the dictionary values, or the delta values
+/// \param[in] options options for serialization
+/// \param[in] pool a MemoryPool to allocate memory from
+/// \param[out] payload the output IpcPayload
+/// \return Status
+ARROW_EXPORT
+Status GetDictionaryPayload(int64_t id, bool is_delta,
+                            const std::shared_ptr<Array>& dictionary,
+                            const IpcOptions& options, MemoryPool* pool,
+                            IpcPayload* payload);
+
 /// \brief Compute IpcPayload for the given record batch
 /// \param[in] batch the RecordBatch that is being serialized
 /// \param[in] options options for serialization
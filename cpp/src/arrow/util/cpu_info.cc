@@ -74,6 +74,7 @@ static struct {
     {"sse4_1", CpuInfo::SSE4_1},
     {"sse4_2", CpuInfo::SSE4_2},
     {"popcnt", CpuInfo::POPCNT},
+    {"avx2", CpuInfo::AVX2},
 };
 static const int64_t num_flags = sizeof(flag_mappings) / sizeof(flag_mappings[0]);
 
@@ -143,6 +144,18 @@ bool RetrieveCacheSize(int64_t* cache_sizes) {
   return true;
 }
 
+// Whether the OS saves the XMM and YMM registers on context switches, which
+// is required to use AVX instructions
+bool OsSavesYmmState() {
+#ifdef _MSC_VER
+  return (_xgetbv(0) & 0x6) == 0x6;
+#else
+  uint32_t eax, edx;
+  __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return (eax & 0x6) == 0x6;
+#endif
+}
+
 bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   if (!hardware_flags || !model_name) {
     return false;
@@ -180,6 +193,14 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   if (features_ECX[19]) *hardware_flags |= CpuInfo::SSE4_1;
   if (features_ECX[20]) *hardware_flags |= CpuInfo::SSE4_2;
   if (features_ECX[23]) *hardware_flags |= CpuInfo::POPCNT;
+
+  // Extended features are in EBX of leaf 7, AVX2 also needs OSXSAVE (ECX
+  // of leaf 1) and the OS to enable the YMM state
+  if (highest_valid_id >= 7 && features_ECX[27] && OsSavesYmmState()) {
+    __cpuidex(cpu_info.data(), 7, 0);
+    std::bitset<32> features_EBX = cpu_info[1];
+    if (features_EBX[5]) *hardware_flags |= CpuInfo::AVX2;
+  }
   return true;
 }
 #endif
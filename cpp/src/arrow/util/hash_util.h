@@ -22,6 +22,7 @@
 
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
@@ -288,6 +289,48 @@ class HashUtil {
     return h;
   }
 
+  /// \brief 32-bit MurmurHash3 of an 8-byte value
+  ///
+  /// Identical to the hash32 function of Gandiva, which hashes numeric values
+  /// as the bits of their conversion to double.
+  static uint32_t MurmurHash3_32(uint64_t val, uint32_t seed) {
+    uint64_t h1 = seed;
+    for (int i = 0; i < 2; i++) {
+      h1 = MurmurHash3_32Mix(h1, static_cast<uint32_t>(val >> (i * 32)));
+    }
+    return MurmurHash3_32Finalize(h1, 8);
+  }
+
+  /// \brief 32-bit MurmurHash3 of a buffer
+  ///
+  /// Identical to the hash32 function of Gandiva for binary and string values.
+  static uint32_t MurmurHash3_32(const void* data, int32_t len, uint32_t seed) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+    const int32_t nblocks = len / 4;
+    // Gandiva sign-extends the seed here, which matters for chained hashes
+    uint64_t h1 = static_cast<uint64_t>(static_cast<int64_t>(static_cast<int32_t>(seed)));
+    for (int32_t i = 0; i < nblocks; i++) {
+      uint32_t block;
+      memcpy(&block, bytes + i * 4, sizeof(block));
+      h1 = MurmurHash3_32Mix(h1, block);
+    }
+
+    const uint8_t* tail = bytes + nblocks * 4;
+    uint64_t k1 = 0;
+    switch (len & 3) {
+      case 3:
+        k1 = static_cast<uint64_t>(tail[2]) << 16;
+        // fallthrough
+      case 2:
+        k1 |= static_cast<uint64_t>(tail[1]) << 8;
+        // fallthrough
+      case 1:
+        k1 |= tail[0];
+        h1 ^= MurmurHash3_32Scramble(k1);
+    }
+    return MurmurHash3_32Finalize(h1, len);
+  }
+
   /// default values recommended by http://isthe.com/chongo/tech/comp/fnv/
   static const uint32_t FNV_PRIME = 0x01000193;  //   16777619
   static const uint32_t FNV_SEED = 0x811C9DC5;   // 2166136261
@@ -363,6 +406,32 @@ class HashUtil {
     const uint64_t hash2 = (static_cast<uint64_t>(hash) * m2 + a2) >> 32;
     return hash1 | (hash2 << 32);
   }
+
+ private:
+  // MurmurHash3 steps, computed on 64 bits and masked like Gandiva does
+  static const uint64_t MURMUR3_UINT_MASK = 0xffffffffull;
+
+  static inline uint64_t MurmurHash3_32Scramble(uint64_t k1) {
+    k1 = (k1 * 0xcc9e2d51ull) & MURMUR3_UINT_MASK;
+    k1 = ((k1 << 15) & MURMUR3_UINT_MASK) | (k1 >> 17);
+    return (k1 * 0x1b873593ull) & MURMUR3_UINT_MASK;
+  }
+
+  static inline uint64_t MurmurHash3_32Mix(uint64_t h1, uint32_t block) {
+    h1 ^= MurmurHash3_32Scramble(block);
+    h1 = ((h1 << 13) & MURMUR3_UINT_MASK) | (h1 >> 19);
+    return (h1 * 5 + 0xe6546b64ull) & MURMUR3_UINT_MASK;
+  }
+
+  static inline uint32_t MurmurHash3_32Finalize(uint64_t h1, int32_t len) {
+    h1 ^= static_cast<uint64_t>(len);
+    h1 ^= h1 >> 16;
+    h1 = (h1 * 0x85ebca6bull) & MURMUR3_UINT_MASK;
+    h1 ^= h1 >> 13;
+    h1 = (h1 * 0xc2b2ae35ull) & MURMUR3_UINT_MASK;
+    h1 ^= h1 >> 16;
+    return static_cast<uint32_t>(h1);
+  }
 };
 
 // HW Hash
@@ -182,6 +182,17 @@ int ThreadPool::GetCapacity() {
   return state_->desired_capacity_;
 }
 
+bool ThreadPool::OwnsThisThread() {
+  std::unique_lock<std::mutex> lock(state_->mutex_);
+  const auto thread_id = std::this_thread::get_id();
+  for (const auto& worker : state_->workers_) {
+    if (worker.get_id() == thread_id) {
+      return true;
+    }
+  }
+  return false;
+}
+
 int ThreadPool::GetActualCapacity() {
   ProtectAgainstFork();
   std::unique_lock<std::mutex> lock(state_->mutex_);
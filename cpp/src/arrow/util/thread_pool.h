@@ -94,6 +94,11 @@ class ARROW_EXPORT ThreadPool {
   // This is exposed as a static method to help with testing.
   static int DefaultCapacity();
 
+  // Whether the calling thread is one of the pool's workers.  Tasks waiting on
+  // other tasks of the same pool should run them inline instead, since all the
+  // workers may be waiting.
+  bool OwnsThisThread();
+
   // Shutdown the pool.  Once the pool starts shutting down, new tasks
   // cannot be submitted anymore.
   // If "wait" is true, shutdown waits for all pending tasks to be finished.
@@ -296,6 +296,17 @@ TEST_F(TestThreadPool, Submit) {
   }
 }
 
+TEST_F(TestThreadPool, OwnsThisThread) {
+  auto pool = this->MakeThreadPool(3);
+  ASSERT_FALSE(pool->OwnsThisThread());
+  auto fut = pool->Submit([&pool] { return pool->OwnsThisThread(); });
+  ASSERT_TRUE(fut.get());
+
+  auto other_pool = this->MakeThreadPool(1);
+  fut = pool->Submit([&other_pool] { return other_pool->OwnsThisThread(); });
+  ASSERT_FALSE(fut.get());
+}
+
 // Test fork safety on Unix
 
 #if !(defined(_WIN32) || defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER) || \
@@ -61,8 +61,12 @@
 #pragma warning(pop)
 #endif
 
+#include "arrow/buffer.h"
+#include "arrow/util/config.h"
+
 #include "gandiva/decimal_ir.h"
 #include "gandiva/exported_funcs_registry.h"
+#include "gandiva/object_cache.h"
 
 namespace gandiva {
 
@@ -71,6 +75,44 @@ extern const size_t kPrecompiledBitcodeSize;
 
 std::once_flag init_once_flag;
 
+namespace {
+
+// Serves the object of a single module from the persistent cache, or stores it
+// there once compiled.
+class ModuleObjectCache : public llvm::ObjectCache {
+ public:
+  ModuleObjectCache(PersistentObjectCache* cache, std::string key,
+                    std::shared_ptr<arrow::Buffer> cached_object)
+      : cache_(cache), key_(std::move(key)), cached_object_(std::move(cached_object)) {}
+
+  void notifyObjectCompiled(const llvm::Module* module,
+                            llvm::MemoryBufferRef object) override {
+    auto status =
+        cache_->Put(key_, reinterpret_cast<const uint8_t*>(object.getBufferStart()),
+                    static_cast<int64_t>(object.getBufferSize()));
+    if (!status.ok()) {
+      ARROW_LOG(WARNING) << "Failed to store a compiled module in the object cache: "
+                         << status.ToString();
+    }
+  }
+
+  std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override {
+    if (cached_object_ == nullptr) {
+      return nullptr;
+    }
+    auto data = llvm::StringRef(reinterpret_cast<const char*>(cached_object_->data()),
+                                static_cast<size_t>(cached_object_->size()));
+    return llvm::MemoryBuffer::getMemBufferCopy(data, key_);
+  }
+
+ private:
+  PersistentObjectCache* cache_;
+  std::string key_;
+  std::shared_ptr<arrow::Buffer> cached_object_;
+};
+
+}  // namespace
+
 bool Engine::init_once_done_ = false;
 std::set<std::string> Engine::loaded_libs_ = {};
 std::mutex Engine::mtx_;
@@ -197,7 +239,18 @@ Status Engine::FinalizeModule(bool optimise_ir, bool dump_ir) {
     DumpIR("Before optimise");
   }
 
-  if (optimise_ir) {
+  // The object code of a module that was already compiled, possibly by another
+  // process, is loaded as is, without optimising or compiling the IR.
+  std::shared_ptr<arrow::Buffer> cached_object;
+  PersistentObjectCache* persistent_cache = PersistentObjectCache::GetDefault();
+  if (persistent_cache != nullptr) {
+    std::string key = ObjectCacheKey(optimise_ir);
+    cached_object = persistent_cache->Get(key);
+    object_cache_.reset(new ModuleObjectCache(persistent_cache, key, cached_object));
+    execution_engine_->setObjectCache(object_cache_.get());
+  }
+
+  if (optimise_ir && cached_object == nullptr) {
     // misc passes to allow for inlining, vectorization, ..
     std::unique_ptr<llvm::legacy::PassManager> pass_manager(
         new llvm::legacy::PassManager());
@@ -236,6 +289,21 @@ Status Engine::FinalizeModule(bool optimise_ir, bool dump_ir) {
   return Status::OK();
 }
 
+std::string Engine::ObjectCacheKey(bool optimise_ir) {
+  // The module IR already reflects the expressions, the schema and the
+  // configuration, so only the target and the version have to be added.
+  std::string description;
+  llvm::raw_string_ostream stream(description);
+  module_->print(stream, nullptr);
+  auto target_machine = execution_engine_->getTargetMachine();
+  stream << "\ntarget: " << target_machine->getTargetTriple().str() << " "
+         << target_machine->getTargetCPU() << " "
+         << target_machine->getTargetFeatureString() << "\noptimise: " << optimise_ir
+         << "\nversion: " << ARROW_VERSION;
+  stream.flush();
+  return PersistentObjectCache::MakeKey(description);
+}
+
 void* Engine::CompiledFunction(llvm::Function* irFunction) {
   DCHECK(module_finalized_);
   return execution_engine_->getPointerToFunction(irFunction);
@@ -250,6 +318,16 @@ void Engine::AddGlobalMappingForFunc(const std::string& name, llvm::Type* ret_ty
   execution_engine_->addGlobalMapping(fn, function_ptr);
 }
 
+llvm::Constant* Engine::AddGlobalMappingForPointer(const void* ptr) {
+  // Declare an external global whose address is the pointer
+  std::string name = "gdv_mapped_ptr_" + std::to_string(num_mapped_pointers_++);
+  auto global = new llvm::GlobalVariable(*module_, types_->i8_type(), true /*isConstant*/,
+                                         llvm::GlobalValue::ExternalLinkage,
+                                         nullptr /*Initializer*/, name);
+  execution_engine_->addGlobalMapping(global, const_cast<void*>(ptr));
+  return llvm::ConstantExpr::getPtrToInt(global, types_->i64_type());
+}
+
 void Engine::AddGlobalMappings() { ExportedFuncsRegistry::AddMappings(this); }
 
 void Engine::DumpIR(std::string prefix) {
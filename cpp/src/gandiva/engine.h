@@ -68,10 +68,15 @@ class GANDIVA_EXPORT Engine {
   void AddGlobalMappingForFunc(const std::string& name, llvm::Type* ret_type,
                                const std::vector<llvm::Type*>& args, void* func);
 
+  /// Get an i64 constant holding the address of an object owned by the caller.
+  /// The address is bound by symbol name when the compiled module is loaded, so
+  /// the generated code can be cached and reused by other processes.
+  llvm::Constant* AddGlobalMappingForPointer(const void* ptr);
+
  private:
   /// private constructor to ensure engine is created
   /// only through the factory.
-  Engine() : module_finalized_(false) {}
+  Engine() : module_finalized_(false), num_mapped_pointers_(0) {}
 
   /// do one time inits.
   static void InitOnce();
@@ -92,7 +97,12 @@ class GANDIVA_EXPORT Engine {
   /// dump the IR code to stdout with the prefix string.
   void DumpIR(std::string prefix);
 
+  /// Key of the module in the persistent object cache.
+  std::string ObjectCacheKey(bool optimise_ir);
+
   std::unique_ptr<llvm::LLVMContext> context_;
+  // Must outlive the execution engine, which refers to it
+  std::unique_ptr<llvm::ObjectCache> object_cache_;
   std::unique_ptr<llvm::ExecutionEngine> execution_engine_;
   std::unique_ptr<LLVMTypes> types_;
   std::unique_ptr<llvm::IRBuilder<>> ir_builder_;
@@ -102,6 +112,7 @@ class GANDIVA_EXPORT Engine {
   std::vector<std::string> functions_to_compile_;
 
   bool module_finalized_;
+  int num_mapped_pointers_;
   std::string llvm_error_;
 
   static std::set<std::string> loaded_libs_;
@@ -679,7 +679,8 @@ void LLVMGenerator::Visitor::Visit(const LiteralDex& dex) {
     case arrow::Type::BINARY: {
       const std::string& str = arrow::util::get<std::string>(dex.holder());
 
-      llvm::Constant* str_int_cast = types->i64_constant((int64_t)str.c_str());
+      llvm::Constant* str_int_cast =
+          generator_->engine_->AddGlobalMappingForPointer(str.c_str());
       value = llvm::ConstantExpr::getIntToPtr(str_int_cast, types->i8_ptr_type());
       len = types->i32_constant(static_cast<int32_t>(str.length()));
       break;
@@ -1021,7 +1022,7 @@ void LLVMGenerator::Visitor::VisitInExpression(const InExprDexBase<Type>& dex) {
   const InExprDex<Type>& dex_instance = dynamic_cast<const InExprDex<Type>&>(dex);
   /* add the holder at the beginning */
   llvm::Constant* ptr_int_cast =
-      types->i64_constant((int64_t)(dex_instance.in_holder().get()));
+      generator_->engine_->AddGlobalMappingForPointer(dex_instance.in_holder().get());
   params.push_back(ptr_int_cast);
 
   /* eval expr result */
@@ -1177,7 +1178,6 @@ LValuePtr LLVMGenerator::Visitor::BuildFunctionCall(const NativeFunction* func,
 std::vector<llvm::Value*> LLVMGenerator::Visitor::BuildParams(
     FunctionHolder* holder, const ValueValidityPairVector& args, bool with_validity,
     bool with_context) {
-  LLVMTypes* types = generator_->types();
   std::vector<llvm::Value*> params;
 
   // add context if required.
@@ -1187,7 +1187,7 @@ std::vector<llvm::Value*> LLVMGenerator::Visitor::BuildParams(
 
   // if the function has holder, add the holder pointer.
   if (holder != nullptr) {
-    auto ptr = types->i64_constant((int64_t)holder);
+    auto ptr = generator_->engine_->AddGlobalMappingForPointer(holder);
     params.push_back(ptr);
   }
 
@@ -1340,7 +1340,7 @@ void LLVMGenerator::AddTrace(const std::string& msg, llvm::Value* value) {
 
   // cast this to an llvm pointer.
   const char* str = trace_strings_.back().c_str();
-  llvm::Constant* str_int_cast = types()->i64_constant((int64_t)str);
+  llvm::Constant* str_int_cast = engine_->AddGlobalMappingForPointer(str);
   llvm::Constant* str_ptr_cast =
       llvm::ConstantExpr::getIntToPtr(str_int_cast, types()->i8_ptr_type());
 
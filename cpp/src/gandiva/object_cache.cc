@@ -0,0 +1,223 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/object_cache.h"
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/filesystem/path_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string.h"
+
+namespace gandiva {
+
+constexpr int64_t PersistentObjectCache::kDefaultCapacity;
+
+static const char kObjectExtension[] = ".o";
+static const char kTempExtension[] = ".tmp";
+
+PersistentObjectCache::PersistentObjectCache(std::string directory, int64_t capacity)
+    : directory_(arrow::fs::internal::RemoveTrailingSlash(directory).to_string()),
+      capacity_(capacity),
+      fs_(std::make_shared<arrow::fs::LocalFileSystem>()),
+      size_(0),
+      num_hits_(0) {}
+
+Status PersistentObjectCache::Make(const std::string& directory, int64_t capacity,
+                                   std::shared_ptr<PersistentObjectCache>* out) {
+  ARROW_RETURN_IF(capacity <= 0, Status::Invalid("Object cache capacity must be > 0"));
+  std::shared_ptr<PersistentObjectCache> cache(
+      new PersistentObjectCache(directory, capacity));
+  ARROW_RETURN_NOT_OK(cache->fs_->CreateDir(directory, /*recursive=*/true));
+  ARROW_RETURN_NOT_OK(cache->LoadIndex());
+  *out = std::move(cache);
+  return Status::OK();
+}
+
+PersistentObjectCache* PersistentObjectCache::GetDefault() {
+  static std::mutex mutex;
+  static std::unordered_map<std::string, std::shared_ptr<PersistentObjectCache>> caches;
+
+  std::string directory;
+  if (!arrow::internal::GetEnvVar("GANDIVA_OBJECT_CACHE_DIR", &directory).ok() ||
+      directory.empty()) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = caches.find(directory);
+  if (it != caches.end()) {
+    return it->second.get();
+  }
+  int64_t capacity = kDefaultCapacity;
+  std::string capacity_str;
+  if (arrow::internal::GetEnvVar("GANDIVA_OBJECT_CACHE_CAPACITY", &capacity_str).ok()) {
+    try {
+      capacity = std::stoll(capacity_str);
+    } catch (...) {
+      ARROW_LOG(WARNING) << "Invalid GANDIVA_OBJECT_CACHE_CAPACITY '" << capacity_str
+                         << "', using the default capacity";
+    }
+  }
+  std::shared_ptr<PersistentObjectCache> cache;
+  auto status = Make(directory, capacity, &cache);
+  if (!status.ok()) {
+    // The cache only saves compilation time, don't fail the evaluation for it
+    ARROW_LOG(WARNING) << "Disabling the Gandiva object cache: " << status.ToString();
+    cache.reset();
+  }
+  // Remember failures as well, so that they are only logged once
+  caches[directory] = cache;
+  return cache.get();
+}
+
+std::string PersistentObjectCache::MakeKey(const std::string& description) {
+  // Two independent 64-bit hashes make collisions between cached modules
+  // vanishingly unlikely
+  uint64_t hashes[2] = {
+      arrow::internal::ComputeStringHash<0>(description.data(),
+                                            static_cast<int64_t>(description.size())),
+      arrow::internal::ComputeStringHash<1>(description.data(),
+                                            static_cast<int64_t>(description.size()))};
+  return arrow::HexEncode(reinterpret_cast<const uint8_t*>(hashes), sizeof(hashes));
+}
+
+std::string PersistentObjectCache::PathOf(const std::string& key) const {
+  return arrow::fs::internal::ConcatAbstractPath(directory_, key + kObjectExtension);
+}
+
+Status PersistentObjectCache::LoadIndex() {
+  arrow::fs::Selector selector;
+  selector.base_dir = directory_;
+  std::vector<arrow::fs::FileStats> stats;
+  ARROW_RETURN_NOT_OK(fs_->GetTargetStats(selector, &stats));
+
+  // Seed the recency order with the modification times
+  std::sort(stats.begin(), stats.end(),
+            [](const arrow::fs::FileStats& a, const arrow::fs::FileStats& b) {
+              return a.mtime() > b.mtime();
+            });
+  std::lock_guard<std::mutex> lock(mtx_);
+  const std::string extension = kObjectExtension;
+  for (const auto& stat : stats) {
+    const std::string name = stat.base_name();
+    if (stat.type() != arrow::fs::FileType::File || name.size() <= extension.size() ||
+        name.compare(name.size() - extension.size(), extension.size(), extension) != 0) {
+      continue;
+    }
+    const std::string key = name.substr(0, name.size() - extension.size());
+    lru_list_.emplace_back(key, stat.size());
+    entries_[key] = std::prev(lru_list_.end());
+    size_ += stat.size();
+  }
+  Evict();
+  return Status::OK();
+}
+
+int64_t PersistentObjectCache::size() const {
+  std::lock_guard<std::mutex> lock(mtx_);
+  return size_;
+}
+
+int64_t PersistentObjectCache::num_hits() const {
+  std::lock_guard<std::mutex> lock(mtx_);
+  return num_hits_;
+}
+
+std::shared_ptr<arrow::Buffer> PersistentObjectCache::Get(const std::string& key) {
+  // The object may have been stored by another process, so go to the file
+  // even if the key is unknown
+  std::shared_ptr<arrow::io::RandomAccessFile> file;
+  if (!fs_->OpenInputFile(PathOf(key), &file).ok()) {
+    return nullptr;
+  }
+  int64_t size;
+  std::shared_ptr<arrow::Buffer> object;
+  if (!file->GetSize(&size).ok() || !file->Read(size, &object).ok() ||
+      object->size() != size || size == 0) {
+    return nullptr;
+  }
+  // Objects are read in full, so the file can be closed before the buffer is used
+  ARROW_UNUSED(file->Close());
+
+  std::lock_guard<std::mutex> lock(mtx_);
+  Touch(key, size);
+  ++num_hits_;
+  return object;
+}
+
+Status PersistentObjectCache::Put(const std::string& key, const uint8_t* data,
+                                  int64_t size) {
+  if (size > capacity_) {
+    return Status::OK();
+  }
+
+  // Write to a temporary file and rename it, so that concurrent readers never
+  // see a partial object
+  std::random_device rd;
+  const std::string temp_path = PathOf(key) + "." + std::to_string(rd()) + kTempExtension;
+  std::shared_ptr<arrow::io::OutputStream> stream;
+  ARROW_RETURN_NOT_OK(fs_->OpenOutputStream(temp_path, &stream));
+  auto status = stream->Write(data, size);
+  if (status.ok()) {
+    status = stream->Close();
+  }
+  if (status.ok()) {
+    status = fs_->Move(temp_path, PathOf(key));
+  }
+  if (!status.ok()) {
+    ARROW_UNUSED(fs_->DeleteFile(temp_path));
+    return status;
+  }
+
+  std::lock_guard<std::mutex> lock(mtx_);
+  Touch(key, size);
+  Evict();
+  return Status::OK();
+}
+
+void PersistentObjectCache::Touch(const std::string& key, int64_t size) {
+  auto it = entries_.find(key);
+  if (it != entries_.end()) {
+    size_ -= it->second->second;
+    lru_list_.erase(it->second);
+  }
+  lru_list_.emplace_front(key, size);
+  entries_[key] = lru_list_.begin();
+  size_ += size;
+}
+
+void PersistentObjectCache::Evict() {
+  while (size_ > capacity_ && !lru_list_.empty()) {
+    const auto& oldest = lru_list_.back();
+    // Another process may have removed the file already
+    ARROW_UNUSED(fs_->DeleteFile(PathOf(oldest.first)));
+    size_ -= oldest.second;
+    entries_.erase(oldest.first);
+    lru_list_.pop_back();
+  }
+}
+
+}  // namespace gandiva
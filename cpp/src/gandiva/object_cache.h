@@ -0,0 +1,105 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "arrow/status.h"
+
+#include "gandiva/arrow.h"
+#include "gandiva/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+
+namespace fs {
+
+class LocalFileSystem;
+
+}  // namespace fs
+}  // namespace arrow
+
+namespace gandiva {
+
+/// \brief Persistent cache of the machine code compiled for LLVM modules.
+///
+/// Objects are stored as files in a local directory, so that other processes
+/// using the same directory can skip optimising and compiling a module that was
+/// already compiled. When the total size of the objects exceeds the capacity,
+/// the least recently used ones are removed.
+class GANDIVA_EXPORT PersistentObjectCache {
+ public:
+  static constexpr int64_t kDefaultCapacity = 256 * 1024 * 1024;
+
+  /// Create a cache in the given directory, which is created if it doesn't
+  /// exist. Objects already in the directory are reused.
+  static Status Make(const std::string& directory, int64_t capacity,
+                     std::shared_ptr<PersistentObjectCache>* out);
+
+  /// Return the process-wide cache configured by the GANDIVA_OBJECT_CACHE_DIR
+  /// and GANDIVA_OBJECT_CACHE_CAPACITY (in bytes) environment variables, or
+  /// nullptr if GANDIVA_OBJECT_CACHE_DIR is not set. The variables are read on
+  /// each call, there is one cache per directory.
+  static PersistentObjectCache* GetDefault();
+
+  /// Build a key, usable as a file name, from the description of a module.
+  static std::string MakeKey(const std::string& description);
+
+  /// Get the object stored for the key, or nullptr if there's none.
+  std::shared_ptr<arrow::Buffer> Get(const std::string& key);
+
+  /// Store the object for the key, evicting older objects if needed.
+  Status Put(const std::string& key, const uint8_t* data, int64_t size);
+
+  int64_t capacity() const { return capacity_; }
+
+  /// The total size of the objects known to this cache.
+  int64_t size() const;
+
+  /// The number of calls to Get() which found an object.
+  int64_t num_hits() const;
+
+ private:
+  PersistentObjectCache(std::string directory, int64_t capacity);
+
+  Status LoadIndex();
+  std::string PathOf(const std::string& key) const;
+  void Touch(const std::string& key, int64_t size);
+  void Evict();
+
+  const std::string directory_;
+  const int64_t capacity_;
+  std::shared_ptr<arrow::fs::LocalFileSystem> fs_;
+
+  mutable std::mutex mtx_;
+  // Keys with the most recently used first, along with the object sizes
+  std::list<std::pair<std::string, int64_t>> lru_list_;
+  std::unordered_map<std::string, std::list<std::pair<std::string, int64_t>>::iterator>
+      entries_;
+  int64_t size_;
+  int64_t num_hits_;
+};
+
+}  // namespace gandiva
@@ -0,0 +1,99 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/object_cache.h"
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+
+namespace gandiva {
+
+using arrow::internal::TemporaryDir;
+
+class TestObjectCache : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_OK(TemporaryDir::Make("gandiva-object-cache-", &temp_dir_));
+    directory_ = temp_dir_->path().ToString();
+  }
+
+  void Put(PersistentObjectCache* cache, const std::string& key,
+           const std::string& object) {
+    ASSERT_OK(cache->Put(key, reinterpret_cast<const uint8_t*>(object.data()),
+                         static_cast<int64_t>(object.size())));
+  }
+
+  std::unique_ptr<TemporaryDir> temp_dir_;
+  std::string directory_;
+};
+
+TEST_F(TestObjectCache, TestMakeKey) {
+  auto key = PersistentObjectCache::MakeKey("define i32 @expr_0_0()");
+  ASSERT_EQ(32, static_cast<int>(key.size()));
+  ASSERT_EQ(key, PersistentObjectCache::MakeKey("define i32 @expr_0_0()"));
+  ASSERT_NE(key, PersistentObjectCache::MakeKey("define i32 @expr_0_1()"));
+}
+
+TEST_F(TestObjectCache, TestPutGet) {
+  std::shared_ptr<PersistentObjectCache> cache;
+  ASSERT_OK(PersistentObjectCache::Make(directory_, 1024, &cache));
+
+  ASSERT_EQ(cache->Get("a"), nullptr);
+  Put(cache.get(), "a", "object a");
+  auto object = cache->Get("a");
+  ASSERT_NE(object, nullptr);
+  ASSERT_EQ(object->ToString(), "object a");
+  ASSERT_EQ(cache->size(), 8);
+  ASSERT_EQ(cache->num_hits(), 1);
+
+  // Objects persist across instances
+  std::shared_ptr<PersistentObjectCache> other;
+  ASSERT_OK(PersistentObjectCache::Make(directory_, 1024, &other));
+  ASSERT_EQ(other->size(), 8);
+  object = other->Get("a");
+  ASSERT_NE(object, nullptr);
+  ASSERT_EQ(object->ToString(), "object a");
+}
+
+TEST_F(TestObjectCache, TestEvictBySize) {
+  std::shared_ptr<PersistentObjectCache> cache;
+  ASSERT_OK(PersistentObjectCache::Make(directory_, 20, &cache));
+
+  Put(cache.get(), "a", std::string(8, 'a'));
+  Put(cache.get(), "b", std::string(8, 'b'));
+  ASSERT_NE(cache->Get("a"), nullptr);
+  Put(cache.get(), "c", std::string(8, 'c'));
+
+  // b is the least recently used
+  ASSERT_EQ(cache->size(), 16);
+  ASSERT_NE(cache->Get("a"), nullptr);
+  ASSERT_EQ(cache->Get("b"), nullptr);
+  ASSERT_NE(cache->Get("c"), nullptr);
+
+  // Objects larger than the capacity are not stored
+  Put(cache.get(), "d", std::string(32, 'd'));
+  ASSERT_EQ(cache->Get("d"), nullptr);
+  ASSERT_EQ(cache->size(), 16);
+}
+
+}  // namespace gandiva
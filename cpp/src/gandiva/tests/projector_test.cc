@@ -16,11 +16,15 @@
 // under the License.
 
 #include <cmath>
+#include <unordered_set>
 
 #include <gtest/gtest.h>
 
 #include "arrow/memory_pool.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/key_value_metadata.h"
 
+#include "gandiva/object_cache.h"
 #include "gandiva/projector.h"
 #include "gandiva/tests/test_util.h"
 #include "gandiva/tree_expr_builder.h"
@@ -116,6 +120,58 @@ TEST_F(TestProjector, TestProjectCacheFieldNames) {
   EXPECT_TRUE(projector_01.get() != projector_12.get());
 }
 
+TEST_F(TestProjector, TestPersistentObjectCache) {
+  std::unique_ptr<arrow::internal::TemporaryDir> temp_dir;
+  ASSERT_OK(arrow::internal::TemporaryDir::Make("gandiva-projector-cache-", &temp_dir));
+  ASSERT_OK(arrow::internal::SetEnvVar("GANDIVA_OBJECT_CACHE_DIR",
+                                       temp_dir->path().ToString()));
+  PersistentObjectCache* cache = PersistentObjectCache::GetDefault();
+  ASSERT_NE(cache, nullptr);
+
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  // The schemas only differ by their metadata, so that the second projector
+  // isn't found in the in-memory cache but compiles to the same module
+  auto schema0 = arrow::schema({field0, field1}, arrow::key_value_metadata({"k"}, {"0"}));
+  auto schema1 = arrow::schema({field0, field1}, arrow::key_value_metadata({"k"}, {"1"}));
+
+  // The IN expression has a holder, which is bound by address in each process
+  auto sum_expr =
+      TreeExprBuilder::MakeExpression("add", {field0, field1}, field("sum", int32()));
+  auto sum_func = TreeExprBuilder::MakeFunction(
+      "add", {TreeExprBuilder::MakeField(field0), TreeExprBuilder::MakeField(field1)},
+      int32());
+  auto in_expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeInExpressionInt32(sum_func, {6, 11}),
+      field("in", boolean()));
+
+  std::shared_ptr<Projector> projector0;
+  ASSERT_OK(
+      Projector::Make(schema0, {sum_expr, in_expr}, TestConfiguration(), &projector0));
+  const int64_t num_hits = cache->num_hits();
+  ASSERT_GT(cache->size(), 0);
+
+  std::shared_ptr<Projector> projector1;
+  ASSERT_OK(
+      Projector::Make(schema1, {sum_expr, in_expr}, TestConfiguration(), &projector1));
+  ASSERT_NE(projector0, projector1);
+  ASSERT_EQ(cache->num_hits(), num_hits + 1);
+
+  int num_records = 4;
+  auto array0 = MakeArrowArrayInt32({1, 2, 3, 4}, {true, true, true, true});
+  auto array1 = MakeArrowArrayInt32({5, 9, 6, 17}, {true, true, true, true});
+  auto exp_sum = MakeArrowArrayInt32({6, 11, 9, 21}, {true, true, true, true});
+  auto exp_in = MakeArrowArrayBool({true, true, false, false}, {true, true, true, true});
+  auto in_batch = arrow::RecordBatch::Make(schema1, num_records, {array0, array1});
+
+  arrow::ArrayVector outputs;
+  ASSERT_OK(projector1->Evaluate(*in_batch, pool_, &outputs));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_in, outputs.at(1));
+
+  ASSERT_OK(arrow::internal::DelEnvVar("GANDIVA_OBJECT_CACHE_DIR"));
+}
+
 TEST_F(TestProjector, TestProjectCacheDouble) {
   auto schema = arrow::schema({});
   auto res = field("result", arrow::float64());
@@ -194,6 +194,13 @@ JNIEXPORT jboolean JNICALL Java_org_apache_arrow_adapter_orc_OrcReaderJniWrapper
   return reader->Seek(row_number).ok();
 }
 
+JNIEXPORT jboolean JNICALL
+Java_org_apache_arrow_adapter_orc_OrcReaderJniWrapper_setStripePrefetch(
+    JNIEnv* env, jobject this_obj, jlong id, jint depth, jlong memory_limit) {
+  auto reader = GetFileReader(env, id);
+  return reader->SetStripePrefetch(depth, memory_limit).ok();
+}
+
 JNIEXPORT jint JNICALL
 Java_org_apache_arrow_adapter_orc_OrcReaderJniWrapper_getNumberOfStripes(JNIEnv* env,
                                                                          jobject this_obj,
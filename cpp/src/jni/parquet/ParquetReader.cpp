@@ -69,8 +69,8 @@ ParquetReader::ParquetReader(
     exit(-1);
   }
 
-  std::vector<int> row_group_indices =
-    getRowGroupIndices(arrow_reader->num_row_groups(), start_pos, end_pos);
+  std::vector<int> row_group_indices = getRowGroupIndices(
+    *arrow_reader->parquet_reader()->metadata(), start_pos, end_pos);
   msg = getRecordBatch(row_group_indices, column_indices);
   if (!msg.ok()) {
     std::cerr << "GetRecordBatch failed, error msg: " << msg << std::endl;
@@ -83,25 +83,38 @@ ParquetReader::~ParquetReader(){
   delete connector;
 }
 
+// Select the row groups of the split [start_pos, end_pos) of the file. Like
+// parquet-mr, a row group belongs to the split containing the midpoint of its
+// byte range, so that splits tiling the file read every row group exactly
+// once. A split may select any number of row groups, including none.
 std::vector<int> ParquetReader::getRowGroupIndices(
-    int num_row_groups, long start_pos, long end_pos) {
-  std::unique_ptr<::parquet::ParquetFileReader> reader =
-    ::parquet::ParquetFileReader::Open(connector->getReader());
+    const ::parquet::FileMetaData& metadata, long start_pos, long end_pos) {
   std::vector<int> row_group_indices;
-  long pos = 0;
-  for (int i = 0; i < num_row_groups; i++) {
-    if (pos >= start_pos && pos < end_pos) {
+  for (int i = 0; i < metadata.num_row_groups(); i++) {
+    std::unique_ptr<::parquet::RowGroupMetaData> row_group = metadata.RowGroup(i);
+    if (row_group->num_columns() == 0) {
+      continue;
+    }
+    // The row group starts with the dictionary page of its first column, if any
+    std::unique_ptr<::parquet::ColumnChunkMetaData> first_column =
+      row_group->ColumnChunk(0);
+    int64_t start = first_column->data_page_offset();
+    if (first_column->has_dictionary_page() &&
+        first_column->dictionary_page_offset() > 0 &&
+        first_column->dictionary_page_offset() < start) {
+      start = first_column->dictionary_page_offset();
+    }
+    int64_t size = 0;
+    for (int j = 0; j < row_group->num_columns(); j++) {
+      size += row_group->ColumnChunk(j)->total_compressed_size();
+    }
+    int64_t midpoint = start + size / 2;
+    if (midpoint >= start_pos && midpoint < end_pos) {
       row_group_indices.push_back(i);
-      //std::cerr << "pos: " << pos << " ,range: " << start_pos << "-" << end_pos << ", find row group index: " << i << std::endl;
-      break;
     }
-    pos += reader->RowGroup(i)->metadata()->total_byte_size();
-  }
-  if (row_group_indices.empty()) {
-    row_group_indices.push_back(num_row_groups - 1);
   }
   return row_group_indices;
-} 
+}
 
 Status ParquetReader::getRecordBatch(
     std::vector<int>& row_group_indices,
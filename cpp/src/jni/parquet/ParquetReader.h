@@ -41,7 +41,8 @@ private:
   ::parquet::ArrowReaderProperties properties;
   std::shared_ptr<RecordBatchReader> rb_reader;
 
-  std::vector<int> getRowGroupIndices(int num_row_groups, long start_pos, long end_pos);
+  std::vector<int> getRowGroupIndices(
+      const ::parquet::FileMetaData& metadata, long start_pos, long end_pos);
   Status getRecordBatch(std::vector<int>& row_group_indices, std::vector<int>& column_indices);
 };
 }
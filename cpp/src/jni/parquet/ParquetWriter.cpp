@@ -10,11 +10,57 @@ namespace parquet {
 using namespace ::arrow;
 using namespace ::arrow::io;
 
+namespace {
+
+int64_t bufferedSize(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer) {
+      size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += bufferedSize(*child);
+  }
+  return size;
+}
+
+int64_t bufferedSize(const RecordBatch& rb) {
+  int64_t size = 0;
+  for (int i = 0; i < rb.num_columns(); i++) {
+    size += bufferedSize(*rb.column_data(i));
+  }
+  return size;
+}
+
+Status copyArrayData(const ArrayData& in, MemoryPool* pool,
+                     std::shared_ptr<ArrayData>* out) {
+  auto copy = in.Copy();
+  for (auto& buffer : copy->buffers) {
+    if (buffer) {
+      std::shared_ptr<Buffer> owned;
+      RETURN_NOT_OK(buffer->Copy(0, buffer->size(), pool, &owned));
+      buffer = owned;
+    }
+  }
+  for (auto& child : copy->child_data) {
+    RETURN_NOT_OK(copyArrayData(*child, pool, &child));
+  }
+  *out = copy;
+  return Status::OK();
+}
+
+}  // namespace
+
 ParquetWriter::ParquetWriter(
     std::string path,
-    std::shared_ptr<Schema>& schema):
+    std::shared_ptr<Schema>& schema,
+    int64_t max_row_group_rows,
+    int64_t max_row_group_bytes):
   pool(default_memory_pool()),
-  schema(schema) {
+  schema(schema),
+  max_row_group_rows(max_row_group_rows),
+  max_row_group_bytes(max_row_group_bytes) {
   if (path.find("hdfs") != std::string::npos) {
     connector = new HdfsConnector(path);
   } else {
@@ -38,11 +84,14 @@ ParquetWriter::ParquetWriter(
         schema_description->schema_root()->repetition(),
         group_node_fields));
 
+  // Columns of a row group are encoded in parallel
+  auto arrow_properties =
+      ::parquet::ArrowWriterProperties::Builder().set_use_threads(true)->build();
   msg = ::parquet::arrow::FileWriter::Make(
       pool,
       ::parquet::ParquetFileWriter::Open(connector->getWriter(), parquet_schema),
       schema,
-      ::parquet::default_arrow_writer_properties(),
+      arrow_properties,
       &arrow_writer);
   if (!msg.ok()) {
     std::cerr << "Open parquet file failed, error msg: " << msg << std::endl;
@@ -67,13 +116,44 @@ Status ParquetWriter::writeNext(int num_rows, long* in_buf_addrs, long* in_buf_s
     return msg;
   }
 
-  std::lock_guard<std::mutex> lck (threadMtx);
-  record_batch_buffer_list.push_back(batch);
+  // The batch wraps Java memory which may be released once this call returns
+  std::shared_ptr<RecordBatch> owned_batch;
+  msg = copyRecordBatch(batch, &owned_batch);
+  if (!msg.ok()) {
+    return msg;
+  }
 
-  return msg;
+  std::lock_guard<std::mutex> lck (threadMtx);
+  return appendBatch(owned_batch);
 }
 
 Status ParquetWriter::flush() {
+  std::lock_guard<std::mutex> lck (threadMtx);
+  return writeRowGroup();
+}
+
+Status ParquetWriter::writeNext(std::shared_ptr<RecordBatch>& rb) {
+  std::lock_guard<std::mutex> lck (threadMtx);
+  return appendBatch(rb);
+}
+
+Status ParquetWriter::appendBatch(std::shared_ptr<RecordBatch> rb) {
+  buffered_rows += rb->num_rows();
+  buffered_bytes += bufferedSize(*rb);
+  record_batch_buffer_list.push_back(std::move(rb));
+  if (buffered_rows >= max_row_group_rows || buffered_bytes >= max_row_group_bytes) {
+    return writeRowGroup();
+  }
+  return Status::OK();
+}
+
+// Writes the buffered batches as one row group and releases them, so that
+// memory use is bounded by the row group size rather than the file size.
+Status ParquetWriter::writeRowGroup() {
+  if (record_batch_buffer_list.empty()) {
+    return connector->getWriter()->Flush();
+  }
+
   std::shared_ptr<Table> table;
   Status msg = Table::FromRecordBatches(record_batch_buffer_list, &table);
   if (!msg.ok()) {
@@ -86,14 +166,24 @@ Status ParquetWriter::flush() {
     std::cerr << "arrow_writer->WriteTable failed" << std::endl;
     return msg;
   }
+  record_batch_buffer_list.clear();
+  buffered_rows = 0;
+  buffered_bytes = 0;
 
   msg = connector->getWriter()->Flush();
   return msg;
 }
 
-Status ParquetWriter::writeNext(std::shared_ptr<RecordBatch>& rb) {
-  std::lock_guard<std::mutex> lck (threadMtx);
-  record_batch_buffer_list.push_back(rb);
+Status ParquetWriter::copyRecordBatch(
+    const std::shared_ptr<RecordBatch>& in,
+    std::shared_ptr<RecordBatch>* out) {
+  std::vector<std::shared_ptr<ArrayData>> arrays;
+  for (int i = 0; i < in->num_columns(); i++) {
+    std::shared_ptr<ArrayData> array_data;
+    RETURN_NOT_OK(copyArrayData(*in->column_data(i), pool, &array_data));
+    arrays.push_back(array_data);
+  }
+  *out = RecordBatch::Make(in->schema(), in->num_rows(), arrays);
   return Status::OK();
 }
 
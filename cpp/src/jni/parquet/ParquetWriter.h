@@ -16,11 +16,17 @@ namespace parquet {
 using namespace ::arrow;
 using namespace ::arrow::io;
 
+// Buffered batches are written out as a row group once either limit is reached
+constexpr int64_t kDefaultMaxRowGroupRows = 1024 * 1024;
+constexpr int64_t kDefaultMaxRowGroupBytes = 128 * 1024 * 1024;
+
 class ParquetWriter {
 public:
   ParquetWriter(
       std::string path,
-      std::shared_ptr<Schema>& schema);
+      std::shared_ptr<Schema>& schema,
+      int64_t max_row_group_rows = kDefaultMaxRowGroupRows,
+      int64_t max_row_group_bytes = kDefaultMaxRowGroupBytes);
   ~ParquetWriter();
   Status writeNext(int num_rows, long* in_buf_addrs, long* in_buf_sizes, int in_bufs_len);
   Status writeNext(std::shared_ptr<RecordBatch>& rb);
@@ -34,6 +40,16 @@ private:
   std::shared_ptr<Schema> schema;
   std::shared_ptr<::parquet::SchemaDescriptor> schema_description;
   std::vector<std::shared_ptr<RecordBatch>> record_batch_buffer_list;
+  int64_t max_row_group_rows;
+  int64_t max_row_group_bytes;
+  int64_t buffered_rows = 0;
+  int64_t buffered_bytes = 0;
+
+  Status appendBatch(std::shared_ptr<RecordBatch> rb);
+  Status writeRowGroup();
+  Status copyRecordBatch(
+      const std::shared_ptr<RecordBatch>& in,
+      std::shared_ptr<RecordBatch>* out);
 
   Status makeRecordBatch(
       std::shared_ptr<Schema> &schema,
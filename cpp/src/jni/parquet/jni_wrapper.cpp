@@ -246,7 +246,8 @@ JNIEXPORT void JNICALL Java_org_apache_arrow_adapter_parquet_AdaptorReferenceMan
 }
 
 JNIEXPORT jlong JNICALL Java_org_apache_arrow_adapter_parquet_ParquetWriterJniWrapper_nativeOpenParquetWriter
-  (JNIEnv *env, jobject obj, jstring path, jbyteArray schemaBytes) {
+  (JNIEnv *env, jobject obj, jstring path, jbyteArray schemaBytes,
+   jlong maxRowGroupRows, jlong maxRowGroupBytes) {
 
   int schemaBytes_len = env->GetArrayLength(schemaBytes);
   jbyte* schemaBytes_data = env->GetByteArrayElements(schemaBytes, 0);
@@ -264,7 +265,8 @@ JNIEXPORT jlong JNICALL Java_org_apache_arrow_adapter_parquet_ParquetWriterJniWr
   }
 
   std::string cpath = JStringToCString(env, path);
-  jni::parquet::ParquetWriter* writer = new jni::parquet::ParquetWriter(cpath, schema);
+  jni::parquet::ParquetWriter* writer = new jni::parquet::ParquetWriter(
+      cpath, schema, maxRowGroupRows, maxRowGroupBytes);
 
   env->ReleaseByteArrayElements(schemaBytes, schemaBytes_data, JNI_ABORT);
   return (long)writer;
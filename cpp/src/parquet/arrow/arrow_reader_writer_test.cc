@@ -26,6 +26,7 @@
 #include <arrow/compute/api.h>
 #include <cstdint>
 #include <functional>
+#include <numeric>
 #include <sstream>
 #include <vector>
 
@@ -1967,6 +1968,255 @@ TEST(TestArrowReadWrite, GetRecordBatchReader) {
   ASSERT_EQ(nullptr, actual_batch);
 }
 
+TEST(TestArrowReadWrite, PreBuffer) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 4,
+                                             default_arrow_writer_properties(), &buffer));
+
+  std::unique_ptr<FileReader> plain_reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &plain_reader));
+  std::shared_ptr<Table> expected;
+  ASSERT_OK_NO_THROW(plain_reader->ReadRowGroups({1, 3}, {2, 5}, &expected));
+
+  for (bool use_threads : {false, true}) {
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    properties.set_use_threads(use_threads);
+    properties.set_pre_buffer(true);
+    // Small enough to split the file into several coalesced reads
+    ::arrow::io::CacheOptions cache_options;
+    cache_options.range_size_limit = 4096;
+    properties.set_cache_options(cache_options);
+
+    std::unique_ptr<FileReader> reader;
+    FileReaderBuilder builder;
+    ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+    ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result, false));
+
+    // A subset of the row groups and columns
+    ASSERT_OK_NO_THROW(reader->ReadRowGroups({1, 3}, {2, 5}, &result));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*expected, *result, false));
+
+    std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+    ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1, 2, 3}, &rb_reader));
+    ASSERT_OK(rb_reader->ReadAll(&result));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result, false));
+  }
+}
+
+TEST(TestArrowReadWrite, WriteTableUseThreads) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  auto arrow_properties = ArrowWriterProperties::Builder().set_use_threads(true)->build();
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(
+      WriteTableToBuffer(table, num_rows / 4, arrow_properties, &buffer));
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+  ASSERT_EQ(4, reader->num_row_groups());
+
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result, false));
+}
+
+TEST(TestArrowReadWrite, GetRecordBatchReaderUseThreads) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+  const int batch_size = 150;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 4,
+                                             default_arrow_writer_properties(), &buffer));
+
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_batch_size(batch_size);
+  properties.set_use_threads(true);
+
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+  // Batches span row group boundaries and the last one is short
+  std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+  ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1, 2, 3}, &rb_reader));
+  std::shared_ptr<::arrow::RecordBatch> actual_batch, expected_batch;
+  ::arrow::TableBatchReader table_reader(*table);
+  table_reader.set_chunksize(batch_size);
+
+  for (int i = 0; i < 7; ++i) {
+    ASSERT_OK(rb_reader->ReadNext(&actual_batch));
+    ASSERT_OK(table_reader.ReadNext(&expected_batch));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertBatchesEqual(*expected_batch, *actual_batch));
+  }
+
+  ASSERT_OK(rb_reader->ReadNext(&actual_batch));
+  ASSERT_EQ(nullptr, actual_batch);
+  ASSERT_OK(rb_reader->ReadNext(&actual_batch));
+  ASSERT_EQ(nullptr, actual_batch);
+
+  // Dropping the reader while a batch is being prefetched
+  ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1}, {0, 3, 5}, &rb_reader));
+  ASSERT_OK(rb_reader->ReadNext(&actual_batch));
+  ASSERT_EQ(3, actual_batch->num_columns());
+  ASSERT_EQ(batch_size, actual_batch->num_rows());
+  rb_reader.reset();
+}
+
+TEST(TestArrowReadWrite, PagePredicatePushdown) {
+  const int num_rows = 1000;
+  std::vector<int64_t> a_values(num_rows);
+  std::vector<int32_t> b_values(num_rows);
+  std::iota(a_values.begin(), a_values.end(), 0);
+  std::iota(b_values.begin(), b_values.end(), 0);
+  std::shared_ptr<Array> a, b;
+  ::arrow::ArrayFromVector<::arrow::Int64Type, int64_t>(a_values, &a);
+  ::arrow::ArrayFromVector<::arrow::Int32Type, int32_t>(b_values, &b);
+  auto schema = ::arrow::schema({::arrow::field("a", ::arrow::int64(), false),
+                                 ::arrow::field("b", ::arrow::int32(), false)});
+  auto table = Table::Make(schema, {a, b});
+
+  // Pages of 100 rows for "a" and of 200 rows for "b"
+  auto write_props = WriterProperties::Builder()
+                         .write_batch_size(100)
+                         ->data_pagesize(800)
+                         ->disable_dictionary()
+                         ->enable_page_index()
+                         ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink, num_rows,
+                                write_props, default_arrow_writer_properties()));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK_NO_THROW(sink->Finish(&buffer));
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+  auto row_group = reader->parquet_reader()->RowGroup(0);
+  ASSERT_EQ(10, row_group->GetOffsetIndex(0)->num_pages());
+  ASSERT_EQ(5, row_group->GetOffsetIndex(1)->num_pages());
+  auto column_index = row_group->GetColumnIndex(0);
+  ASSERT_EQ(10, column_index->num_pages());
+  ASSERT_FALSE(column_index->is_null_page(0));
+
+  const ColumnDescriptor* descr =
+      reader->parquet_reader()->metadata()->schema()->Column(0);
+  auto encode = [](int64_t value) {
+    return std::string(reinterpret_cast<const char*>(&value), sizeof(value));
+  };
+
+  // [250, 260] lies in the third page of "a", which is widened to the second
+  // page of "b" so that both columns yield the same rows
+  std::string lower = encode(250), upper = encode(260);
+  reader->set_page_predicates({MakeRangePagePredicate(descr, 0, &lower, &upper)});
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table->Slice(200, 200), *result,
+                                                     /*same_chunk_layout=*/false));
+
+  std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+  ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0}, {1}, &rb_reader));
+  std::shared_ptr<::arrow::RecordBatch> batch;
+  ASSERT_OK(rb_reader->ReadNext(&batch));
+  ASSERT_EQ(200, batch->num_rows());
+  ASSERT_OK(rb_reader->ReadNext(&batch));
+  ASSERT_EQ(nullptr, batch);
+
+  // Open-ended range with no match
+  lower = encode(num_rows);
+  reader->set_page_predicates({MakeRangePagePredicate(descr, 0, &lower, nullptr)});
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_EQ(0, result->num_rows());
+
+  reader->set_page_predicates({});
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_EQ(num_rows, result->num_rows());
+}
+
+TEST(TestArrowReadWrite, BloomFilter) {
+  const int num_rows = 1000;
+  std::vector<int64_t> a_values(num_rows);
+  std::vector<std::string> b_values(num_rows);
+  std::vector<bool> b_is_valid(num_rows);
+  for (int i = 0; i < num_rows; ++i) {
+    a_values[i] = i * 7;
+    b_values[i] = "id-" + std::to_string(i);
+    b_is_valid[i] = i % 10 != 0;
+  }
+  std::shared_ptr<Array> a, b, c;
+  ::arrow::ArrayFromVector<::arrow::Int64Type, int64_t>(a_values, &a);
+  ::arrow::ArrayFromVector<::arrow::StringType, std::string>(b_is_valid, b_values, &b);
+  ::arrow::ArrayFromVector<::arrow::Int64Type, int64_t>(a_values, &c);
+  auto schema = ::arrow::schema({::arrow::field("a", ::arrow::int64(), false),
+                                 ::arrow::field("b", ::arrow::utf8()),
+                                 ::arrow::field("c", ::arrow::int64(), false)});
+  auto table = Table::Make(schema, {a, b, c});
+
+  auto write_props = WriterProperties::Builder()
+                         .enable_bloom_filter("a", num_rows)
+                         ->enable_bloom_filter("b", num_rows)
+                         ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink, num_rows,
+                                write_props, default_arrow_writer_properties()));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK_NO_THROW(sink->Finish(&buffer));
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+  auto row_group = reader->parquet_reader()->RowGroup(0);
+  ASSERT_TRUE(row_group->metadata()->ColumnChunk(0)->has_bloom_filter());
+  ASSERT_FALSE(row_group->metadata()->ColumnChunk(2)->has_bloom_filter());
+  ASSERT_EQ(nullptr, row_group->GetBloomFilter(2));
+
+  auto a_filter = row_group->GetBloomFilter(0);
+  auto b_filter = row_group->GetBloomFilter(1);
+  ASSERT_NE(nullptr, a_filter);
+  ASSERT_NE(nullptr, b_filter);
+  int a_false_positives = 0;
+  int b_false_positives = 0;
+  for (int i = 0; i < num_rows; ++i) {
+    ASSERT_TRUE(a_filter->FindHash(a_filter->Hash(a_values[i])));
+    a_false_positives += a_filter->FindHash(a_filter->Hash(a_values[i] + 1));
+
+    if (b_is_valid[i]) {
+      ByteArray value(b_values[i]);
+      ASSERT_TRUE(b_filter->FindHash(b_filter->Hash(&value)));
+    }
+    std::string absent = "absent-" + std::to_string(i);
+    ByteArray absent_value(absent);
+    b_false_positives += b_filter->FindHash(b_filter->Hash(&absent_value));
+  }
+  ASSERT_LT(a_false_positives, num_rows / 10);
+  ASSERT_LT(b_false_positives, num_rows / 10);
+
+  // The data of the column chunks is unaffected
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result));
+}
+
 TEST(TestArrowReadWrite, ScanContents) {
   const int num_columns = 20;
   const int num_rows = 1000;
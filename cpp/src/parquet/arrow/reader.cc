@@ -36,6 +36,7 @@
 #include "parquet/exception.h"
 #include "parquet/file_reader.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
 
@@ -102,9 +103,11 @@ class FileReaderImpl : public FileReader {
                                reader_properties_, &manifest_);
   }
 
-  FileColumnIteratorFactory SomeRowGroupsFactory(std::vector<int> row_groups) {
-    return [row_groups](int i, ParquetFileReader* reader) {
-      return new FileColumnIterator(i, reader, row_groups);
+  FileColumnIteratorFactory SomeRowGroupsFactory(
+      std::vector<int> row_groups,
+      std::shared_ptr<const PageSelection> page_selection = nullptr) {
+    return [row_groups, page_selection](int i, ParquetFileReader* reader) {
+      return new FileColumnIterator(i, reader, row_groups, page_selection);
     };
   }
 
@@ -132,6 +135,40 @@ class FileReaderImpl : public FileReader {
     return Status::OK();
   }
 
+  // With page predicates set, select the rows to read in each row group from
+  // the page index, aligned on the pages of the leaf columns in indices. Row
+  // groups where no row can match are removed from row_groups. Returns nullptr
+  // when all rows are to be read. Can throw exception
+  std::shared_ptr<const PageSelection> SelectPages(const std::vector<int>& indices,
+                                                   std::vector<int>* row_groups) {
+    if (page_predicates_.empty()) {
+      return nullptr;
+    }
+    auto selection = std::make_shared<PageSelection>();
+    std::vector<int> selected_row_groups;
+    for (int row_group : *row_groups) {
+      auto row_group_reader = reader_->RowGroup(row_group);
+      RowRanges row_ranges =
+          ComputeRowRanges(row_group_reader.get(), page_predicates_, indices);
+      if (row_ranges.empty()) {
+        continue;
+      }
+      selected_row_groups.push_back(row_group);
+      (*selection)[row_group] = std::move(row_ranges);
+    }
+    *row_groups = std::move(selected_row_groups);
+    return selection;
+  }
+
+  // If enabled, start reading the column chunks about to be decoded in the
+  // background. Can throw exception
+  void MaybePreBuffer(const std::vector<int>& row_groups,
+                      const std::vector<int>& indices) {
+    if (reader_properties_.pre_buffer() && !row_groups.empty()) {
+      reader_->PreBuffer(row_groups, indices, reader_properties_.cache_options());
+    }
+  }
+
   int64_t GetTotalRecords(const std::vector<int>& row_groups, int column_chunk = 0) {
     // Can throw exception
     int64_t records = 0;
@@ -153,11 +190,12 @@ class FileReaderImpl : public FileReader {
 
   Status GetFieldReader(int i, const std::vector<int>& indices,
                         const std::vector<int>& row_groups,
-                        std::unique_ptr<ColumnReaderImpl>* out) {
+                        std::unique_ptr<ColumnReaderImpl>* out,
+                        std::shared_ptr<const PageSelection> page_selection = nullptr) {
     ReaderContext ctx;
     ctx.reader = reader_.get();
     ctx.pool = pool_;
-    ctx.iterator_factory = SomeRowGroupsFactory(row_groups);
+    ctx.iterator_factory = SomeRowGroupsFactory(row_groups, std::move(page_selection));
     ctx.filter_leaves = true;
     ctx.included_leaves.insert(indices.begin(), indices.end());
     return manifest_.schema_fields[i].GetReader(ctx, out);
@@ -169,16 +207,24 @@ class FileReaderImpl : public FileReader {
   Status ReadSchemaField(int i, const std::vector<int>& indices,
                          const std::vector<int>& row_groups,
                          std::shared_ptr<Field>* out_field,
-                         std::shared_ptr<ChunkedArray>* out) {
+                         std::shared_ptr<ChunkedArray>* out,
+                         std::shared_ptr<const PageSelection> page_selection = nullptr) {
     BEGIN_PARQUET_CATCH_EXCEPTIONS
     std::unique_ptr<ColumnReaderImpl> reader;
-    RETURN_NOT_OK(GetFieldReader(i, indices, row_groups, &reader));
+    RETURN_NOT_OK(GetFieldReader(i, indices, row_groups, &reader, page_selection));
 
     *out_field = reader->field();
 
     // TODO(wesm): This calculation doesn't make much sense when we have repeated
     // schema nodes
-    int64_t records_to_read = GetTotalRecords(row_groups, i);
+    int64_t records_to_read = 0;
+    if (page_selection) {
+      for (int row_group : row_groups) {
+        records_to_read += page_selection->at(row_group).row_count();
+      }
+    } else {
+      records_to_read = GetTotalRecords(row_groups, i);
+    }
     return reader->NextBatch(records_to_read, out);
     END_PARQUET_CATCH_EXCEPTIONS
   }
@@ -265,6 +311,11 @@ class FileReaderImpl : public FileReader {
     reader_properties_.set_use_threads(use_threads);
   }
 
+  void set_page_predicates(
+      std::vector<std::shared_ptr<PagePredicate>> predicates) override {
+    page_predicates_ = std::move(predicates);
+  }
+
   Status ScanContents(std::vector<int> columns, const int32_t column_batch_size,
                       int64_t* num_rows) override {
     BEGIN_PARQUET_CATCH_EXCEPTIONS
@@ -276,19 +327,33 @@ class FileReaderImpl : public FileReader {
   MemoryPool* pool_;
   std::unique_ptr<ParquetFileReader> reader_;
   ArrowReaderProperties reader_properties_;
+  std::vector<std::shared_ptr<PagePredicate>> page_predicates_;
 
   SchemaManifest manifest_;
 };
 
+// Streams record batches out of a selection of row groups. When use_threads
+// is enabled, the columns of each batch are decoded concurrently on the CPU
+// thread pool and the columns of the following batch are requested as soon as
+// the current one is handed out, so decoding overlaps with consumption.
 class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
  public:
   RowGroupRecordBatchReader(std::vector<std::unique_ptr<ColumnReaderImpl>> field_readers,
-                            std::shared_ptr<::arrow::Schema> schema, int64_t batch_size)
+                            std::shared_ptr<::arrow::Schema> schema, int64_t batch_size,
+                            bool use_threads)
       : field_readers_(std::move(field_readers)),
         schema_(schema),
-        batch_size_(batch_size) {}
-
-  ~RowGroupRecordBatchReader() override {}
+        batch_size_(batch_size),
+        use_threads_(use_threads),
+        finished_(false),
+        prefetched_(field_readers_.size()) {}
+
+  ~RowGroupRecordBatchReader() override {
+    // Prefetch tasks reference the field readers, let them drain first
+    for (auto& fut : pending_) {
+      fut.wait();
+    }
+  }
 
   std::shared_ptr<::arrow::Schema> schema() const override { return schema_; }
 
@@ -300,41 +365,115 @@ class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
     if (!reader->manifest_.GetFieldIndices(column_indices, &field_indices)) {
       return Status::Invalid("Invalid column index");
     }
+    std::vector<int> selected_row_groups = row_groups;
+    std::shared_ptr<const PageSelection> page_selection;
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    page_selection = reader->SelectPages(column_indices, &selected_row_groups);
+    reader->MaybePreBuffer(selected_row_groups, column_indices);
+    END_PARQUET_CATCH_EXCEPTIONS
+
     std::vector<std::unique_ptr<ColumnReaderImpl>> field_readers(field_indices.size());
     std::vector<std::shared_ptr<Field>> fields;
     for (size_t i = 0; i < field_indices.size(); ++i) {
-      RETURN_NOT_OK(reader->GetFieldReader(field_indices[i], column_indices, row_groups,
-                                           &field_readers[i]));
+      RETURN_NOT_OK(reader->GetFieldReader(field_indices[i], column_indices,
+                                           selected_row_groups, &field_readers[i],
+                                           page_selection));
       fields.push_back(field_readers[i]->field());
     }
-    out->reset(new RowGroupRecordBatchReader(std::move(field_readers),
-                                             ::arrow::schema(fields), batch_size));
+    out->reset(new RowGroupRecordBatchReader(
+        std::move(field_readers), ::arrow::schema(fields), batch_size,
+        reader->reader_properties_.use_threads()));
     return Status::OK();
   }
 
   Status ReadNext(std::shared_ptr<::arrow::RecordBatch>* out) override {
-    // TODO (hatemhelal): Consider refactoring this to share logic with ReadTable as this
-    // does not currently honor the use_threads option.
+    if (finished_) {
+      *out = nullptr;
+      return Status::OK();
+    }
+
     std::vector<std::shared_ptr<ChunkedArray>> columns(field_readers_.size());
+    if (use_threads_) {
+      if (pending_.empty()) {
+        SubmitNextBatch();
+      }
+      RETURN_NOT_OK(WaitForPending());
+      columns.swap(prefetched_);
+      prefetched_.resize(field_readers_.size());
+    } else {
+      for (size_t i = 0; i < field_readers_.size(); ++i) {
+        RETURN_NOT_OK(field_readers_[i]->NextBatch(batch_size_, &columns[i]));
+      }
+    }
+
+    RETURN_NOT_OK(AssembleBatch(columns, out));
+    if (*out == nullptr) {
+      finished_ = true;
+    } else if (use_threads_) {
+      SubmitNextBatch();
+    }
+    return Status::OK();
+  }
+
+ private:
+  // Each task only touches its own field reader and output slot, and a field
+  // reader never has more than one task in flight
+  void SubmitNextBatch() {
+    auto pool = ::arrow::internal::GetCpuThreadPool();
     for (size_t i = 0; i < field_readers_.size(); ++i) {
-      RETURN_NOT_OK(field_readers_[i]->NextBatch(batch_size_, &columns[i]));
+      pending_.push_back(pool->Submit([this, i]() {
+        return field_readers_[i]->NextBatch(batch_size_, &prefetched_[i]);
+      }));
+    }
+  }
+
+  Status WaitForPending() {
+    Status final_status = Status::OK();
+    for (auto& fut : pending_) {
+      Status st = fut.get();
+      if (!st.ok()) {
+        final_status = std::move(st);
+      }
+    }
+    pending_.clear();
+    return final_status;
+  }
+
+  // Wrap the decoded columns into a RecordBatch without going through an
+  // intermediate Table. Sets *out to nullptr when the columns are exhausted.
+  Status AssembleBatch(const std::vector<std::shared_ptr<ChunkedArray>>& columns,
+                       std::shared_ptr<::arrow::RecordBatch>* out) {
+    std::vector<std::shared_ptr<Array>> arrays(columns.size());
+    int64_t num_rows = columns.empty() ? 0 : columns[0]->length();
+    for (size_t i = 0; i < columns.size(); ++i) {
       if (columns[i]->num_chunks() > 1) {
         return Status::NotImplemented("This class cannot yet iterate chunked arrays");
       }
+      if (columns[i]->length() != num_rows) {
+        return Status::Invalid("Column ", i, " yielded ", columns[i]->length(),
+                               " values, expected ", num_rows);
+      }
+      if (columns[i]->num_chunks() == 1) {
+        arrays[i] = columns[i]->chunk(0);
+      }
     }
-
-    // Create an intermediate table and use TableBatchReader as an adaptor to a
-    // RecordBatch
-    std::shared_ptr<Table> table = Table::Make(schema_, columns);
-    RETURN_NOT_OK(table->Validate());
-    ::arrow::TableBatchReader table_batch_reader(*table);
-    return table_batch_reader.ReadNext(out);
+    if (num_rows == 0) {
+      *out = nullptr;
+      return Status::OK();
+    }
+    *out = ::arrow::RecordBatch::Make(schema_, num_rows, std::move(arrays));
+    return (*out)->Validate();
   }
 
- private:
   std::vector<std::unique_ptr<ColumnReaderImpl>> field_readers_;
   std::shared_ptr<::arrow::Schema> schema_;
   int64_t batch_size_;
+  bool use_threads_;
+  bool finished_;
+
+  // Columns of the batch being decoded in the background
+  std::vector<std::shared_ptr<ChunkedArray>> prefetched_;
+  std::vector<std::future<Status>> pending_;
 };
 
 class ColumnChunkReaderImpl : public ColumnChunkReader {
@@ -774,13 +913,18 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
     return Status::Invalid("Invalid column index");
   }
 
+  std::vector<int> selected_row_groups = row_groups;
+  std::shared_ptr<const PageSelection> page_selection =
+      SelectPages(indices, &selected_row_groups);
+  MaybePreBuffer(selected_row_groups, indices);
+
   int num_fields = static_cast<int>(field_indices.size());
   std::vector<std::shared_ptr<Field>> fields(num_fields);
   std::vector<std::shared_ptr<ChunkedArray>> columns(num_fields);
 
   auto ReadColumnFunc = [&](int i) {
-    return ReadSchemaField(field_indices[i], indices, row_groups, &fields[i],
-                           &columns[i]);
+    return ReadSchemaField(field_indices[i], indices, selected_row_groups, &fields[i],
+                           &columns[i], page_selection);
   };
 
   if (reader_properties_.use_threads()) {
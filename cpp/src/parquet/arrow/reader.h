@@ -40,6 +40,7 @@ class RecordBatch;
 namespace parquet {
 
 class FileMetaData;
+class PagePredicate;
 class SchemaDescriptor;
 
 namespace arrow {
@@ -220,6 +221,13 @@ class PARQUET_EXPORT FileReader {
   /// By default only one thread is used.
   virtual void set_use_threads(bool use_threads) = 0;
 
+  /// Only read the data pages which may hold rows satisfying all of the
+  /// predicates, according to the page index of the file. Applies to
+  /// ReadTable, ReadRowGroups and GetRecordBatchReader. The rows read are a
+  /// superset of the matching rows and must still be filtered.
+  virtual void set_page_predicates(
+      std::vector<std::shared_ptr<PagePredicate>> predicates) = 0;
+
   virtual ~FileReader() = default;
 };
 
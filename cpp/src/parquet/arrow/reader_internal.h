@@ -29,6 +29,7 @@
 #include "parquet/column_reader.h"
 #include "parquet/file_reader.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 
@@ -56,16 +57,21 @@ class ColumnReaderImpl;
 // ----------------------------------------------------------------------
 // Iteration utilities
 
+// Rows to read in each row group, keyed by row group index
+using PageSelection = std::unordered_map<int, RowRanges>;
+
 // Abstraction to decouple row group iteration details from the ColumnReader,
 // so we can read only a single row group if we want
 class FileColumnIterator {
  public:
-  explicit FileColumnIterator(int column_index, ParquetFileReader* reader,
-                              std::vector<int> row_groups)
+  explicit FileColumnIterator(
+      int column_index, ParquetFileReader* reader, std::vector<int> row_groups,
+      std::shared_ptr<const PageSelection> page_selection = NULLPTR)
       : column_index_(column_index),
         reader_(reader),
         schema_(reader->metadata()->schema()),
-        row_groups_(row_groups.begin(), row_groups.end()) {}
+        row_groups_(row_groups.begin(), row_groups.end()),
+        page_selection_(std::move(page_selection)) {}
 
   virtual ~FileColumnIterator() {}
 
@@ -74,8 +80,15 @@ class FileColumnIterator {
       return nullptr;
     }
 
-    auto row_group_reader = reader_->RowGroup(row_groups_.front());
+    const int row_group = row_groups_.front();
     row_groups_.pop_front();
+    auto row_group_reader = reader_->RowGroup(row_group);
+    if (page_selection_) {
+      auto it = page_selection_->find(row_group);
+      if (it != page_selection_->end()) {
+        return row_group_reader->GetColumnPageReader(column_index_, it->second);
+      }
+    }
     return row_group_reader->GetColumnPageReader(column_index_);
   }
 
@@ -92,6 +105,7 @@ class FileColumnIterator {
   ParquetFileReader* reader_;
   const SchemaDescriptor* schema_;
   std::deque<int> row_groups_;
+  std::shared_ptr<const PageSelection> page_selection_;
 };
 
 using FileColumnIteratorFactory =
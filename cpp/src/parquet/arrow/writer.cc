@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <deque>
+#include <future>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -31,6 +32,7 @@
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/util/base64.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 #include "parquet/arrow/reader_internal.h"
@@ -492,6 +494,9 @@ class FileWriterImpl : public FileWriter {
     }
 
     auto WriteRowGroup = [&](int64_t offset, int64_t size) {
+      if (arrow_properties_->use_threads() && table.num_columns() > 1) {
+        return WriteBufferedRowGroup(table, offset, size);
+      }
       RETURN_NOT_OK(NewRowGroup(size));
       for (int i = 0; i < table.num_columns(); i++) {
         RETURN_NOT_OK(WriteColumnChunk(table.column(i), offset, size));
@@ -516,6 +521,45 @@ class FileWriterImpl : public FileWriter {
 
   const WriterProperties& properties() const { return *writer_->properties(); }
 
+  // Encode the columns of a row group concurrently. The column writers of a
+  // buffered row group keep their pages in memory and only write them to the
+  // sink, in column order, when the row group is closed.
+  Status WriteBufferedRowGroup(const Table& table, int64_t offset, int64_t size) {
+    if (row_group_writer_ != nullptr) {
+      PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+    }
+    PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendBufferedRowGroup());
+
+    std::vector<ColumnWriter*> column_writers(table.num_columns());
+    for (int i = 0; i < table.num_columns(); i++) {
+      PARQUET_CATCH_NOT_OK(column_writers[i] = row_group_writer_->column(i));
+    }
+
+    auto WriteColumnFunc = [&](int i) {
+      const SchemaField* schema_field;
+      RETURN_NOT_OK(schema_manifest_.GetColumnField(i, &schema_field));
+      // The scratch buffers of the write context can't be shared between threads
+      ArrowWriteContext ctx(memory_pool(), arrow_properties_.get());
+      ArrowColumnWriter arrow_writer(&ctx, column_writers[i], schema_field,
+                                     &schema_manifest_);
+      return arrow_writer.Write(*table.column(i), offset, size);
+    };
+
+    std::vector<std::future<Status>> futures;
+    auto pool = ::arrow::internal::GetCpuThreadPool();
+    for (int i = 0; i < table.num_columns(); i++) {
+      futures.push_back(pool->Submit(WriteColumnFunc, i));
+    }
+    Status final_status = Status::OK();
+    for (auto& fut : futures) {
+      Status st = fut.get();
+      if (!st.ok()) {
+        final_status = std::move(st);
+      }
+    }
+    return final_status;
+  }
+
   ::arrow::MemoryPool* memory_pool() const override {
     return column_write_context_.memory_pool;
   }
@@ -118,7 +118,8 @@ class SerializedPageReader : public PageReader {
       : stream_(stream),
         decompression_buffer_(AllocateBuffer(pool, 0)),
         seen_num_rows_(0),
-        total_num_rows_(total_num_rows) {
+        total_num_rows_(total_num_rows),
+        num_data_pages_(0) {
     max_page_header_size_ = kDefaultMaxPageHeaderSize;
     decompressor_ = GetCodec(codec);
   }
@@ -128,6 +129,10 @@ class SerializedPageReader : public PageReader {
 
   void set_max_page_header_size(uint32_t size) override { max_page_header_size_ = size; }
 
+  void set_data_page_filter(DataPageFilter filter) override {
+    data_page_filter_ = std::move(filter);
+  }
+
  private:
   std::shared_ptr<ArrowInputStream> stream_;
 
@@ -146,6 +151,10 @@ class SerializedPageReader : public PageReader {
 
   // Number of rows in all the data pages
   int64_t total_num_rows_;
+
+  // Number of data pages seen so far, skipped ones included
+  int32_t num_data_pages_;
+  DataPageFilter data_page_filter_;
 };
 
 std::shared_ptr<Page> SerializedPageReader::NextPage() {
@@ -188,6 +197,18 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
     int compressed_len = current_page_header_.compressed_page_size;
     int uncompressed_len = current_page_header_.uncompressed_page_size;
 
+    if (current_page_header_.type == format::PageType::DATA_PAGE ||
+        current_page_header_.type == format::PageType::DATA_PAGE_V2) {
+      const int32_t page_ordinal = num_data_pages_++;
+      if (data_page_filter_ && data_page_filter_(page_ordinal)) {
+        seen_num_rows_ += current_page_header_.type == format::PageType::DATA_PAGE
+                              ? current_page_header_.data_page_header.num_values
+                              : current_page_header_.data_page_header_v2.num_values;
+        PARQUET_THROW_NOT_OK(stream_->Advance(compressed_len));
+        continue;
+      }
+    }
+
     // Read the compressed data page.
     std::shared_ptr<Buffer> page_buffer;
     PARQUET_THROW_NOT_OK(stream_->Read(compressed_len, &page_buffer));
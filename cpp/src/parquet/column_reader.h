@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -88,6 +89,12 @@ class PARQUET_EXPORT PageReader {
   virtual std::shared_ptr<Page> NextPage() = 0;
 
   virtual void set_max_page_header_size(uint32_t size) = 0;
+
+  // Data pages for which the filter returns true are skipped without being
+  // read or decompressed. The filter is passed the ordinal of the data page
+  // within the column chunk. Dictionary pages are never skipped.
+  using DataPageFilter = std::function<bool(int32_t)>;
+  virtual void set_data_page_filter(DataPageFilter filter) = 0;
 };
 
 class PARQUET_EXPORT ColumnReader {
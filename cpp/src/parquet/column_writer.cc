@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -30,11 +31,13 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_stream_utils.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
 
+#include "parquet/bloom_filter.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/metadata.h"
@@ -138,7 +141,8 @@ class SerializedPageWriter : public PageWriter {
   SerializedPageWriter(const std::shared_ptr<ArrowOutputStream>& sink,
                        Compression::type codec, int compression_level,
                        ColumnChunkMetaDataBuilder* metadata,
-                       MemoryPool* pool = arrow::default_memory_pool())
+                       MemoryPool* pool = arrow::default_memory_pool(),
+                       bool write_page_index = false)
       : sink_(sink),
         metadata_(metadata),
         pool_(pool),
@@ -146,7 +150,10 @@ class SerializedPageWriter : public PageWriter {
         dictionary_page_offset_(0),
         data_page_offset_(0),
         total_uncompressed_size_(0),
-        total_compressed_size_(0) {
+        total_compressed_size_(0),
+        write_page_index_(write_page_index),
+        column_index_valid_(true),
+        has_null_counts_(true) {
     compressor_ = GetCodec(codec, compression_level);
     thrift_serializer_.reset(new ThriftSerializer);
   }
@@ -197,8 +204,67 @@ class SerializedPageWriter : public PageWriter {
                       total_compressed_size_, total_uncompressed_size_, has_dictionary,
                       fallback);
 
+    // The Bloom filter offset is part of the ColumnMetaData written below
+    WriteBloomFilter(0);
+
     // Write metadata at end of column chunk
     metadata_->WriteTo(sink_.get());
+
+    WritePageIndex(0);
+  }
+
+  void SetBloomFilter(std::unique_ptr<BloomFilter> bloom_filter) override {
+    bloom_filter_ = std::move(bloom_filter);
+  }
+
+  // Serialize the Bloom filter, if any, and record its location in the column
+  // chunk metadata. base_offset has the same meaning as for WritePageIndex.
+  void WriteBloomFilter(int64_t base_offset) {
+    if (bloom_filter_ == nullptr) {
+      return;
+    }
+    int64_t start_pos = -1;
+    PARQUET_THROW_NOT_OK(sink_->Tell(&start_pos));
+    bloom_filter_->WriteTo(sink_.get());
+    metadata_->SetBloomFilterOffset(start_pos + base_offset);
+    bloom_filter_.reset();
+  }
+
+  // Serialize the ColumnIndex and OffsetIndex of the data pages and record their
+  // location in the column chunk metadata. The page index is placed after the
+  // column chunk so that the layout of the pages themselves is unaffected.
+  // base_offset is added to every recorded position when sink_ is not the final
+  // file but a buffer that will be appended to it at that position.
+  void WritePageIndex(int64_t base_offset) {
+    if (!write_page_index_ || page_locations_.empty()) {
+      return;
+    }
+    int64_t start_pos = -1;
+    if (column_index_valid_) {
+      format::ColumnIndex column_index;
+      column_index.__set_null_pages(null_pages_);
+      column_index.__set_min_values(min_values_);
+      column_index.__set_max_values(max_values_);
+      column_index.__set_boundary_order(format::BoundaryOrder::UNORDERED);
+      if (has_null_counts_) {
+        column_index.__set_null_counts(null_counts_);
+      }
+      PARQUET_THROW_NOT_OK(sink_->Tell(&start_pos));
+      int64_t length = thrift_serializer_->Serialize(&column_index, sink_.get());
+      metadata_->SetColumnIndexLocation(start_pos + base_offset,
+                                        static_cast<int32_t>(length));
+    }
+
+    format::OffsetIndex offset_index;
+    std::vector<format::PageLocation> page_locations = page_locations_;
+    for (auto& location : page_locations) {
+      location.offset += base_offset;
+    }
+    offset_index.__set_page_locations(page_locations);
+    PARQUET_THROW_NOT_OK(sink_->Tell(&start_pos));
+    int64_t length = thrift_serializer_->Serialize(&offset_index, sink_.get());
+    metadata_->SetOffsetIndexLocation(start_pos + base_offset,
+                                      static_cast<int32_t>(length));
   }
 
   /**
@@ -253,6 +319,9 @@ class SerializedPageWriter : public PageWriter {
 
     total_uncompressed_size_ += uncompressed_size + header_size;
     total_compressed_size_ += compressed_data->size() + header_size;
+    if (write_page_index_) {
+      AddPageIndexEntry(page, start_pos, header_size + compressed_data->size());
+    }
     num_values_ += page.num_values();
 
     int64_t current_pos = -1;
@@ -273,6 +342,35 @@ class SerializedPageWriter : public PageWriter {
   int64_t total_uncompressed_size() { return total_uncompressed_size_; }
 
  private:
+  // Only called for non-repeated columns, where every level is a row
+  void AddPageIndexEntry(const CompressedDataPage& page, int64_t offset,
+                         int64_t page_size) {
+    format::PageLocation location;
+    location.__set_offset(offset);
+    location.__set_compressed_page_size(static_cast<int32_t>(page_size));
+    location.__set_first_row_index(num_values_);
+    page_locations_.push_back(location);
+
+    // The ColumnIndex is only written if every page carries usable statistics
+    const EncodedStatistics& stats = page.statistics();
+    if (stats.has_min && stats.has_max) {
+      null_pages_.push_back(false);
+      min_values_.push_back(stats.min());
+      max_values_.push_back(stats.max());
+    } else if (stats.has_null_count && stats.null_count == page.num_values()) {
+      null_pages_.push_back(true);
+      min_values_.emplace_back();
+      max_values_.emplace_back();
+    } else {
+      column_index_valid_ = false;
+    }
+    if (stats.has_null_count) {
+      null_counts_.push_back(stats.null_count);
+    } else {
+      has_null_counts_ = false;
+    }
+  }
+
   std::shared_ptr<ArrowOutputStream> sink_;
   ColumnChunkMetaDataBuilder* metadata_;
   MemoryPool* pool_;
@@ -282,6 +380,18 @@ class SerializedPageWriter : public PageWriter {
   int64_t total_uncompressed_size_;
   int64_t total_compressed_size_;
 
+  // Page index accumulated over the data pages of the column chunk
+  bool write_page_index_;
+  bool column_index_valid_;
+  bool has_null_counts_;
+  std::vector<format::PageLocation> page_locations_;
+  std::vector<bool> null_pages_;
+  std::vector<std::string> min_values_;
+  std::vector<std::string> max_values_;
+  std::vector<int64_t> null_counts_;
+
+  std::unique_ptr<BloomFilter> bloom_filter_;
+
   std::unique_ptr<ThriftSerializer> thrift_serializer_;
 
   // Compression codec to use.
@@ -294,11 +404,12 @@ class BufferedPageWriter : public PageWriter {
   BufferedPageWriter(const std::shared_ptr<ArrowOutputStream>& sink,
                      Compression::type codec, int compression_level,
                      ColumnChunkMetaDataBuilder* metadata,
-                     MemoryPool* pool = arrow::default_memory_pool())
+                     MemoryPool* pool = arrow::default_memory_pool(),
+                     bool write_page_index = false)
       : final_sink_(sink), metadata_(metadata) {
     in_memory_sink_ = CreateOutputStream(pool);
     pager_ = std::unique_ptr<SerializedPageWriter>(new SerializedPageWriter(
-        in_memory_sink_, codec, compression_level, metadata, pool));
+        in_memory_sink_, codec, compression_level, metadata, pool, write_page_index));
   }
 
   int64_t WriteDictionaryPage(const DictionaryPage& page) override {
@@ -314,15 +425,23 @@ class BufferedPageWriter : public PageWriter {
         pager_->data_page_offset() + final_position, pager_->total_compressed_size(),
         pager_->total_uncompressed_size(), has_dictionary, fallback);
 
+    pager_->WriteBloomFilter(final_position);
+
     // Write metadata at end of column chunk
     metadata_->WriteTo(in_memory_sink_.get());
 
+    pager_->WritePageIndex(final_position);
+
     // flush everything to the serialized sink
     std::shared_ptr<Buffer> buffer;
     PARQUET_THROW_NOT_OK(in_memory_sink_->Finish(&buffer));
     PARQUET_THROW_NOT_OK(final_sink_->Write(buffer));
   }
 
+  void SetBloomFilter(std::unique_ptr<BloomFilter> bloom_filter) override {
+    pager_->SetBloomFilter(std::move(bloom_filter));
+  }
+
   int64_t WriteDataPage(const CompressedDataPage& page) override {
     return pager_->WriteDataPage(page);
   }
@@ -343,13 +462,15 @@ class BufferedPageWriter : public PageWriter {
 std::unique_ptr<PageWriter> PageWriter::Open(
     const std::shared_ptr<ArrowOutputStream>& sink, Compression::type codec,
     int compression_level, ColumnChunkMetaDataBuilder* metadata, MemoryPool* pool,
-    bool buffered_row_group) {
+    bool buffered_row_group, bool write_page_index) {
+  // Page boundaries are only guaranteed to fall on rows for non-repeated columns
+  write_page_index = write_page_index && metadata->descr()->max_repetition_level() == 0;
   if (buffered_row_group) {
-    return std::unique_ptr<PageWriter>(
-        new BufferedPageWriter(sink, codec, compression_level, metadata, pool));
+    return std::unique_ptr<PageWriter>(new BufferedPageWriter(
+        sink, codec, compression_level, metadata, pool, write_page_index));
   } else {
-    return std::unique_ptr<PageWriter>(
-        new SerializedPageWriter(sink, codec, compression_level, metadata, pool));
+    return std::unique_ptr<PageWriter>(new SerializedPageWriter(
+        sink, codec, compression_level, metadata, pool, write_page_index));
   }
 }
 
@@ -495,6 +616,9 @@ class ColumnWriterImpl {
 
   std::vector<CompressedDataPage> data_pages_;
 
+  // Hashes of the values written to the column chunk, if enabled
+  std::unique_ptr<BloomFilter> bloom_filter_;
+
  private:
   void InitSinks() {
     definition_levels_sink_.Rewind(0);
@@ -614,6 +738,9 @@ int64_t ColumnWriterImpl::Close() {
     if (rows_written_ > 0 && chunk_statistics.is_set()) {
       metadata_->SetStatistics(chunk_statistics);
     }
+    if (bloom_filter_ != nullptr) {
+      pager_->SetBloomFilter(std::move(bloom_filter_));
+    }
     pager_->Close(has_dictionary_, fallback_);
   }
 
@@ -679,6 +806,29 @@ static inline bool IsDictionaryEncoding(Encoding::type encoding) {
   return encoding == Encoding::PLAIN_DICTIONARY;
 }
 
+// Hash a value for the Bloom filter as readers probing it will, i.e. based on
+// the PLAIN encoding of the physical type
+template <typename T>
+inline uint64_t BloomFilterHash(const BloomFilter& filter, T value, int) {
+  return filter.Hash(value);
+}
+
+inline uint64_t BloomFilterHash(const BloomFilter& filter, const Int96& value, int) {
+  return filter.Hash(&value);
+}
+
+inline uint64_t BloomFilterHash(const BloomFilter& filter, const ByteArray& value, int) {
+  return filter.Hash(&value);
+}
+
+inline uint64_t BloomFilterHash(const BloomFilter& filter, const FLBA& value,
+                                int type_length) {
+  return filter.Hash(&value, static_cast<uint32_t>(type_length));
+}
+
+// BOOLEAN columns have no Bloom filter
+inline uint64_t BloomFilterHash(const BloomFilter&, bool, int) { return 0; }
+
 template <typename DType>
 class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<DType> {
  public:
@@ -697,6 +847,16 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       page_statistics_ = MakeStatistics<DType>(descr_, allocator_);
       chunk_statistics_ = MakeStatistics<DType>(descr_, allocator_);
     }
+
+    if (properties->bloom_filter_enabled(descr_->path()) &&
+        DType::type_num != Type::BOOLEAN) {
+      const int32_t ndv = properties->bloom_filter_ndv(descr_->path());
+      auto bloom_filter = new BlockSplitBloomFilter();
+      bloom_filter->Init(BlockSplitBloomFilter::OptimalNumOfBits(
+                             static_cast<uint32_t>(ndv), DEFAULT_BLOOM_FILTER_FPP) /
+                         8);
+      bloom_filter_.reset(bloom_filter);
+    }
   }
 
   int64_t Close() override { return ColumnWriterImpl::Close(); }
@@ -969,6 +1129,11 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(values, num_values, num_nulls);
     }
+    if (bloom_filter_ != nullptr) {
+      for (int64_t i = 0; i < num_values; ++i) {
+        InsertBloomFilterValue(values[i]);
+      }
+    }
   }
 
   void WriteValuesSpaced(const T* values, int64_t num_values, int64_t num_spaced_values,
@@ -986,9 +1151,50 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       page_statistics_->UpdateSpaced(values, valid_bits, valid_bits_offset, num_values,
                                      num_nulls);
     }
+    if (bloom_filter_ != nullptr) {
+      if (descr_->schema_node()->is_optional()) {
+        ::arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                          num_spaced_values);
+        for (int64_t i = 0; i < num_spaced_values; ++i) {
+          if (valid_bits_reader.IsSet()) {
+            InsertBloomFilterValue(values[i]);
+          }
+          valid_bits_reader.Next();
+        }
+      } else {
+        for (int64_t i = 0; i < num_values; ++i) {
+          InsertBloomFilterValue(values[i]);
+        }
+      }
+    }
+  }
+
+  void InsertBloomFilterValue(const T& value) {
+    bloom_filter_->InsertHash(
+        BloomFilterHash(*bloom_filter_, value, descr_->type_length()));
   }
+
+  // Insert the non-null values of a BINARY or STRING array, which are only
+  // written directly for BYTE_ARRAY columns
+  void UpdateBloomFilter(const arrow::Array& values);
 };
 
+template <typename DType>
+void TypedColumnWriterImpl<DType>::UpdateBloomFilter(const arrow::Array& values) {
+  ParquetException::NYI("Bloom filter update from Arrow array for type " +
+                        TypeToString(DType::type_num));
+}
+
+template <>
+void TypedColumnWriterImpl<ByteArrayType>::UpdateBloomFilter(const arrow::Array& values) {
+  const auto& binary_values = checked_cast<const arrow::BinaryArray&>(values);
+  for (int64_t i = 0; i < binary_values.length(); ++i) {
+    if (binary_values.IsValid(i)) {
+      InsertBloomFilterValue(ByteArray(binary_values.GetView(i)));
+    }
+  }
+}
+
 template <typename DType>
 Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(const int16_t* def_levels,
                                                           const int16_t* rep_levels,
@@ -1054,6 +1260,10 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(const int16_t* def_lev
     if (page_statistics_ != nullptr) {
       PARQUET_CATCH_NOT_OK(page_statistics_->Update(*dictionary));
     }
+    // Likewise, unobserved dictionary values only cause false positives
+    if (bloom_filter_ != nullptr) {
+      PARQUET_CATCH_NOT_OK(UpdateBloomFilter(*dictionary));
+    }
     preserved_dictionary_ = dictionary;
   } else if (!dictionary->Equals(*preserved_dictionary_)) {
     // Dictionary has changed
@@ -1473,6 +1683,9 @@ Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(const int16_t* def_
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(*data_slice);
     }
+    if (bloom_filter_ != nullptr) {
+      UpdateBloomFilter(*data_slice);
+    }
     CommitWriteAndCheckPageLimit(batch_size, batch_num_values);
     CheckDictionarySizeLimit();
     value_offset += batch_num_spaced_values;
@@ -42,6 +42,7 @@ class RleEncoder;
 namespace parquet {
 
 struct ArrowWriteContext;
+class BloomFilter;
 class ColumnDescriptor;
 class CompressedDataPage;
 class DictionaryPage;
@@ -86,13 +87,17 @@ class PARQUET_EXPORT PageWriter {
       const std::shared_ptr<ArrowOutputStream>& sink, Compression::type codec,
       int compression_level, ColumnChunkMetaDataBuilder* metadata,
       ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
-      bool buffered_row_group = false);
+      bool buffered_row_group = false, bool write_page_index = false);
 
   // The Column Writer decides if dictionary encoding is used if set and
   // if the dictionary encoding has fallen back to default encoding on reaching dictionary
   // page limit
   virtual void Close(bool has_dictionary, bool fallback) = 0;
 
+  // Bloom filter of the values of the column chunk, serialized on Close after
+  // the data pages
+  virtual void SetBloomFilter(std::unique_ptr<BloomFilter> bloom_filter) = 0;
+
   virtual int64_t WriteDataPage(const CompressedDataPage& page) = 0;
 
   virtual int64_t WriteDictionaryPage(const DictionaryPage& page) = 0;
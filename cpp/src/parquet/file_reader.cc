@@ -21,19 +21,26 @@
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
+#include "arrow/io/caching.h"
 #include "arrow/io/file.h"
+#include "arrow/io/memory.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/ubsan.h"
 
+#include "parquet/bloom_filter.h"
 #include "parquet/column_reader.h"
 #include "parquet/column_scanner.h"
 #include "parquet/deprecated_io.h"
 #include "parquet/exception.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -74,16 +81,88 @@ std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(int i) {
   return contents_->GetColumnPageReader(i);
 }
 
+std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(
+    int i, const RowRanges& row_ranges) {
+  std::unique_ptr<PageReader> page_reader = GetColumnPageReader(i);
+  std::shared_ptr<OffsetIndex> offset_index = GetOffsetIndex(i);
+  if (offset_index) {
+    const int64_t num_rows = metadata()->num_rows();
+    page_reader->set_data_page_filter([offset_index, row_ranges, num_rows](int32_t page) {
+      if (page >= offset_index->num_pages()) {
+        return false;
+      }
+      return !row_ranges.Overlaps(offset_index->page_locations()[page].first_row_index,
+                                  offset_index->page_end_row(page, num_rows));
+    });
+  }
+  return page_reader;
+}
+
+std::unique_ptr<ColumnIndex> RowGroupReader::GetColumnIndex(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetColumnIndex(i);
+}
+
+std::unique_ptr<OffsetIndex> RowGroupReader::GetOffsetIndex(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetOffsetIndex(i);
+}
+
+std::unique_ptr<BloomFilter> RowGroupReader::GetBloomFilter(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetBloomFilter(i);
+}
+
 // Returns the rowgroup metadata
 const RowGroupMetaData* RowGroupReader::metadata() const { return contents_->metadata(); }
 
+// Compute the byte range of a column chunk, including the dictionary page
+static ::arrow::io::ReadRange ComputeColumnChunkRange(FileMetaData* file_metadata,
+                                                      ArrowInputFile* source,
+                                                      const ColumnChunkMetaData& col) {
+  int64_t col_start = col.data_page_offset();
+  if (col.has_dictionary_page() && col.dictionary_page_offset() > 0 &&
+      col_start > col.dictionary_page_offset()) {
+    col_start = col.dictionary_page_offset();
+  }
+
+  int64_t col_length = col.total_compressed_size();
+
+  // PARQUET-816 workaround for old files created by older parquet-mr
+  const ApplicationVersion& version = file_metadata->writer_version();
+  if (version.VersionLt(ApplicationVersion::PARQUET_816_FIXED_VERSION())) {
+    // The Parquet MR writer had a bug in 1.2.8 and below where it didn't include the
+    // dictionary page header size in total_compressed_size and total_uncompressed_size
+    // (see IMPALA-694). We add padding to compensate.
+    int64_t size = -1;
+    PARQUET_THROW_NOT_OK(source->GetSize(&size));
+    int64_t bytes_remaining = size - (col_start + col_length);
+    int64_t padding = std::min<int64_t>(kMaxDictHeaderSize, bytes_remaining);
+    col_length += padding;
+  }
+
+  return {col_start, col_length};
+}
+
 // RowGroupReader::Contents implementation for the Parquet file specification
 class SerializedRowGroup : public RowGroupReader::Contents {
  public:
-  SerializedRowGroup(const std::shared_ptr<ArrowInputFile>& source,
-                     FileMetaData* file_metadata, int row_group_number,
-                     const ReaderProperties& props)
-      : source_(source), file_metadata_(file_metadata), properties_(props) {
+  SerializedRowGroup(
+      const std::shared_ptr<ArrowInputFile>& source, FileMetaData* file_metadata,
+      int row_group_number, const ReaderProperties& props,
+      std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source = NULLPTR,
+      std::vector<bool> prebuffered_column_chunks = {})
+      : source_(source),
+        cached_source_(std::move(cached_source)),
+        prebuffered_column_chunks_(std::move(prebuffered_column_chunks)),
+        file_metadata_(file_metadata),
+        properties_(props) {
     row_group_metadata_ = file_metadata->RowGroup(row_group_number);
   }
 
@@ -94,36 +173,79 @@ class SerializedRowGroup : public RowGroupReader::Contents {
   std::unique_ptr<PageReader> GetColumnPageReader(int i) override {
     // Read column chunk from the file
     auto col = row_group_metadata_->ColumnChunk(i);
+    ::arrow::io::ReadRange col_range =
+        ComputeColumnChunkRange(file_metadata_, source_.get(), *col);
+
+    std::shared_ptr<ArrowInputStream> stream;
+    if (cached_source_ && static_cast<size_t>(i) < prebuffered_column_chunks_.size() &&
+        prebuffered_column_chunks_[i]) {
+      // The column chunk was read ahead by ParquetFileReader::PreBuffer
+      std::shared_ptr<Buffer> buffer;
+      PARQUET_THROW_NOT_OK(cached_source_->Read(col_range, &buffer));
+      stream = std::make_shared<::arrow::io::BufferReader>(buffer);
+    } else {
+      stream = properties_.GetStream(source_, col_range.offset, col_range.length);
+    }
+    return PageReader::Open(stream, col->num_values(), col->compression(),
+                            properties_.memory_pool());
+  }
 
-    int64_t col_start = col->data_page_offset();
-    if (col->has_dictionary_page() && col->dictionary_page_offset() > 0 &&
-        col_start > col->dictionary_page_offset()) {
-      col_start = col->dictionary_page_offset();
+  std::unique_ptr<ColumnIndex> GetColumnIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_column_index()) {
+      return nullptr;
     }
+    std::shared_ptr<Buffer> buffer =
+        ReadIndex(col->column_index_offset(), col->column_index_length());
+    return ColumnIndex::Make(file_metadata_->schema()->Column(i), buffer->data(),
+                             static_cast<uint32_t>(buffer->size()));
+  }
 
-    int64_t col_length = col->total_compressed_size();
-
-    // PARQUET-816 workaround for old files created by older parquet-mr
-    const ApplicationVersion& version = file_metadata_->writer_version();
-    if (version.VersionLt(ApplicationVersion::PARQUET_816_FIXED_VERSION())) {
-      // The Parquet MR writer had a bug in 1.2.8 and below where it didn't include the
-      // dictionary page header size in total_compressed_size and total_uncompressed_size
-      // (see IMPALA-694). We add padding to compensate.
-      int64_t size = -1;
-      PARQUET_THROW_NOT_OK(source_->GetSize(&size));
-      int64_t bytes_remaining = size - (col_start + col_length);
-      int64_t padding = std::min<int64_t>(kMaxDictHeaderSize, bytes_remaining);
-      col_length += padding;
+  std::unique_ptr<OffsetIndex> GetOffsetIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_offset_index()) {
+      return nullptr;
     }
+    std::shared_ptr<Buffer> buffer =
+        ReadIndex(col->offset_index_offset(), col->offset_index_length());
+    return OffsetIndex::Make(buffer->data(), static_cast<uint32_t>(buffer->size()));
+  }
 
-    std::shared_ptr<ArrowInputStream> stream =
-        properties_.GetStream(source_, col_start, col_length);
-    return PageReader::Open(stream, col->num_values(), col->compression(),
-                            properties_.memory_pool());
+  std::unique_ptr<BloomFilter> GetBloomFilter(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_bloom_filter()) {
+      return nullptr;
+    }
+    // The serialized filter starts with the size of its bitset, followed by the
+    // hash strategy and the algorithm
+    constexpr int32_t kHeaderSize = 3 * sizeof(uint32_t);
+    std::shared_ptr<Buffer> header = ReadIndex(col->bloom_filter_offset(), kHeaderSize);
+    const uint32_t bitset_size = ::arrow::util::SafeLoadAs<uint32_t>(header->data());
+    if (bitset_size > BloomFilter::kMaximumBloomFilterBytes) {
+      throw ParquetException("Bloom filter is too large: " +
+                             std::to_string(bitset_size) + " bytes");
+    }
+    std::shared_ptr<Buffer> buffer = ReadIndex(
+        col->bloom_filter_offset(), kHeaderSize + static_cast<int32_t>(bitset_size));
+    ::arrow::io::BufferReader stream(buffer);
+    return std::unique_ptr<BloomFilter>(
+        new BlockSplitBloomFilter(BlockSplitBloomFilter::Deserialize(&stream)));
   }
 
  private:
+  std::shared_ptr<Buffer> ReadIndex(int64_t offset, int32_t length) {
+    std::shared_ptr<Buffer> buffer;
+    PARQUET_THROW_NOT_OK(source_->ReadAt(offset, length, &buffer));
+    if (buffer->size() < length) {
+      throw ParquetException("Column chunk index read failed: file is truncated");
+    }
+    return buffer;
+  }
+
   std::shared_ptr<ArrowInputFile> source_;
+  // Set if some column chunks of this row group were pre-buffered
+  std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source_;
+  std::vector<bool> prebuffered_column_chunks_;
   FileMetaData* file_metadata_;
   std::unique_ptr<RowGroupMetaData> row_group_metadata_;
   ReaderProperties properties_;
@@ -144,11 +266,49 @@ class SerializedFile : public ParquetFileReader::Contents {
   void Close() override {}
 
   std::shared_ptr<RowGroupReader> GetRowGroup(int i) override {
+    std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source;
+    std::vector<bool> prebuffered_column_chunks;
+    {
+      std::lock_guard<std::mutex> lock(prebuffer_mutex_);
+      cached_source = cached_source_;
+      auto it = prebuffered_column_chunks_.find(i);
+      if (it != prebuffered_column_chunks_.end()) {
+        prebuffered_column_chunks = it->second;
+      }
+    }
     std::unique_ptr<SerializedRowGroup> contents(
-        new SerializedRowGroup(source_, file_metadata_.get(), i, properties_));
+        new SerializedRowGroup(source_, file_metadata_.get(), i, properties_,
+                               cached_source, std::move(prebuffered_column_chunks)));
     return std::make_shared<RowGroupReader>(std::move(contents));
   }
 
+  void PreBuffer(const std::vector<int>& row_groups,
+                 const std::vector<int>& column_indices,
+                 const ::arrow::io::CacheOptions& options) override {
+    auto cached_source =
+        std::make_shared<::arrow::io::internal::ReadRangeCache>(source_, options);
+    std::unordered_map<int, std::vector<bool>> prebuffered_column_chunks;
+    const int num_columns = file_metadata_->num_columns();
+    std::vector<::arrow::io::ReadRange> ranges;
+    for (int row : row_groups) {
+      std::vector<bool>& prebuffered = prebuffered_column_chunks[row];
+      prebuffered.resize(num_columns, false);
+      std::unique_ptr<RowGroupMetaData> row_group_metadata =
+          file_metadata_->RowGroup(row);
+      for (int col : column_indices) {
+        ranges.push_back(ComputeColumnChunkRange(
+            file_metadata_.get(), source_.get(), *row_group_metadata->ColumnChunk(col)));
+        prebuffered[col] = true;
+      }
+    }
+    PARQUET_THROW_NOT_OK(cached_source->Cache(std::move(ranges)));
+
+    // Row groups opened concurrently see either the previous or the new cache
+    std::lock_guard<std::mutex> lock(prebuffer_mutex_);
+    cached_source_ = std::move(cached_source);
+    prebuffered_column_chunks_ = std::move(prebuffered_column_chunks);
+  }
+
   std::shared_ptr<FileMetaData> metadata() const override { return file_metadata_; }
 
   void set_metadata(const std::shared_ptr<FileMetaData>& metadata) {
@@ -206,6 +366,11 @@ class SerializedFile : public ParquetFileReader::Contents {
 
  private:
   std::shared_ptr<ArrowInputFile> source_;
+  // Guards cached_source_ and prebuffered_column_chunks_
+  std::mutex prebuffer_mutex_;
+  std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source_;
+  // Columns covered by cached_source_, keyed by row group
+  std::unordered_map<int, std::vector<bool>> prebuffered_column_chunks_;
   std::shared_ptr<FileMetaData> file_metadata_;
   ReaderProperties properties_;
 };
@@ -298,6 +463,12 @@ std::shared_ptr<RowGroupReader> ParquetFileReader::RowGroup(int i) {
   return contents_->GetRowGroup(i);
 }
 
+void ParquetFileReader::PreBuffer(const std::vector<int>& row_groups,
+                                  const std::vector<int>& column_indices,
+                                  const ::arrow::io::CacheOptions& options) {
+  contents_->PreBuffer(row_groups, column_indices, options);
+}
+
 // ----------------------------------------------------------------------
 // File metadata helpers
 
@@ -23,17 +23,23 @@
 #include <string>
 #include <vector>
 
+#include "arrow/io/caching.h"
+
 #include "parquet/metadata.h"  // IWYU pragma: keep
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 
 namespace parquet {
 
+class BloomFilter;
+class ColumnIndex;
 class ColumnReader;
 class FileMetaData;
+class OffsetIndex;
 class PageReader;
 class RandomAccessSource;
 class RowGroupMetaData;
+class RowRanges;
 
 class PARQUET_EXPORT RowGroupReader {
  public:
@@ -43,6 +49,9 @@ class PARQUET_EXPORT RowGroupReader {
   struct Contents {
     virtual ~Contents() {}
     virtual std::unique_ptr<PageReader> GetColumnPageReader(int i) = 0;
+    virtual std::unique_ptr<ColumnIndex> GetColumnIndex(int i) = 0;
+    virtual std::unique_ptr<OffsetIndex> GetOffsetIndex(int i) = 0;
+    virtual std::unique_ptr<BloomFilter> GetBloomFilter(int i) = 0;
     virtual const RowGroupMetaData* metadata() const = 0;
     virtual const ReaderProperties* properties() const = 0;
   };
@@ -58,6 +67,20 @@ class PARQUET_EXPORT RowGroupReader {
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i);
 
+  // Construct a PageReader which skips the data pages of the indicated column
+  // holding none of the selected rows, according to the OffsetIndex of the
+  // column. All pages are returned if the column has no OffsetIndex.
+  std::unique_ptr<PageReader> GetColumnPageReader(int i, const RowRanges& row_ranges);
+
+  // Read the page index of the indicated column. Returns nullptr if it was
+  // not written.
+  std::unique_ptr<ColumnIndex> GetColumnIndex(int i);
+  std::unique_ptr<OffsetIndex> GetOffsetIndex(int i);
+
+  // Read the Bloom filter of the indicated column. Returns nullptr if it was
+  // not written.
+  std::unique_ptr<BloomFilter> GetBloomFilter(int i);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -79,6 +102,9 @@ class PARQUET_EXPORT ParquetFileReader {
     virtual void Close() = 0;
     virtual std::shared_ptr<RowGroupReader> GetRowGroup(int i) = 0;
     virtual std::shared_ptr<FileMetaData> metadata() const = 0;
+    virtual void PreBuffer(const std::vector<int>& row_groups,
+                           const std::vector<int>& column_indices,
+                           const ::arrow::io::CacheOptions& options) = 0;
   };
 
   ParquetFileReader();
@@ -118,6 +144,21 @@ class PARQUET_EXPORT ParquetFileReader {
   // Returns the file metadata. Only one instance is ever created
   std::shared_ptr<FileMetaData> metadata() const;
 
+  /// \brief Pre-buffer the specified column chunks of the specified row groups.
+  ///
+  /// The byte ranges of the column chunks are coalesced according to the
+  /// options and read concurrently in the background, so that high-latency
+  /// filesystems are hit with a few large reads instead of one read per
+  /// column chunk. Column readers of the pre-buffered chunks are then served
+  /// from memory, which holds the buffered data until the reader is closed or
+  /// PreBuffer is called again.
+  ///
+  /// Only the most recent call to PreBuffer is in effect. It may run
+  /// concurrently with RowGroup(), which uses the cache of either call.
+  void PreBuffer(const std::vector<int>& row_groups,
+                 const std::vector<int>& column_indices,
+                 const ::arrow::io::CacheOptions& options);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
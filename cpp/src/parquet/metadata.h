@@ -127,6 +127,16 @@ class PARQUET_EXPORT ColumnChunkMetaData {
   int64_t index_page_offset() const;
   int64_t total_compressed_size() const;
   int64_t total_uncompressed_size() const;
+  // page index
+  bool has_column_index() const;
+  int64_t column_index_offset() const;
+  int32_t column_index_length() const;
+  bool has_offset_index() const;
+  int64_t offset_index_offset() const;
+  int32_t offset_index_length() const;
+  // Bloom filter
+  bool has_bloom_filter() const;
+  int64_t bloom_filter_offset() const;
 
  private:
   explicit ColumnChunkMetaData(const void* metadata, const ColumnDescriptor* descr,
@@ -227,6 +237,11 @@ class PARQUET_EXPORT ColumnChunkMetaDataBuilder {
   void set_file_path(const std::string& path);
   // column metadata
   void SetStatistics(const EncodedStatistics& stats);
+  // location of the page index structures, written after the column chunk
+  void SetColumnIndexLocation(int64_t offset, int32_t length);
+  void SetOffsetIndexLocation(int64_t offset, int32_t length);
+  // location of the Bloom filter, written after the column chunk
+  void SetBloomFilterOffset(int64_t offset);
   // get the column descriptor
   const ColumnDescriptor* descr() const;
   // commit the metadata
@@ -0,0 +1,316 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/page_index.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "parquet/exception.h"
+#include "parquet/file_reader.h"
+#include "parquet/metadata.h"
+#include "parquet/schema.h"
+#include "parquet/statistics.h"
+#include "parquet/thrift_internal.h"
+
+namespace parquet {
+
+// ----------------------------------------------------------------------
+// OffsetIndex and ColumnIndex
+
+std::unique_ptr<OffsetIndex> OffsetIndex::Make(const void* serialized_index,
+                                               uint32_t index_len) {
+  format::OffsetIndex offset_index;
+  DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), &index_len,
+                       &offset_index);
+  std::vector<PageLocation> page_locations;
+  page_locations.reserve(offset_index.page_locations.size());
+  for (const auto& location : offset_index.page_locations) {
+    if (!page_locations.empty() &&
+        location.first_row_index <= page_locations.back().first_row_index) {
+      throw ParquetException("Malformed OffsetIndex: rows of pages are not increasing");
+    }
+    page_locations.push_back(
+        {location.offset, location.compressed_page_size, location.first_row_index});
+  }
+  return std::unique_ptr<OffsetIndex>(new OffsetIndex(std::move(page_locations)));
+}
+
+std::unique_ptr<ColumnIndex> ColumnIndex::Make(const ColumnDescriptor* descr,
+                                               const void* serialized_index,
+                                               uint32_t index_len) {
+  format::ColumnIndex column_index;
+  DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), &index_len,
+                       &column_index);
+  const size_t num_pages = column_index.null_pages.size();
+  if (column_index.min_values.size() != num_pages ||
+      column_index.max_values.size() != num_pages ||
+      (column_index.__isset.null_counts &&
+       column_index.null_counts.size() != num_pages)) {
+    throw ParquetException("Malformed ColumnIndex: page counts do not match");
+  }
+  std::unique_ptr<ColumnIndex> result(new ColumnIndex(descr));
+  result->null_pages_ = std::move(column_index.null_pages);
+  result->min_values_ = std::move(column_index.min_values);
+  result->max_values_ = std::move(column_index.max_values);
+  if (column_index.__isset.null_counts) {
+    result->null_counts_ = std::move(column_index.null_counts);
+  }
+  return result;
+}
+
+std::shared_ptr<Statistics> ColumnIndex::page_statistics(int i) const {
+  // The number of values of a page is not part of the ColumnIndex
+  return Statistics::Make(descr_, min_values_[i], max_values_[i], /*num_values=*/0,
+                          has_null_counts() ? null_counts_[i] : 0,
+                          /*distinct_count=*/0, !null_pages_[i]);
+}
+
+// ----------------------------------------------------------------------
+// RowRanges
+
+RowRanges RowRanges::All(int64_t num_rows) {
+  RowRanges result;
+  result.Add(0, num_rows);
+  return result;
+}
+
+void RowRanges::Add(int64_t from, int64_t to) {
+  if (from >= to) {
+    return;
+  }
+  if (!ranges_.empty()) {
+    if (from < ranges_.back().to) {
+      throw ParquetException("Row ranges must be added in increasing order");
+    }
+    if (from == ranges_.back().to) {
+      ranges_.back().to = to;
+      return;
+    }
+  }
+  ranges_.push_back({from, to});
+}
+
+bool RowRanges::Overlaps(int64_t from, int64_t to) const {
+  // First range ending after from
+  auto it = std::upper_bound(
+      ranges_.begin(), ranges_.end(), from,
+      [](int64_t row, const Range& range) { return row < range.to; });
+  return it != ranges_.end() && it->from < to;
+}
+
+RowRanges RowRanges::Intersection(const RowRanges& lhs, const RowRanges& rhs) {
+  RowRanges result;
+  auto left = lhs.ranges_.begin();
+  auto right = rhs.ranges_.begin();
+  while (left != lhs.ranges_.end() && right != rhs.ranges_.end()) {
+    result.Add(std::max(left->from, right->from), std::min(left->to, right->to));
+    if (left->to < right->to) {
+      ++left;
+    } else {
+      ++right;
+    }
+  }
+  return result;
+}
+
+RowRanges RowRanges::ExpandToPages(const OffsetIndex& offset_index,
+                                   int64_t num_rows) const {
+  RowRanges result;
+  const auto& locations = offset_index.page_locations();
+  for (int i = 0; i < offset_index.num_pages(); ++i) {
+    const int64_t page_end = offset_index.page_end_row(i, num_rows);
+    if (Overlaps(locations[i].first_row_index, page_end)) {
+      result.Add(locations[i].first_row_index, page_end);
+    }
+  }
+  return result;
+}
+
+int64_t RowRanges::row_count() const {
+  int64_t count = 0;
+  for (const auto& range : ranges_) {
+    count += range.to - range.from;
+  }
+  return count;
+}
+
+bool RowRanges::Equals(const RowRanges& other) const {
+  if (ranges_.size() != other.ranges_.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < ranges_.size(); ++i) {
+    if (ranges_[i].from != other.ranges_[i].from ||
+        ranges_[i].to != other.ranges_[i].to) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// ----------------------------------------------------------------------
+// Page predicates
+
+namespace {
+
+template <typename DType>
+class RangePagePredicate : public PagePredicate {
+ public:
+  RangePagePredicate(const ColumnDescriptor* descr, int column_index,
+                     const std::string* encoded_lower, const std::string* encoded_upper)
+      : PagePredicate(column_index),
+        has_lower_(encoded_lower != nullptr),
+        has_upper_(encoded_upper != nullptr) {
+    // Decoding through Statistics keeps the values of variable-length bounds alive
+    static const std::string kUnbounded;
+    const std::string& lower = has_lower_ ? *encoded_lower : kUnbounded;
+    const std::string& upper = has_upper_ ? *encoded_upper : kUnbounded;
+    bounds_ = std::static_pointer_cast<TypedStatistics<DType>>(
+        Statistics::Make(descr, has_lower_ ? lower : upper, has_upper_ ? upper : lower,
+                         0, 0, 0, has_lower_ || has_upper_));
+    comparator_ = MakeComparator<DType>(descr);
+  }
+
+  bool MaybeSatisfies(const ColumnIndex& index, int i) const override {
+    if (index.is_null_page(i)) {
+      return false;
+    }
+    if (!has_lower_ && !has_upper_) {
+      return true;
+    }
+    auto page =
+        std::static_pointer_cast<TypedStatistics<DType>>(index.page_statistics(i));
+    if (has_lower_ && comparator_->Compare(page->max(), bounds_->min())) {
+      return false;
+    }
+    if (has_upper_ && comparator_->Compare(bounds_->max(), page->min())) {
+      return false;
+    }
+    return true;
+  }
+
+ private:
+  bool has_lower_;
+  bool has_upper_;
+  std::shared_ptr<TypedStatistics<DType>> bounds_;
+  std::shared_ptr<TypedComparator<DType>> comparator_;
+};
+
+// Used when the statistics of a column cannot be compared
+class AllPagesPredicate : public PagePredicate {
+ public:
+  explicit AllPagesPredicate(int column_index) : PagePredicate(column_index) {}
+
+  bool MaybeSatisfies(const ColumnIndex& index, int i) const override { return true; }
+};
+
+}  // namespace
+
+std::shared_ptr<PagePredicate> MakeRangePagePredicate(const ColumnDescriptor* descr,
+                                                      int column_index,
+                                                      const std::string* encoded_lower,
+                                                      const std::string* encoded_upper) {
+  if (descr->sort_order() == SortOrder::UNKNOWN) {
+    return std::make_shared<AllPagesPredicate>(column_index);
+  }
+  switch (descr->physical_type()) {
+    case Type::BOOLEAN:
+      return std::make_shared<RangePagePredicate<BooleanType>>(
+          descr, column_index, encoded_lower, encoded_upper);
+    case Type::INT32:
+      return std::make_shared<RangePagePredicate<Int32Type>>(
+          descr, column_index, encoded_lower, encoded_upper);
+    case Type::INT64:
+      return std::make_shared<RangePagePredicate<Int64Type>>(
+          descr, column_index, encoded_lower, encoded_upper);
+    case Type::FLOAT:
+      return std::make_shared<RangePagePredicate<FloatType>>(
+          descr, column_index, encoded_lower, encoded_upper);
+    case Type::DOUBLE:
+      return std::make_shared<RangePagePredicate<DoubleType>>(
+          descr, column_index, encoded_lower, encoded_upper);
+    case Type::BYTE_ARRAY:
+      return std::make_shared<RangePagePredicate<ByteArrayType>>(
+          descr, column_index, encoded_lower, encoded_upper);
+    case Type::FIXED_LEN_BYTE_ARRAY:
+      return std::make_shared<RangePagePredicate<FLBAType>>(
+          descr, column_index, encoded_lower, encoded_upper);
+    default:
+      return std::make_shared<AllPagesPredicate>(column_index);
+  }
+}
+
+// ----------------------------------------------------------------------
+// Row selection for a row group
+
+RowRanges ComputeRowRanges(RowGroupReader* row_group,
+                           const std::vector<std::shared_ptr<PagePredicate>>& predicates,
+                           const std::vector<int>& column_indices) {
+  const int64_t num_rows = row_group->metadata()->num_rows();
+  RowRanges selected = RowRanges::All(num_rows);
+  for (const auto& predicate : predicates) {
+    std::unique_ptr<ColumnIndex> column_index =
+        row_group->GetColumnIndex(predicate->column_index());
+    std::unique_ptr<OffsetIndex> offset_index =
+        row_group->GetOffsetIndex(predicate->column_index());
+    if (!column_index || !offset_index ||
+        column_index->num_pages() != offset_index->num_pages()) {
+      continue;
+    }
+    RowRanges matching;
+    for (int i = 0; i < offset_index->num_pages(); ++i) {
+      if (predicate->MaybeSatisfies(*column_index, i)) {
+        matching.Add(offset_index->page_locations()[i].first_row_index,
+                     offset_index->page_end_row(i, num_rows));
+      }
+    }
+    selected = RowRanges::Intersection(selected, matching);
+  }
+  if (selected.empty()) {
+    return selected;
+  }
+
+  // Every column reads whole pages, so grow the selection until its boundaries
+  // are page boundaries in all of the columns. This terminates since the
+  // selection only grows.
+  std::vector<std::unique_ptr<OffsetIndex>> offset_indexes;
+  for (int i : column_indices) {
+    std::unique_ptr<OffsetIndex> offset_index = row_group->GetOffsetIndex(i);
+    if (!offset_index) {
+      // This column has to be read in full
+      return RowRanges::All(num_rows);
+    }
+    offset_indexes.push_back(std::move(offset_index));
+  }
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (const auto& offset_index : offset_indexes) {
+      RowRanges expanded = selected.ExpandToPages(*offset_index, num_rows);
+      if (!expanded.Equals(selected)) {
+        selected = std::move(expanded);
+        changed = true;
+      }
+    }
+  }
+  return selected;
+}
+
+}  // namespace parquet
@@ -0,0 +1,198 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "parquet/platform.h"
+#include "parquet/types.h"
+
+namespace parquet {
+
+class ColumnDescriptor;
+class RowGroupReader;
+class Statistics;
+
+// ----------------------------------------------------------------------
+// Page index structures, stored after the column chunks of a row group and
+// referenced from the ColumnChunk metadata
+
+/// \brief Location of a data page in the file, as recorded in the OffsetIndex
+struct PARQUET_EXPORT PageLocation {
+  /// Offset of the page header in the file
+  int64_t offset;
+  /// Size of the page, header included
+  int32_t compressed_page_size;
+  /// Index within the row group of the first row of the page
+  int64_t first_row_index;
+};
+
+/// \brief Locations of the data pages of a column chunk
+class PARQUET_EXPORT OffsetIndex {
+ public:
+  /// \brief Deserialize an OffsetIndex read from the file
+  static std::unique_ptr<OffsetIndex> Make(const void* serialized_index,
+                                           uint32_t index_len);
+
+  int num_pages() const { return static_cast<int>(page_locations_.size()); }
+
+  const std::vector<PageLocation>& page_locations() const { return page_locations_; }
+
+  /// \brief One past the index of the last row of page i
+  /// \param[in] i the page ordinal
+  /// \param[in] num_rows the number of rows in the row group
+  int64_t page_end_row(int i, int64_t num_rows) const {
+    return i + 1 < num_pages() ? page_locations_[i + 1].first_row_index : num_rows;
+  }
+
+ private:
+  explicit OffsetIndex(std::vector<PageLocation> page_locations)
+      : page_locations_(std::move(page_locations)) {}
+
+  std::vector<PageLocation> page_locations_;
+};
+
+/// \brief Per-page statistics of a column chunk
+class PARQUET_EXPORT ColumnIndex {
+ public:
+  /// \brief Deserialize a ColumnIndex read from the file
+  static std::unique_ptr<ColumnIndex> Make(const ColumnDescriptor* descr,
+                                           const void* serialized_index,
+                                           uint32_t index_len);
+
+  int num_pages() const { return static_cast<int>(null_pages_.size()); }
+
+  /// \brief Whether page i only contains null values, in which case it has no
+  /// min and max values
+  bool is_null_page(int i) const { return null_pages_[i]; }
+
+  bool has_null_counts() const { return !null_counts_.empty(); }
+
+  int64_t null_count(int i) const { return null_counts_[i]; }
+
+  /// \brief PLAIN-encoded lower bound of the values of page i
+  const std::string& encoded_min(int i) const { return min_values_[i]; }
+
+  /// \brief PLAIN-encoded upper bound of the values of page i
+  const std::string& encoded_max(int i) const { return max_values_[i]; }
+
+  /// \brief Decode the bounds of page i as Statistics of the column type
+  std::shared_ptr<Statistics> page_statistics(int i) const;
+
+  const ColumnDescriptor* descr() const { return descr_; }
+
+ private:
+  explicit ColumnIndex(const ColumnDescriptor* descr) : descr_(descr) {}
+
+  const ColumnDescriptor* descr_;
+  std::vector<bool> null_pages_;
+  std::vector<std::string> min_values_;
+  std::vector<std::string> max_values_;
+  std::vector<int64_t> null_counts_;
+};
+
+// ----------------------------------------------------------------------
+// Row selection
+
+/// \brief Sorted, disjoint ranges of row indices within a row group
+class PARQUET_EXPORT RowRanges {
+ public:
+  /// \brief Half-open range [from, to) of rows
+  struct Range {
+    int64_t from;
+    int64_t to;
+  };
+
+  RowRanges() = default;
+
+  /// \brief A single range covering the num_rows rows of a row group
+  static RowRanges All(int64_t num_rows);
+
+  /// \brief Append the range [from, to), which must not start before the end
+  /// of the last range. Adjacent ranges are merged.
+  void Add(int64_t from, int64_t to);
+
+  /// \brief Whether any row in [from, to) is selected
+  bool Overlaps(int64_t from, int64_t to) const;
+
+  /// \brief Rows selected in both lhs and rhs
+  static RowRanges Intersection(const RowRanges& lhs, const RowRanges& rhs);
+
+  /// \brief Widen the selection to the boundaries of the pages described by
+  /// offset_index: the result holds every page which overlaps this selection
+  RowRanges ExpandToPages(const OffsetIndex& offset_index, int64_t num_rows) const;
+
+  int64_t row_count() const;
+
+  bool empty() const { return ranges_.empty(); }
+
+  const std::vector<Range>& ranges() const { return ranges_; }
+
+  bool Equals(const RowRanges& other) const;
+
+ private:
+  std::vector<Range> ranges_;
+};
+
+/// \brief A predicate on the values of a single leaf column, evaluated
+/// against the per-page statistics of the ColumnIndex
+class PARQUET_EXPORT PagePredicate {
+ public:
+  explicit PagePredicate(int column_index) : column_index_(column_index) {}
+
+  virtual ~PagePredicate() = default;
+
+  /// \brief The leaf column the predicate applies to
+  int column_index() const { return column_index_; }
+
+  /// \brief Return false only if no value of page i can satisfy the predicate
+  virtual bool MaybeSatisfies(const ColumnIndex& index, int i) const = 0;
+
+ private:
+  int column_index_;
+};
+
+/// \brief Make a predicate selecting the non-null values v of a column such
+/// that lower <= v <= upper, in the sort order of the column type.
+///
+/// The bounds are PLAIN-encoded, like the min and max values of
+/// EncodedStatistics. A null bound leaves that side of the range open.
+PARQUET_EXPORT
+std::shared_ptr<PagePredicate> MakeRangePagePredicate(const ColumnDescriptor* descr,
+                                                      int column_index,
+                                                      const std::string* encoded_lower,
+                                                      const std::string* encoded_upper);
+
+/// \brief Compute the rows of a row group which may satisfy all predicates.
+///
+/// Predicates on columns without a page index select every row. The result
+/// is widened to page boundaries shared by all of column_indices, so that
+/// reading each of those columns through
+/// RowGroupReader::GetColumnPageReader(i, row_ranges) yields exactly the same
+/// rows. The selected rows are a superset of the rows satisfying the
+/// predicates and must still be filtered by the caller.
+PARQUET_EXPORT
+RowRanges ComputeRowRanges(RowGroupReader* row_group,
+                           const std::vector<std::shared_ptr<PagePredicate>>& predicates,
+                           const std::vector<int>& column_indices);
+
+}  // namespace parquet
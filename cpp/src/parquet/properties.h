@@ -23,6 +23,7 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#include "arrow/io/caching.h"
 #include "arrow/type.h"
 #include "arrow/util/compression.h"
 
@@ -79,6 +80,10 @@ static constexpr int64_t DEFAULT_WRITE_BATCH_SIZE = 1024;
 static constexpr int64_t DEFAULT_MAX_ROW_GROUP_LENGTH = 64 * 1024 * 1024;
 static constexpr bool DEFAULT_ARE_STATISTICS_ENABLED = true;
 static constexpr int64_t DEFAULT_MAX_STATISTICS_SIZE = 4096;
+static constexpr bool DEFAULT_IS_PAGE_INDEX_ENABLED = false;
+static constexpr bool DEFAULT_IS_BLOOM_FILTER_ENABLED = false;
+static constexpr int32_t DEFAULT_BLOOM_FILTER_NDV = 1024 * 1024;
+static constexpr double DEFAULT_BLOOM_FILTER_FPP = 0.05;
 static constexpr Encoding::type DEFAULT_ENCODING = Encoding::PLAIN;
 static constexpr ParquetVersion::type DEFAULT_WRITER_VERSION =
     ParquetVersion::PARQUET_1_0;
@@ -91,13 +96,19 @@ class PARQUET_EXPORT ColumnProperties {
                    Compression::type codec = DEFAULT_COMPRESSION_TYPE,
                    bool dictionary_enabled = DEFAULT_IS_DICTIONARY_ENABLED,
                    bool statistics_enabled = DEFAULT_ARE_STATISTICS_ENABLED,
-                   size_t max_stats_size = DEFAULT_MAX_STATISTICS_SIZE)
+                   size_t max_stats_size = DEFAULT_MAX_STATISTICS_SIZE,
+                   bool page_index_enabled = DEFAULT_IS_PAGE_INDEX_ENABLED,
+                   bool bloom_filter_enabled = DEFAULT_IS_BLOOM_FILTER_ENABLED,
+                   int32_t bloom_filter_ndv = DEFAULT_BLOOM_FILTER_NDV)
       : encoding_(encoding),
         codec_(codec),
         dictionary_enabled_(dictionary_enabled),
         statistics_enabled_(statistics_enabled),
         max_stats_size_(max_stats_size),
-        compression_level_(Codec::UseDefaultCompressionLevel()) {}
+        compression_level_(Codec::UseDefaultCompressionLevel()),
+        page_index_enabled_(page_index_enabled),
+        bloom_filter_enabled_(bloom_filter_enabled),
+        bloom_filter_ndv_(bloom_filter_ndv) {}
 
   void set_encoding(Encoding::type encoding) { encoding_ = encoding; }
 
@@ -119,6 +130,18 @@ class PARQUET_EXPORT ColumnProperties {
     compression_level_ = compression_level;
   }
 
+  void set_page_index_enabled(bool page_index_enabled) {
+    page_index_enabled_ = page_index_enabled;
+  }
+
+  void set_bloom_filter_enabled(bool bloom_filter_enabled) {
+    bloom_filter_enabled_ = bloom_filter_enabled;
+  }
+
+  void set_bloom_filter_ndv(int32_t bloom_filter_ndv) {
+    bloom_filter_ndv_ = bloom_filter_ndv;
+  }
+
   Encoding::type encoding() const { return encoding_; }
 
   Compression::type compression() const { return codec_; }
@@ -131,6 +154,12 @@ class PARQUET_EXPORT ColumnProperties {
 
   int compression_level() const { return compression_level_; }
 
+  bool page_index_enabled() const { return page_index_enabled_; }
+
+  bool bloom_filter_enabled() const { return bloom_filter_enabled_; }
+
+  int32_t bloom_filter_ndv() const { return bloom_filter_ndv_; }
+
  private:
   Encoding::type encoding_;
   Compression::type codec_;
@@ -138,6 +167,9 @@ class PARQUET_EXPORT ColumnProperties {
   bool statistics_enabled_;
   size_t max_stats_size_;
   int compression_level_;
+  bool page_index_enabled_;
+  bool bloom_filter_enabled_;
+  int32_t bloom_filter_ndv_;
 };
 
 class PARQUET_EXPORT WriterProperties {
@@ -357,6 +389,62 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_statistics(path->ToDotString());
     }
 
+    /// Write a ColumnIndex and an OffsetIndex for the column chunks of
+    /// non-repeated columns, allowing readers to skip individual data pages.
+    Builder* enable_page_index() {
+      default_column_properties_.set_page_index_enabled(true);
+      return this;
+    }
+
+    Builder* disable_page_index() {
+      default_column_properties_.set_page_index_enabled(false);
+      return this;
+    }
+
+    Builder* enable_page_index(const std::string& path) {
+      page_index_enabled_[path] = true;
+      return this;
+    }
+
+    Builder* enable_page_index(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->enable_page_index(path->ToDotString());
+    }
+
+    Builder* disable_page_index(const std::string& path) {
+      page_index_enabled_[path] = false;
+      return this;
+    }
+
+    Builder* disable_page_index(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_page_index(path->ToDotString());
+    }
+
+    /// Write a Bloom filter of the values of each column chunk of the column,
+    /// allowing readers to skip row groups which don't contain a looked up
+    /// value. The filter is sized for ndv distinct values per column chunk
+    /// with a false positive probability of DEFAULT_BLOOM_FILTER_FPP.
+    /// BOOLEAN columns never get a Bloom filter.
+    Builder* enable_bloom_filter(const std::string& path,
+                                 int32_t ndv = DEFAULT_BLOOM_FILTER_NDV) {
+      bloom_filter_enabled_[path] = true;
+      bloom_filter_ndv_[path] = ndv;
+      return this;
+    }
+
+    Builder* enable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path,
+                                 int32_t ndv = DEFAULT_BLOOM_FILTER_NDV) {
+      return this->enable_bloom_filter(path->ToDotString(), ndv);
+    }
+
+    Builder* disable_bloom_filter(const std::string& path) {
+      bloom_filter_enabled_[path] = false;
+      return this;
+    }
+
+    Builder* disable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_bloom_filter(path->ToDotString());
+    }
+
     std::shared_ptr<WriterProperties> build() {
       std::unordered_map<std::string, ColumnProperties> column_properties;
       auto get = [&](const std::string& key) -> ColumnProperties& {
@@ -375,6 +463,12 @@ class PARQUET_EXPORT WriterProperties {
         get(item.first).set_dictionary_enabled(item.second);
       for (const auto& item : statistics_enabled_)
         get(item.first).set_statistics_enabled(item.second);
+      for (const auto& item : page_index_enabled_)
+        get(item.first).set_page_index_enabled(item.second);
+      for (const auto& item : bloom_filter_enabled_)
+        get(item.first).set_bloom_filter_enabled(item.second);
+      for (const auto& item : bloom_filter_ndv_)
+        get(item.first).set_bloom_filter_ndv(item.second);
 
       return std::shared_ptr<WriterProperties>(
           new WriterProperties(pool_, dictionary_pagesize_limit_, write_batch_size_,
@@ -398,6 +492,9 @@ class PARQUET_EXPORT WriterProperties {
     std::unordered_map<std::string, int32_t> codecs_compression_level_;
     std::unordered_map<std::string, bool> dictionary_enabled_;
     std::unordered_map<std::string, bool> statistics_enabled_;
+    std::unordered_map<std::string, bool> page_index_enabled_;
+    std::unordered_map<std::string, bool> bloom_filter_enabled_;
+    std::unordered_map<std::string, int32_t> bloom_filter_ndv_;
   };
 
   inline MemoryPool* memory_pool() const { return pool_; }
@@ -461,6 +558,18 @@ class PARQUET_EXPORT WriterProperties {
     return column_properties(path).max_statistics_size();
   }
 
+  bool page_index_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).page_index_enabled();
+  }
+
+  bool bloom_filter_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_enabled();
+  }
+
+  int32_t bloom_filter_ndv(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_ndv();
+  }
+
  private:
   explicit WriterProperties(
       MemoryPool* pool, int64_t dictionary_pagesize_limit, int64_t write_batch_size,
@@ -504,7 +613,9 @@ class PARQUET_EXPORT ArrowReaderProperties {
   explicit ArrowReaderProperties(bool use_threads = kArrowDefaultUseThreads)
       : use_threads_(use_threads),
         read_dict_indices_(),
-        batch_size_(kArrowDefaultBatchSize) {}
+        batch_size_(kArrowDefaultBatchSize),
+        pre_buffer_(false),
+        cache_options_(::arrow::io::CacheOptions::Defaults()) {}
 
   void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
 
@@ -529,10 +640,25 @@ class PARQUET_EXPORT ArrowReaderProperties {
 
   int64_t batch_size() const { return batch_size_; }
 
+  /// Enable read coalescing. When enabled, the Arrow reader pre-buffers the
+  /// column chunks of the selected row groups and columns before decoding
+  /// them, merging nearby reads into larger concurrent ones. This trades
+  /// memory for fewer round trips on high-latency filesystems such as S3.
+  void set_pre_buffer(bool pre_buffer) { pre_buffer_ = pre_buffer; }
+
+  bool pre_buffer() const { return pre_buffer_; }
+
+  /// Set options for read coalescing. Only used if pre_buffer is enabled.
+  void set_cache_options(::arrow::io::CacheOptions options) { cache_options_ = options; }
+
+  const ::arrow::io::CacheOptions& cache_options() const { return cache_options_; }
+
  private:
   bool use_threads_;
   std::unordered_set<int> read_dict_indices_;
   int64_t batch_size_;
+  bool pre_buffer_;
+  ::arrow::io::CacheOptions cache_options_;
 };
 
 /// EXPERIMENTAL: Constructs the default ArrowReaderProperties
@@ -548,7 +674,8 @@ class PARQUET_EXPORT ArrowWriterProperties {
           coerce_timestamps_enabled_(false),
           coerce_timestamps_unit_(::arrow::TimeUnit::SECOND),
           truncated_timestamps_allowed_(false),
-          store_schema_(false) {}
+          store_schema_(false),
+          use_threads_(false) {}
     virtual ~Builder() {}
 
     Builder* disable_deprecated_int96_timestamps() {
@@ -585,10 +712,18 @@ class PARQUET_EXPORT ArrowWriterProperties {
       return this;
     }
 
+    /// \brief Encode the columns of a row group in parallel on the CPU thread
+    /// pool. The encoded pages are buffered in memory until the whole row group
+    /// has been encoded.
+    Builder* set_use_threads(bool use_threads) {
+      use_threads_ = use_threads;
+      return this;
+    }
+
     std::shared_ptr<ArrowWriterProperties> build() {
       return std::shared_ptr<ArrowWriterProperties>(new ArrowWriterProperties(
           write_timestamps_as_int96_, coerce_timestamps_enabled_, coerce_timestamps_unit_,
-          truncated_timestamps_allowed_, store_schema_));
+          truncated_timestamps_allowed_, store_schema_, use_threads_));
     }
 
    private:
@@ -599,6 +734,7 @@ class PARQUET_EXPORT ArrowWriterProperties {
     bool truncated_timestamps_allowed_;
 
     bool store_schema_;
+    bool use_threads_;
   };
 
   bool support_deprecated_int96_timestamps() const { return write_timestamps_as_int96_; }
@@ -612,22 +748,27 @@ class PARQUET_EXPORT ArrowWriterProperties {
 
   bool store_schema() const { return store_schema_; }
 
+  bool use_threads() const { return use_threads_; }
+
  private:
   explicit ArrowWriterProperties(bool write_nanos_as_int96,
                                  bool coerce_timestamps_enabled,
                                  ::arrow::TimeUnit::type coerce_timestamps_unit,
-                                 bool truncated_timestamps_allowed, bool store_schema)
+                                 bool truncated_timestamps_allowed, bool store_schema,
+                                 bool use_threads)
       : write_timestamps_as_int96_(write_nanos_as_int96),
         coerce_timestamps_enabled_(coerce_timestamps_enabled),
         coerce_timestamps_unit_(coerce_timestamps_unit),
         truncated_timestamps_allowed_(truncated_timestamps_allowed),
-        store_schema_(store_schema) {}
+        store_schema_(store_schema),
+        use_threads_(use_threads) {}
 
   const bool write_timestamps_as_int96_;
   const bool coerce_timestamps_enabled_;
   const ::arrow::TimeUnit::type coerce_timestamps_unit_;
   const bool truncated_timestamps_allowed_;
   const bool store_schema_;
+  const bool use_threads_;
 };
 
 /// \brief State object used for writing Arrow data directly to a Parquet
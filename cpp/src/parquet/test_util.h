@@ -195,6 +195,9 @@ class MockPageReader : public PageReader {
   // No-op
   void set_max_page_header_size(uint32_t size) override {}
 
+  // No-op
+  void set_data_page_filter(DataPageFilter filter) override {}
+
  private:
   std::vector<std::shared_ptr<Page>> pages_;
   int page_index_;
@@ -59,6 +59,20 @@ public class OrcReader implements AutoCloseable {
     return jniWrapper.seek(nativeInstanceId, rowNumber);
   }
 
+  /**
+   * Read and decode up to depth stripes ahead of nextStripeReader() on a
+   * native thread pool, so that consuming a stripe overlaps with the I/O of
+   * the next ones. Prefetching pauses while the stripes decoded ahead hold
+   * more than memoryLimit bytes.
+   * @param depth the maximum number of stripes decoded ahead, 0 to disable
+   * @param memoryLimit the approximate number of decoded bytes above which
+   *     prefetching pauses
+   * @return true if the arguments are valid
+   */
+  public boolean setStripePrefetch(int depth, long memoryLimit) throws IllegalArgumentException {
+    return jniWrapper.setStripePrefetch(nativeInstanceId, depth, memoryLimit);
+  }
+
   /**
    * Get a stripe level ArrowReader with specified batchSize in each record batch.
    *
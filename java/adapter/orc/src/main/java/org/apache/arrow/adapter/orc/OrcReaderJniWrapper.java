@@ -62,6 +62,16 @@ class OrcReaderJniWrapper {
    */
   native boolean seek(long readerId, int rowNumber);
 
+  /**
+   * Decode up to depth stripes ahead of nextStripeReader() in the background.
+   * @param readerId id of the reader instance
+   * @param depth the maximum number of stripes decoded ahead, 0 to disable
+   * @param memoryLimit the approximate number of decoded bytes above which
+   *     prefetching pauses
+   * @return true if the arguments are valid
+   */
+  native boolean setStripePrefetch(long readerId, int depth, long memoryLimit);
+
   /**
    * The number of stripes in the file.
    * @param readerId id of the reader instance
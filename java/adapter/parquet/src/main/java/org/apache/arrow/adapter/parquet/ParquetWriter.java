@@ -33,6 +33,17 @@ public class ParquetWriter {
     parquetWriterHandler = openParquetFile(path, schema);
   }
 
+  /**
+   * Create a ParquetWriter which writes a row group whenever maxRowGroupRows rows
+   * or maxRowGroupBytes bytes of record batches have been buffered.
+   */
+  public ParquetWriter(ParquetWriterJniWrapper wrapper, String path, Schema schema,
+      long maxRowGroupRows, long maxRowGroupBytes) throws IOException {
+    this.wrapper = wrapper;
+    parquetWriterHandler =
+        wrapper.openParquetFile(path, schema, maxRowGroupRows, maxRowGroupBytes);
+  }
+
   public long openParquetFile(String path, Schema schema) throws IOException {
     return wrapper.openParquetFile(path, schema);
   }
@@ -35,7 +35,8 @@ import org.apache.arrow.vector.util.ByteArrayReadableSeekableByteChannel;
 import io.netty.buffer.ArrowBuf;
 
 public class ParquetWriterJniWrapper {
-  private native long nativeOpenParquetWriter(String path, byte[] schemaBytes);
+  private native long nativeOpenParquetWriter(
+      String path, byte[] schemaBytes, long maxRowGroupRows, long maxRowGroupBytes);
   private native void nativeCloseParquetWriter(long nativeHandler);
   private native void nativeWriteNext(
       long nativeHandler, int numRows, long[] bufAddrs, long[] bufSizes);
@@ -44,11 +45,22 @@ public class ParquetWriterJniWrapper {
     ParquetJniUtils.getInstance();
   }
 
+  /** Default number of rows buffered before a row group is written. */
+  public static final long DEFAULT_MAX_ROW_GROUP_ROWS = 1024 * 1024;
+  /** Default number of bytes buffered before a row group is written. */
+  public static final long DEFAULT_MAX_ROW_GROUP_BYTES = 128 * 1024 * 1024;
+
   long openParquetFile(String path, Schema schema) throws IOException {
+    return openParquetFile(
+        path, schema, DEFAULT_MAX_ROW_GROUP_ROWS, DEFAULT_MAX_ROW_GROUP_BYTES);
+  }
+
+  long openParquetFile(String path, Schema schema, long maxRowGroupRows,
+      long maxRowGroupBytes) throws IOException {
     ByteArrayOutputStream out = new ByteArrayOutputStream();
     MessageSerializer.serialize(new WriteChannel(Channels.newChannel(out)), schema);
     byte[] schemaBytes = out.toByteArray(); 
-    return nativeOpenParquetWriter(path, schemaBytes);
+    return nativeOpenParquetWriter(path, schemaBytes, maxRowGroupRows, maxRowGroupBytes);
   }
 
   void closeParquetFile(long nativeHandler) {